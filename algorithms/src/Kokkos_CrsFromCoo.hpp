@@ -0,0 +1,384 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_CRS_FROM_COO_HPP_
+#define KOKKOS_CRS_FROM_COO_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Histogram.hpp>
+#include <Kokkos_NestedSort.hpp>
+#include <Kokkos_SegmentedSort.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class RowsType>
+struct CrsFromCooRowRange {
+  RowsType rows;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, Kokkos::MinMaxScalar<int64_t>& range) const {
+    const int64_t r = rows(i);
+    if (r < range.min_val) range.min_val = r;
+    if (r > range.max_val) range.max_val = r;
+  }
+};
+
+template <class RowsType>
+struct CrsFromCooRowBin {
+  RowsType rows;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const int i) const { return rows(i); }
+};
+
+// Turns the counts in row_map(1), ..., row_map(num_rows) into offsets
+template <class RowMapType>
+struct CrsFromCooOffsets {
+  using value_type = typename RowMapType::non_const_value_type;
+
+  RowMapType row_map;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int r, value_type& update, const bool final) const {
+    update += row_map(r);
+    if (final) row_map(r) = update;
+  }
+};
+
+template <class DstType, class SrcType>
+KOKKOS_INLINE_FUNCTION void crs_from_coo_assign(const DstType& dst,
+                                                const size_t k,
+                                                const SrcType& src,
+                                                const size_t i) {
+  dst(k) = src(i);
+}
+
+KOKKOS_INLINE_FUNCTION
+void crs_from_coo_assign(NestedSortNoValues, const size_t, NestedSortNoValues,
+                         const size_t) {}
+
+template <class DstType, class SrcType>
+KOKKOS_INLINE_FUNCTION void crs_from_coo_accumulate(const DstType& dst,
+                                                    const size_t k,
+                                                    const SrcType& src,
+                                                    const size_t i) {
+  dst(k) += src(i);
+}
+
+KOKKOS_INLINE_FUNCTION
+void crs_from_coo_accumulate(NestedSortNoValues, const size_t,
+                             NestedSortNoValues, const size_t) {}
+
+template <class ValuesType>
+struct CrsFromCooValues {
+  template <class ExecutionSpace>
+  static ValuesType allocate(const ExecutionSpace& exec,
+                             const std::string& label, const size_t n) {
+    return ValuesType(view_alloc(exec, WithoutInitializing, label), n);
+  }
+};
+
+template <>
+struct CrsFromCooValues<NestedSortNoValues> {
+  template <class ExecutionSpace>
+  static NestedSortNoValues allocate(const ExecutionSpace&, const std::string&,
+                                     const size_t) {
+    return NestedSortNoValues{};
+  }
+};
+
+// Moves every coordinate to the next free slot of its row
+template <class RowsType, class ColsType, class InValuesType, class FillType,
+          class EntriesType, class ValuesType>
+struct CrsFromCooScatter {
+  RowsType rows;
+  ColsType cols;
+  InValuesType in_values;
+  FillType fill;
+  EntriesType entries;
+  ValuesType values;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    const auto k = Kokkos::atomic_fetch_add(
+        &fill(rows(i)), typename FillType::non_const_value_type(1));
+    entries(k) = cols(i);
+    crs_from_coo_assign(values, k, in_values, i);
+  }
+};
+
+// Counts the distinct entries of each sorted row into counts(r + 1)
+template <class RowMapType, class EntriesType, class CountsType>
+struct CrsFromCooCountUnique {
+  RowMapType row_map;
+  EntriesType entries;
+  CountsType counts;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int r) const {
+    typename CountsType::non_const_value_type count = 0;
+    for (auto k = row_map(r); k < row_map(r + 1); ++k) {
+      if (k == row_map(r) || entries(k) != entries(k - 1)) ++count;
+    }
+    counts(r + 1) = count;
+  }
+};
+
+// Copies the distinct entries of each sorted row, summing the values of
+// repeated entries
+template <class RowMapType, class EntriesType, class ValuesType>
+struct CrsFromCooCompact {
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  RowMapType unique_row_map;
+  EntriesType unique_entries;
+  ValuesType unique_values;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int r) const {
+    auto out = unique_row_map(r);
+    for (auto k = row_map(r); k < row_map(r + 1); ++k) {
+      if (k > row_map(r) && entries(k) == entries(k - 1)) {
+        crs_from_coo_accumulate(unique_values, out - 1, values, k);
+      } else {
+        unique_entries(out) = entries(k);
+        crs_from_coo_assign(unique_values, out, values, k);
+        ++out;
+      }
+    }
+  }
+};
+
+template <class GraphType, class ExecutionSpace, class RowsType,
+          class ColsType, class InValuesType, class ValuesType>
+GraphType crs_from_coo(const ExecutionSpace& exec, int64_t num_rows,
+                       const RowsType& rows, const ColsType& cols,
+                       const InValuesType& in_values, ValuesType& values,
+                       const bool deduplicate) {
+  static_assert(RowsType::rank == 1 && ColsType::rank == 1,
+                "Kokkos::Experimental::crs_from_coo requires rank 1 Views");
+  using row_map_type = typename GraphType::row_map_type::non_const_type;
+  using entries_type = typename GraphType::entries_type::non_const_type;
+  using size_type    = typename row_map_type::non_const_value_type;
+  using policy_type  = Kokkos::RangePolicy<ExecutionSpace>;
+  using values_alloc = CrsFromCooValues<ValuesType>;
+
+  const int n = rows.extent(0);
+  if (cols.extent(0) != rows.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::crs_from_coo: rows and cols must have the "
+        "same extent");
+  }
+
+  // One reduction checks the row indices and sizes the graph if needed
+  Kokkos::MinMaxScalar<int64_t> range;
+  Kokkos::parallel_reduce("Kokkos::Experimental::crs_from_coo::row_range",
+                          policy_type(exec, 0, n),
+                          CrsFromCooRowRange<RowsType>{rows},
+                          Kokkos::MinMax<int64_t>(range));
+  if (num_rows < 0) num_rows = n > 0 ? range.max_val + 1 : 0;
+  if (n > 0 && (range.min_val < 0 || range.max_val >= num_rows)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::crs_from_coo: row index out of range");
+  }
+
+  // Count the entries of each row and turn the counts into offsets
+  row_map_type row_map(
+      view_alloc(exec, "Kokkos::Experimental::crs_from_coo::row_map"),
+      num_rows + 1);
+  histogram_impl(exec,
+                 Kokkos::subview(row_map, Kokkos::make_pair(int64_t(1),
+                                                            num_rows + 1)),
+                 CrsFromCooRowBin<RowsType>{rows}, n,
+                 HistogramStrategy::Automatic);
+  Kokkos::parallel_scan("Kokkos::Experimental::crs_from_coo::offsets",
+                        policy_type(exec, 0, num_rows + 1),
+                        CrsFromCooOffsets<row_map_type>{row_map});
+
+  // Scatter the coordinates to their rows and sort each row
+  row_map_type fill(
+      view_alloc(exec, WithoutInitializing,
+                 "Kokkos::Experimental::crs_from_coo::fill"),
+      num_rows);
+  Kokkos::deep_copy(exec, fill,
+                    Kokkos::subview(row_map, Kokkos::make_pair(int64_t(0),
+                                                               num_rows)));
+  entries_type entries(
+      view_alloc(exec, WithoutInitializing,
+                 "Kokkos::Experimental::crs_from_coo::entries"),
+      n);
+  values = values_alloc::allocate(
+      exec, "Kokkos::Experimental::crs_from_coo::values", n);
+  Kokkos::parallel_for(
+      "Kokkos::Experimental::crs_from_coo::scatter", policy_type(exec, 0, n),
+      CrsFromCooScatter<RowsType, ColsType, InValuesType, row_map_type,
+                        entries_type, ValuesType>{rows, cols, in_values, fill,
+                                                  entries, values});
+  // segmented_sort waits for its segment counts and, when some row is too
+  // long for a team, copies the list of those rows back to the host
+  Impl::segmented_sort(exec, row_map, entries, values);
+
+  if (deduplicate) {
+    row_map_type unique_row_map(
+        view_alloc(exec, "Kokkos::Experimental::crs_from_coo::row_map"),
+        num_rows + 1);
+    Kokkos::parallel_for(
+        "Kokkos::Experimental::crs_from_coo::count_unique",
+        policy_type(exec, 0, num_rows),
+        CrsFromCooCountUnique<row_map_type, entries_type, row_map_type>{
+            row_map, entries, unique_row_map});
+    Kokkos::parallel_scan("Kokkos::Experimental::crs_from_coo::offsets",
+                          policy_type(exec, 0, num_rows + 1),
+                          CrsFromCooOffsets<row_map_type>{unique_row_map});
+    size_type num_unique = 0;
+    Kokkos::deep_copy(exec, num_unique,
+                      Kokkos::subview(unique_row_map, num_rows));
+    exec.fence(
+        "Kokkos::Experimental::crs_from_coo: fence after counting the "
+        "distinct entries");
+
+    entries_type unique_entries(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::Experimental::crs_from_coo::entries"),
+        num_unique);
+    ValuesType unique_values = values_alloc::allocate(
+        exec, "Kokkos::Experimental::crs_from_coo::values", num_unique);
+    Kokkos::parallel_for(
+        "Kokkos::Experimental::crs_from_coo::compact",
+        policy_type(exec, 0, num_rows),
+        CrsFromCooCompact<row_map_type, entries_type, ValuesType>{
+            row_map, entries, values, unique_row_map, unique_entries,
+            unique_values});
+    row_map = unique_row_map;
+    entries = unique_entries;
+    values  = unique_values;
+  }
+
+  GraphType graph;
+  graph.row_map = row_map;
+  graph.entries = entries;
+  return graph;
+}
+
+}  // namespace Impl
+
+// Builds a StaticCrsGraph or Crs from coordinates: row rows(i) gets the
+// entry cols(i) for every i, and the entries of each row are sorted in
+// ascending order. The graph has one row more than the largest row index,
+// or num_rows rows. With deduplicate, repeated coordinates give one entry.
+// The host waits on exec for the row range, for the segment counts of the
+// sort and the rows too long for a team, and for the deduplicated size.
+template <class GraphType, class ExecutionSpace, class RowsType,
+          class ColsType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value &&
+                     Kokkos::is_view<RowsType>::value,
+                 GraphType>
+crs_from_coo(const ExecutionSpace& exec, const RowsType& rows,
+             const ColsType& cols, const bool deduplicate = false) {
+  Impl::NestedSortNoValues values;
+  return Impl::crs_from_coo<GraphType>(exec, -1, rows, cols,
+                                       Impl::NestedSortNoValues{}, values,
+                                       deduplicate);
+}
+
+template <class GraphType, class ExecutionSpace, class RowsType,
+          class ColsType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value,
+                 GraphType>
+crs_from_coo(const ExecutionSpace& exec, const int64_t num_rows,
+             const RowsType& rows, const ColsType& cols,
+             const bool deduplicate = false) {
+  Impl::NestedSortNoValues values;
+  return Impl::crs_from_coo<GraphType>(exec, num_rows, rows, cols,
+                                       Impl::NestedSortNoValues{}, values,
+                                       deduplicate);
+}
+
+// Also moves the value vals(i) of every coordinate to values, which is
+// allocated with one value per entry of the graph. With deduplicate, the
+// values of repeated coordinates are summed, in an unspecified order.
+template <class GraphType, class ExecutionSpace, class RowsType,
+          class ColsType, class InValuesType, class ValuesType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value &&
+                     Kokkos::is_view<RowsType>::value,
+                 GraphType>
+crs_from_coo(const ExecutionSpace& exec, const RowsType& rows,
+             const ColsType& cols, const InValuesType& vals,
+             ValuesType& values, const bool deduplicate = false) {
+  if (vals.extent(0) != rows.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::crs_from_coo: rows and vals must have the "
+        "same extent");
+  }
+  return Impl::crs_from_coo<GraphType>(exec, -1, rows, cols, vals, values,
+                                       deduplicate);
+}
+
+template <class GraphType, class ExecutionSpace, class RowsType,
+          class ColsType, class InValuesType, class ValuesType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value,
+                 GraphType>
+crs_from_coo(const ExecutionSpace& exec, const int64_t num_rows,
+             const RowsType& rows, const ColsType& cols,
+             const InValuesType& vals, ValuesType& values,
+             const bool deduplicate = false) {
+  if (vals.extent(0) != rows.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::crs_from_coo: rows and vals must have the "
+        "same extent");
+  }
+  return Impl::crs_from_coo<GraphType>(exec, num_rows, rows, cols, vals,
+                                       values, deduplicate);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
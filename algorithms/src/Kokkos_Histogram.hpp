@@ -0,0 +1,264 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_HISTOGRAM_HPP_
+#define KOKKOS_HISTOGRAM_HPP_
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+// How the counts of a histogram are accumulated. Atomic increments one
+// shared histogram, Duplicated increments a few copies atomically and
+// Private gives every thread its own copy, incremented without atomics.
+// The copies are summed into the result at the end.
+enum class HistogramStrategy { Automatic, Atomic, Duplicated, Private };
+
+// Picks the strategy for counting num_elements values into num_bins bins.
+// Copies are used as long as summing them costs no more than counting:
+// one per thread when that is affordable, fewer otherwise. Atomics are
+// used on devices and when the bins are many enough for collisions between
+// threads to be rare.
+template <class ExecutionSpace>
+HistogramStrategy choose_histogram_strategy(const ExecutionSpace& exec,
+                                            const size_t num_elements,
+                                            const size_t num_bins) {
+  const size_t concurrency = exec.concurrency();
+  if (!Kokkos::SpaceAccessibility<ExecutionSpace,
+                                  Kokkos::HostSpace>::accessible) {
+    return HistogramStrategy::Atomic;
+  }
+  if (concurrency == 1 || num_bins * concurrency <= num_elements) {
+    return HistogramStrategy::Private;
+  }
+  if (num_bins >= 1024 * concurrency || 2 * num_bins > num_elements) {
+    return HistogramStrategy::Atomic;
+  }
+  return HistogramStrategy::Duplicated;
+}
+
+namespace Impl {
+
+// Maps the index of a value to its bin with a BinSort binning operator
+template <class DataViewType, class BinOpType>
+struct HistogramBinOpFunctor {
+  DataViewType data;
+  BinOpType bin_op;
+  int offset;
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const int i) const { return bin_op.bin(data, offset + i); }
+};
+
+template <class CountsType, class BinFunctorType>
+struct HistogramAtomicFunctor {
+  CountsType counts;
+  BinFunctorType bin;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    Kokkos::atomic_increment(&counts(bin(i)));
+  }
+};
+
+// Counts a chunk of the values into the copy owned by the calling thread,
+// atomically when copies are shared by several threads
+template <class CopiesType, class BinFunctorType, class TokenType,
+          bool UseAtomics>
+struct HistogramCopiesFunctor {
+  CopiesType copies;
+  BinFunctorType bin;
+  TokenType token;
+  int num_elements;
+  int chunk_size;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int chunk) const {
+    const int id   = token.acquire();
+    const int copy = id % int(copies.extent(0));
+    const int last = (chunk + 1) * chunk_size;
+    const int end  = last < num_elements ? last : num_elements;
+    for (int i = chunk * chunk_size; i < end; ++i) {
+      if (UseAtomics) {
+        Kokkos::atomic_increment(&copies(copy, bin(i)));
+      } else {
+        ++copies(copy, bin(i));
+      }
+    }
+    token.release(id);
+  }
+};
+
+template <class CountsType, class CopiesType>
+struct HistogramMergeFunctor {
+  CountsType counts;
+  CopiesType copies;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int b) const {
+    typename CountsType::non_const_value_type sum = 0;
+    for (size_t c = 0; c < copies.extent(0); ++c) {
+      sum += copies(c, b);
+    }
+    counts(b) = sum;
+  }
+};
+
+// Overwrites counts(b) with the number of indices i < num_elements for
+// which bin(i) == b
+template <class ExecutionSpace, class CountsType, class BinFunctorType>
+void histogram_impl(const ExecutionSpace& exec, const CountsType& counts,
+                    const BinFunctorType& bin, const int num_elements,
+                    HistogramStrategy strategy) {
+  const int num_bins = counts.extent(0);
+  if (strategy == HistogramStrategy::Automatic) {
+    strategy = choose_histogram_strategy(exec, num_elements, num_bins);
+  }
+
+  if (strategy == HistogramStrategy::Atomic) {
+    Kokkos::deep_copy(exec, counts, 0);
+    Kokkos::parallel_for(
+        "Kokkos::Histogram::Atomic",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_elements),
+        HistogramAtomicFunctor<CountsType, BinFunctorType>{counts, bin});
+    return;
+  }
+
+  using token_type = Kokkos::Experimental::UniqueToken<ExecutionSpace>;
+  using copies_type =
+      Kokkos::View<typename CountsType::non_const_value_type**,
+                   Kokkos::LayoutRight, typename CountsType::memory_space>;
+
+  token_type token(exec);
+  int num_copies = token.size();
+  if (strategy == HistogramStrategy::Duplicated) {
+    // keep the merge no more expensive than the counting
+    num_copies = std::max(
+        1, std::min(num_copies, num_elements / std::max(num_bins, 1)));
+  }
+  copies_type copies(
+      Kokkos::view_alloc(exec, "Kokkos::Histogram::copies"), num_copies,
+      num_bins);
+
+  const int chunk_size = 2048;
+  const int num_chunks = (num_elements + chunk_size - 1) / chunk_size;
+  if (strategy == HistogramStrategy::Private) {
+    using functor_type =
+        HistogramCopiesFunctor<copies_type, BinFunctorType, token_type, false>;
+    Kokkos::parallel_for(
+        "Kokkos::Histogram::Private",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_chunks),
+        functor_type{copies, bin, token, num_elements, chunk_size});
+  } else {
+    using functor_type =
+        HistogramCopiesFunctor<copies_type, BinFunctorType, token_type, true>;
+    Kokkos::parallel_for(
+        "Kokkos::Histogram::Duplicated",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_chunks),
+        functor_type{copies, bin, token, num_elements, chunk_size});
+  }
+
+  Kokkos::parallel_for(
+      "Kokkos::Histogram::Merge",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_bins),
+      HistogramMergeFunctor<CountsType, copies_type>{counts, copies});
+}
+
+}  // namespace Impl
+
+// Counts the values of data into bins, bins(b) is overwritten with the
+// number of values for which bin_op.bin(data, i) == b. The binning
+// operators of BinSort, such as BinOp1D and BinOp3D, can be used.
+template <class ExecutionSpace, class DataViewType, class BinsViewType,
+          class BinOpType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value> histogram(
+    const ExecutionSpace& exec, const DataViewType& data,
+    const BinsViewType& bins, const BinOpType& bin_op,
+    HistogramStrategy strategy = HistogramStrategy::Automatic) {
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename DataViewType::memory_space>::
+          accessible,
+      "Kokkos::Experimental::histogram: data must be accessible from the "
+      "execution space");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename BinsViewType::memory_space>::
+          accessible,
+      "Kokkos::Experimental::histogram: bins must be accessible from the "
+      "execution space");
+  static_assert(BinsViewType::Rank == 1,
+                "Kokkos::Experimental::histogram: bins must be of rank 1");
+
+  if (bins.extent(0) < size_t(bin_op.max_bins())) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::histogram: bins has fewer entries than "
+        "bin_op.max_bins()");
+  }
+
+  const auto counts =
+      Kokkos::subview(bins, Kokkos::make_pair(0, bin_op.max_bins()));
+  using bin_functor_type = Impl::HistogramBinOpFunctor<
+      typename DataViewType::const_type, BinOpType>;
+  Impl::histogram_impl(exec, counts, bin_functor_type{data, bin_op, 0},
+                       int(data.extent(0)), strategy);
+}
+
+template <class DataViewType, class BinsViewType, class BinOpType>
+void histogram(const DataViewType& data, const BinsViewType& bins,
+               const BinOpType& bin_op,
+               HistogramStrategy strategy = HistogramStrategy::Automatic) {
+  typename BinsViewType::execution_space exec;
+  histogram(exec, data, bins, bin_op, strategy);
+  exec.fence("Kokkos::Experimental::histogram: fence after histogram");
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,240 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_NESTED_SORT_HPP_
+#define KOKKOS_NESTED_SORT_HPP_
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+struct NestedSortTeamTag {};
+struct NestedSortThreadTag {};
+
+// Stands in for the values when sorting keys only
+struct NestedSortNoValues {};
+
+template <class TeamMember, class SizeType>
+KOKKOS_INLINE_FUNCTION auto nested_sort_range(NestedSortTeamTag,
+                                              const TeamMember& t,
+                                              const SizeType n) {
+  return Kokkos::TeamThreadRange(t, n);
+}
+
+template <class TeamMember, class SizeType>
+KOKKOS_INLINE_FUNCTION auto nested_sort_range(NestedSortThreadTag,
+                                              const TeamMember& t,
+                                              const SizeType n) {
+  return Kokkos::ThreadVectorRange(t, n);
+}
+
+template <class TeamMember>
+KOKKOS_INLINE_FUNCTION void nested_sort_barrier(NestedSortTeamTag,
+                                                const TeamMember& t) {
+  t.team_barrier();
+}
+
+// Vector lanes are synchronized at the end of every ThreadVectorRange loop
+template <class TeamMember>
+KOKKOS_INLINE_FUNCTION void nested_sort_barrier(NestedSortThreadTag,
+                                                const TeamMember&) {}
+
+template <class ViewType>
+KOKKOS_INLINE_FUNCTION void nested_sort_swap(const ViewType& v, const size_t i,
+                                             const size_t j) {
+  const auto tmp = v(i);
+  v(i)           = v(j);
+  v(j)           = tmp;
+}
+
+KOKKOS_INLINE_FUNCTION void nested_sort_swap(NestedSortNoValues, const size_t,
+                                             const size_t) {}
+
+template <class KeysType, class ValuesType, class ComparatorType>
+struct NestedSortCompareSwap {
+  KeysType keys;
+  ValuesType values;
+  ComparatorType comp;
+
+  // Orders keys(lo) and keys(hi) ascending. Positions past the end act as
+  // keys larger than all others, so they never need to move.
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t lo, const size_t hi) const {
+    if (hi < keys.extent(0) && comp(keys(hi), keys(lo))) {
+      nested_sort_swap(keys, lo, hi);
+      nested_sort_swap(values, lo, hi);
+    }
+  }
+};
+
+// Bitonic sorting network over the keys, padded to the next power of two.
+// Each stage first merges pairs of sorted blocks by comparing mirrored
+// positions, which keeps every block ascending and lets the padding stay at
+// the end, and then halves the comparison distance down to one. Each step
+// spreads its n / 2 independent comparisons over the threads of the team or
+// the vector lanes of a thread.
+template <class Tag, class TeamMember, class KeysType, class ValuesType,
+          class ComparatorType>
+KOKKOS_INLINE_FUNCTION void nested_sort(Tag tag, const TeamMember& t,
+                                        const KeysType& keys,
+                                        const ValuesType& values,
+                                        const ComparatorType& comp) {
+  static_assert(KeysType::rank == 1,
+                "Kokkos::Experimental nested sorts require rank 1 Views");
+
+  const size_t n = keys.extent(0);
+  size_t npot    = 1;
+  while (npot < n) npot *= 2;
+
+  const NestedSortCompareSwap<KeysType, ValuesType, ComparatorType>
+      compare_swap{keys, values, comp};
+
+  const auto range = nested_sort_range(tag, t, npot / 2);
+
+  for (size_t block = 2; block <= npot; block *= 2) {
+    const size_t half = block / 2;
+    Kokkos::parallel_for(range, [=](const size_t k) {
+      const size_t first = (k / half) * block;
+      compare_swap(first + k % half, first + block - 1 - k % half);
+    });
+    nested_sort_barrier(tag, t);
+
+    for (size_t dist = half / 2; dist > 0; dist /= 2) {
+      Kokkos::parallel_for(range, [=](const size_t k) {
+        const size_t lo = (k / dist) * 2 * dist + k % dist;
+        compare_swap(lo, lo + dist);
+      });
+      nested_sort_barrier(tag, t);
+    }
+  }
+}
+
+template <class ValueType>
+struct NestedSortLessThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a < b;
+  }
+};
+
+}  // namespace Impl
+
+// Sorts view cooperatively by all threads of the team t. The sort is not
+// stable and works in place, so a View of team scratch memory is the fastest
+// argument. Must be called by every thread of the team.
+template <class TeamMember, class ViewType, class ComparatorType>
+KOKKOS_INLINE_FUNCTION void sort_team(const TeamMember& t, const ViewType& view,
+                                      const ComparatorType& comp) {
+  Impl::nested_sort(Impl::NestedSortTeamTag{}, t, view,
+                    Impl::NestedSortNoValues{}, comp);
+}
+
+template <class TeamMember, class ViewType>
+KOKKOS_INLINE_FUNCTION void sort_team(const TeamMember& t,
+                                      const ViewType& view) {
+  using value_type = typename ViewType::non_const_value_type;
+  sort_team(t, view, Impl::NestedSortLessThan<value_type>{});
+}
+
+// Sorts keys and moves values along with them, by all threads of the team t
+template <class TeamMember, class KeysType, class ValuesType,
+          class ComparatorType>
+KOKKOS_INLINE_FUNCTION void sort_by_key_team(const TeamMember& t,
+                                             const KeysType& keys,
+                                             const ValuesType& values,
+                                             const ComparatorType& comp) {
+  KOKKOS_ASSERT(values.extent(0) == keys.extent(0));
+  Impl::nested_sort(Impl::NestedSortTeamTag{}, t, keys, values, comp);
+}
+
+template <class TeamMember, class KeysType, class ValuesType>
+KOKKOS_INLINE_FUNCTION void sort_by_key_team(const TeamMember& t,
+                                             const KeysType& keys,
+                                             const ValuesType& values) {
+  using key_type = typename KeysType::non_const_value_type;
+  sort_by_key_team(t, keys, values, Impl::NestedSortLessThan<key_type>{});
+}
+
+// Sorts view with the vector lanes of the calling thread of team t
+template <class TeamMember, class ViewType, class ComparatorType>
+KOKKOS_INLINE_FUNCTION void sort_thread(const TeamMember& t,
+                                        const ViewType& view,
+                                        const ComparatorType& comp) {
+  Impl::nested_sort(Impl::NestedSortThreadTag{}, t, view,
+                    Impl::NestedSortNoValues{}, comp);
+}
+
+template <class TeamMember, class ViewType>
+KOKKOS_INLINE_FUNCTION void sort_thread(const TeamMember& t,
+                                        const ViewType& view) {
+  using value_type = typename ViewType::non_const_value_type;
+  sort_thread(t, view, Impl::NestedSortLessThan<value_type>{});
+}
+
+// Sorts keys and moves values along with them, with the vector lanes of the
+// calling thread of team t
+template <class TeamMember, class KeysType, class ValuesType,
+          class ComparatorType>
+KOKKOS_INLINE_FUNCTION void sort_by_key_thread(const TeamMember& t,
+                                               const KeysType& keys,
+                                               const ValuesType& values,
+                                               const ComparatorType& comp) {
+  KOKKOS_ASSERT(values.extent(0) == keys.extent(0));
+  Impl::nested_sort(Impl::NestedSortThreadTag{}, t, keys, values, comp);
+}
+
+template <class TeamMember, class KeysType, class ValuesType>
+KOKKOS_INLINE_FUNCTION void sort_by_key_thread(const TeamMember& t,
+                                               const KeysType& keys,
+                                               const ValuesType& values) {
+  using key_type = typename KeysType::non_const_value_type;
+  sort_by_key_thread(t, keys, values, Impl::NestedSortLessThan<key_type>{});
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
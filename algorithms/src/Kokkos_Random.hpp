@@ -50,6 +50,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <vector>
 
 /// \file Kokkos_Random.hpp
 /// \brief Pseudorandom number generators
@@ -219,6 +220,40 @@ namespace Kokkos {
     double normal(const double& mean, const double& std_dev=1.0);
     }
 
+    //Non-uniform distributions for any generator:
+
+    //Draw an exponentially distributed double with given rate
+    template<class Generator>
+    KOKKOS_INLINE_FUNCTION
+    double rand_exponential(Generator& gen, const double rate = 1.0);
+
+    //Draw a gamma distributed double with given shape and scale
+    template<class Generator>
+    KOKKOS_INLINE_FUNCTION
+    double rand_gamma(Generator& gen, const double shape,
+                      const double scale = 1.0);
+
+    //Draw a Poisson distributed integer with given mean
+    template<class Generator>
+    KOKKOS_INLINE_FUNCTION
+    int64_t rand_poisson(Generator& gen, const double mean);
+
+    //Draw the number of successes among n trials of probability p
+    template<class Generator>
+    KOKKOS_INLINE_FUNCTION
+    int64_t rand_binomial(Generator& gen, int64_t n, double p);
+
+    //Draw indices with probabilities proportional to given weights
+    template<class DeviceType>
+    class Random_AliasTable {
+      template<class WeightsView>
+      Random_AliasTable(const WeightsView& weights);
+
+      template<class Generator>
+      KOKKOS_INLINE_FUNCTION
+      int draw(Generator& gen) const;
+    }
+
     //Additional Functions:
 
     //Fills view with random numbers in the range [0,range)
@@ -230,6 +265,13 @@ namespace Kokkos {
     void fill_random(ViewType view, PoolType pool,
                      ViewType::value_type start, ViewType::value_type end);
 
+    //Fills view with normal distributed numbers of given mean and standard
+    //deviation
+    template<class ViewType, class PoolType>
+    void fill_random_normal(ViewType view, PoolType pool,
+                            ViewType::value_type mean = 0,
+                            ViewType::value_type std_dev = 1);
+
 */
 // clang-format on
 
@@ -640,11 +682,28 @@ template <class DeviceType>
 struct Random_UniqueIndex {
   using locks_view_type = View<int**, DeviceType>;
   KOKKOS_FUNCTION
-  static int get_state_idx(const locks_view_type) {
-    KOKKOS_IF_ON_HOST(
-        (return DeviceType::execution_space::impl_hardware_thread_id();))
+  static int get_state_idx(const locks_view_type& locks_) {
+    KOKKOS_IF_ON_HOST((return get_state_idx_host(locks_);))
 
-    KOKKOS_IF_ON_DEVICE((return 0;))
+    KOKKOS_IF_ON_DEVICE(((void)locks_; return 0;))
+  }
+
+  // Host threads own the state of their rank without any atomics, as long as
+  // the pool has a state for every thread. Smaller pools are shared through
+  // the locks.
+  static int get_state_idx_host(const locks_view_type& locks_) {
+    using execution_space = typename DeviceType::execution_space;
+    const int num_states  = locks_.extent(0);
+    const int thread_id   = execution_space::impl_hardware_thread_id();
+    if (static_cast<int>(execution_space::impl_max_hardware_threads()) <=
+        num_states) {
+      return thread_id;
+    }
+    int i = thread_id % num_states;
+    while (Kokkos::atomic_compare_exchange(&locks_(i, 0), 0, 1)) {
+      i = (i + 1) % num_states;
+    }
+    return i;
   }
 };
 
@@ -1006,6 +1065,8 @@ class Random_XorShift64_Pool {
   KOKKOS_INLINE_FUNCTION
   void free_state(const Random_XorShift64<DeviceType>& state) const {
     state_(state.state_idx_, 0) = state.state_;
+    // Publish the state before the next owner can acquire the lock.
+    Kokkos::memory_fence();
     locks_(state.state_idx_, 0) = 0;
   }
 };
@@ -1265,13 +1326,629 @@ class Random_XorShift1024_Pool {
   KOKKOS_INLINE_FUNCTION
   void free_state(const Random_XorShift1024<DeviceType>& state) const {
     for (int i = 0; i < 16; i++) state_(state.state_idx_, i) = state.state_[i];
-    p_(state.state_idx_, 0)     = state.p_;
+    p_(state.state_idx_, 0) = state.p_;
+    Kokkos::memory_fence();
     locks_(state.state_idx_, 0) = 0;
   }
 };
 
+//----------------------------------------------------------------------------
+// Counter-based generators
+//
+// These generators are based on Salmon, Moraes, Dror and Shaw (2011).
+// "Parallel random numbers: as easy as 1, 2, 3."  The n-th block of random
+// bits of a stream is a keyed bijection of the counter (n, stream), so any
+// stream of any seed can be created where it is used, without a shared pool
+// of states and without locks. The numbers drawn only depend on the seed
+// and the stream index, not on the thread drawing them.
+//----------------------------------------------------------------------------
+
 namespace Impl {
 
+// Philox4x32-10
+struct Random_Philox4x32_Bijection {
+  KOKKOS_INLINE_FUNCTION
+  static void mulhilo(const uint32_t a, const uint32_t b, uint32_t& hi,
+                      uint32_t& lo) {
+    const uint64_t product = static_cast<uint64_t>(a) * b;
+    hi                     = static_cast<uint32_t>(product >> 32);
+    lo                     = static_cast<uint32_t>(product);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void apply(const uint32_t key[2], uint32_t ctr[4]) {
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    for (int r = 0; r < 10; ++r) {
+      uint32_t hi0, lo0, hi1, lo1;
+      mulhilo(0xD2511F53U, ctr[0], hi0, lo0);
+      mulhilo(0xCD9E8D57U, ctr[2], hi1, lo1);
+      ctr[0] = hi1 ^ ctr[1] ^ k0;
+      ctr[1] = lo1;
+      ctr[2] = hi0 ^ ctr[3] ^ k1;
+      ctr[3] = lo0;
+      k0 += 0x9E3779B9U;
+      k1 += 0xBB67AE85U;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void generate(const uint64_t seed, const uint64_t stream,
+                       const uint64_t block, uint32_t out[4]) {
+    const uint32_t key[2] = {static_cast<uint32_t>(seed),
+                             static_cast<uint32_t>(seed >> 32)};
+    out[0]                = static_cast<uint32_t>(block);
+    out[1]                = static_cast<uint32_t>(block >> 32);
+    out[2]                = static_cast<uint32_t>(stream);
+    out[3]                = static_cast<uint32_t>(stream >> 32);
+    apply(key, out);
+  }
+};
+
+// Threefry2x64-20
+struct Random_Threefry2x64_Bijection {
+  KOKKOS_INLINE_FUNCTION
+  static uint64_t rotl(const uint64_t x, const int n) {
+    return (x << n) | (x >> (64 - n));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void apply(const uint64_t key[2], uint64_t ctr[2]) {
+    constexpr int rotations[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    const uint64_t parity      = 0x1BD11BDAA9FC1A22ULL ^ key[0] ^ key[1];
+    const uint64_t ks[3]       = {key[0], key[1], parity};
+    ctr[0] += ks[0];
+    ctr[1] += ks[1];
+    for (int r = 0; r < 20; ++r) {
+      ctr[0] += ctr[1];
+      ctr[1] = rotl(ctr[1], rotations[r % 8]) ^ ctr[0];
+      if (r % 4 == 3) {
+        const int s = (r + 1) / 4;
+        ctr[0] += ks[s % 3];
+        ctr[1] += ks[(s + 1) % 3] + s;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void generate(const uint64_t seed, const uint64_t stream,
+                       const uint64_t block, uint32_t out[4]) {
+    const uint64_t key[2] = {seed, 0};
+    uint64_t ctr[2]       = {block, stream};
+    apply(key, ctr);
+    out[0] = static_cast<uint32_t>(ctr[0]);
+    out[1] = static_cast<uint32_t>(ctr[0] >> 32);
+    out[2] = static_cast<uint32_t>(ctr[1]);
+    out[3] = static_cast<uint32_t>(ctr[1] >> 32);
+  }
+};
+
+}  // namespace Impl
+
+template <class DeviceType, class Bijection>
+class Random_CounterBased_Pool;
+
+template <class DeviceType, class Bijection>
+class Random_CounterBased {
+ private:
+  uint64_t seed_;
+  uint64_t stream_;
+  uint64_t block_;
+  uint32_t buffer_[4];
+  int pos_;
+
+ public:
+  using device_type = DeviceType;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  // Starts drawing the stream of the given index of the seed
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased(uint64_t seed, uint64_t stream)
+      : seed_(seed), stream_(stream), block_(0), buffer_(), pos_(4) {}
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() {
+    if (pos_ == 4) {
+      Bijection::generate(seed_, stream_, block_++, buffer_);
+      pos_ = 0;
+    }
+    return buffer_[pos_++];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    const uint64_t lo = urand();
+    return (static_cast<uint64_t>(urand()) << 32) | lo;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  // The top 24 bits of a draw, scaled to [0,1)
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return (urand() >> 8) * (1.0f / 16777216.0f); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) { return range * frand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  // The top 53 bits of a draw, scaled to [0,1)
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return (urand64() >> 11) * (1.0 / 9007199254740992.0); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) { return range * drand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Marsaglia polar method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+    double S = 2.0;
+    double U;
+    while (S >= 1.0 || S == 0.0) {
+      U              = 2.0 * drand() - 1.0;
+      const double V = 2.0 * drand() - 1.0;
+      S              = U * U + V * V;
+    }
+    return U * std::sqrt(-2.0 * std::log(S) / S);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+};
+
+// Pool interface for the counter-based generators. It only holds the seed:
+// get_state(stream) creates the generator of a stream, free_state does
+// nothing. Distinct work items should draw from distinct streams, e.g. the
+// index of the work item.
+template <class DeviceType, class Bijection>
+class Random_CounterBased_Pool {
+ public:
+  using device_type    = typename DeviceType::device_type;
+  using generator_type = Random_CounterBased<DeviceType, Bijection>;
+  using bijection_type = Bijection;
+
+ private:
+  uint64_t seed_;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased_Pool() : seed_(0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased_Pool(uint64_t seed) : seed_(seed) {}
+
+  // The number of states is ignored, every stream is available
+  void init(uint64_t seed, int /*num_states*/) { seed_ = seed; }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state(const uint64_t stream) const {
+    return generator_type(seed_, stream);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const generator_type&) const {}
+};
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32 =
+    Random_CounterBased<DeviceType, Impl::Random_Philox4x32_Bijection>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32_Pool =
+    Random_CounterBased_Pool<DeviceType, Impl::Random_Philox4x32_Bijection>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry2x64 =
+    Random_CounterBased<DeviceType, Impl::Random_Threefry2x64_Bijection>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry2x64_Pool =
+    Random_CounterBased_Pool<DeviceType, Impl::Random_Threefry2x64_Bijection>;
+
+//----------------------------------------------------------------------------
+// Non-uniform distributions, for any of the generators above
+//----------------------------------------------------------------------------
+
+namespace Impl {
+
+// Uniformly distributed double in (0,1], with 53 random bits
+template <class Generator>
+KOKKOS_INLINE_FUNCTION double rand_open_unit(Generator& gen) {
+  return ((gen.urand64() >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+// Poisson distribution by multiplication of uniforms, for small means
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_poisson_small(Generator& gen,
+                                                  const double mean) {
+  const double limit = std::exp(-mean);
+  double product     = rand_open_unit(gen);
+  int64_t k          = 0;
+  while (product > limit) {
+    product *= rand_open_unit(gen);
+    ++k;
+  }
+  return k;
+}
+
+// Poisson distribution by transformed rejection with squeeze (PTRS),
+// W. Hoermann, Insurance: Mathematics and Economics 12, 39 (1993)
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_poisson_ptrs(Generator& gen,
+                                                 const double mean) {
+  const double sqrt_mean = std::sqrt(mean);
+  const double log_mean  = std::log(mean);
+  const double b         = 0.931 + 2.53 * sqrt_mean;
+  const double a         = -0.059 + 0.02483 * b;
+  const double inv_alpha = 1.1239 + 1.1328 / (b - 3.4);
+  const double v_r       = 0.9277 - 3.6224 / (b - 2);
+  while (true) {
+    const double u  = rand_open_unit(gen) - 0.5;
+    const double v  = rand_open_unit(gen);
+    const double us = 0.5 - std::abs(u);
+    const double k  = std::floor((2 * a / us + b) * u + mean + 0.43);
+    if (us >= 0.07 && v <= v_r) return static_cast<int64_t>(k);
+    if (k < 0 || (us < 0.013 && v > us)) continue;
+    if (std::log(v) + std::log(inv_alpha) - std::log(a / (us * us) + b) <=
+        -mean + k * log_mean - std::lgamma(k + 1)) {
+      return static_cast<int64_t>(k);
+    }
+  }
+}
+
+// Binomial distribution by inversion, for n * p < 10 with p <= 1/2
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_binomial_inversion(Generator& gen,
+                                                       const int64_t n,
+                                                       const double p) {
+  const double q  = 1 - p;
+  const double s  = p / q;
+  const double a  = (n + 1) * s;
+  const double r0 = std::pow(q, double(n));
+  while (true) {
+    double u  = rand_open_unit(gen);
+    double r  = r0;
+    int64_t k = 0;
+    while (u > r && k < n) {
+      u -= r;
+      ++k;
+      r *= a / k - s;
+    }
+    // Rounding may leave probability mass past n, draw again then
+    if (u <= r) return k;
+  }
+}
+
+// Stirling series remainder log(k!) - log(sqrt(2 pi) (k + 1)^(k + 1/2)
+// e^(-k - 1))
+KOKKOS_INLINE_FUNCTION
+double rand_stirling_correction(const double k) {
+  if (k < 10) {
+    return std::lgamma(k + 1) - (k + 0.5) * std::log(k + 1) + (k + 1) -
+           0.91893853320467274;
+  }
+  const double r  = 1 / (k + 1);
+  const double r2 = r * r;
+  return (1.0 / 12 - (1.0 / 360 - r2 / 1260) * r2) * r;
+}
+
+// Binomial distribution by transformed rejection with decomposition (BTRD),
+// W. Hoermann, J. Statist. Comput. Simul. 46, 101 (1993), for n * p >= 10
+// with p <= 1/2
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_binomial_btrd(Generator& gen,
+                                                  const int64_t n,
+                                                  const double p) {
+  const double m      = std::floor((n + 1) * p);
+  const double r      = p / (1 - p);
+  const double nr     = (n + 1) * r;
+  const double npq    = n * p * (1 - p);
+  const double spq    = std::sqrt(npq);
+  const double b      = 1.15 + 2.53 * spq;
+  const double a      = -0.0873 + 0.0248 * b + 0.01 * p;
+  const double c      = n * p + 0.5;
+  const double alpha  = (2.83 + 5.1 / b) * spq;
+  const double v_r    = 0.92 - 4.2 / b;
+  const double u_rv_r = 0.86 * v_r;
+  while (true) {
+    double v = rand_open_unit(gen);
+    double u;
+    if (v <= u_rv_r) {
+      // Most draws fall into the center, which is accepted right away
+      u = v / v_r - 0.43;
+      return static_cast<int64_t>(
+          std::floor((2 * a / (0.5 - std::abs(u)) + b) * u + c));
+    }
+    if (v >= v_r) {
+      u = rand_open_unit(gen) - 0.5;
+    } else {
+      u = v / v_r - 0.93;
+      u = (u < 0 ? -0.5 : 0.5) - u;
+      v = rand_open_unit(gen) * v_r;
+    }
+    const double us = 0.5 - std::abs(u);
+    const double k  = std::floor((2 * a / us + b) * u + c);
+    if (k < 0 || k > n) continue;
+    v               = v * alpha / (a / (us * us) + b);
+    const double km = std::abs(k - m);
+    if (km <= 15) {
+      // Compare with f(k) / f(m) evaluated recursively
+      double f = 1;
+      if (m < k) {
+        for (double i = m + 1; i <= k; ++i) f *= nr / i - r;
+      } else {
+        for (double i = k + 1; i <= m; ++i) v *= nr / i - r;
+      }
+      if (v <= f) return static_cast<int64_t>(k);
+      continue;
+    }
+    // Squeeze with the normal approximation, then the exact log density
+    v = std::log(v);
+    const double rho =
+        (km / npq) * (((km / 3 + 0.625) * km + 1.0 / 6) / npq + 0.5);
+    const double t = -km * km / (2 * npq);
+    if (v < t - rho) return static_cast<int64_t>(k);
+    if (v > t + rho) continue;
+    const double nm = n - m + 1;
+    const double nk = n - k + 1;
+    const double h  = (m + 0.5) * std::log((m + 1) / (r * nm)) +
+                     rand_stirling_correction(m) +
+                     rand_stirling_correction(n - m);
+    if (v <= h + (n + 1) * std::log(nm / nk) +
+                 (k + 0.5) * std::log(nk * r / (k + 1)) -
+                 rand_stirling_correction(k) -
+                 rand_stirling_correction(n - k)) {
+      return static_cast<int64_t>(k);
+    }
+  }
+}
+
+}  // namespace Impl
+
+// Exponentially distributed double with the given rate
+template <class Generator>
+KOKKOS_INLINE_FUNCTION double rand_exponential(Generator& gen,
+                                               const double rate = 1.0) {
+  return -std::log(Impl::rand_open_unit(gen)) / rate;
+}
+
+// Gamma distributed double with the given shape and scale, by the method of
+// G. Marsaglia and W. Tsang, ACM Trans. Math. Softw. 26, 363 (2000)
+template <class Generator>
+KOKKOS_INLINE_FUNCTION double rand_gamma(Generator& gen, const double shape,
+                                         const double scale = 1.0) {
+  KOKKOS_EXPECTS(shape > 0);
+  // Gamma(shape) = Gamma(shape + 1) * U^(1 / shape) for shape < 1
+  const double boost =
+      shape < 1 ? std::pow(Impl::rand_open_unit(gen), 1 / shape) : 1.0;
+  const double d = (shape < 1 ? shape + 1 : shape) - 1.0 / 3;
+  const double c = 1 / std::sqrt(9 * d);
+  while (true) {
+    double x, v;
+    do {
+      x = gen.normal();
+      v = 1 + c * x;
+    } while (v <= 0);
+    v              = v * v * v;
+    const double u = Impl::rand_open_unit(gen);
+    if (u < 1 - 0.0331 * x * x * x * x ||
+        std::log(u) < 0.5 * x * x + d * (1 - v + std::log(v))) {
+      return d * v * scale * boost;
+    }
+  }
+}
+
+// Poisson distributed integer with the given mean
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_poisson(Generator& gen,
+                                            const double mean) {
+  KOKKOS_EXPECTS(mean >= 0);
+  return mean < 10 ? Impl::rand_poisson_small(gen, mean)
+                   : Impl::rand_poisson_ptrs(gen, mean);
+}
+
+// Binomial distributed integer, the number of successes among n trials of
+// probability p
+template <class Generator>
+KOKKOS_INLINE_FUNCTION int64_t rand_binomial(Generator& gen, const int64_t n,
+                                             const double p) {
+  KOKKOS_EXPECTS(n >= 0 && p >= 0 && p <= 1);
+  // Draw the number of failures if those are less likely
+  const double q = p > 0.5 ? 1 - p : p;
+  int64_t k;
+  if (n == 0 || q == 0) {
+    k = 0;
+  } else if (n * q < 10) {
+    k = Impl::rand_binomial_inversion(gen, n, q);
+  } else {
+    k = Impl::rand_binomial_btrd(gen, n, q);
+  }
+  return p > 0.5 ? n - k : k;
+}
+
+// Draws indices 0, ..., n - 1 with probabilities proportional to the
+// weights it is constructed from, in constant time per draw. The table is
+// built on the host by Vose's alias method.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_AliasTable {
+ public:
+  using device_type = typename DeviceType::device_type;
+
+ private:
+  Kokkos::View<double*, device_type> probability_;
+  Kokkos::View<int*, device_type> alias_;
+
+ public:
+  Random_AliasTable() = default;
+
+  template <class WeightsView>
+  explicit Random_AliasTable(const WeightsView& weights) {
+    init(weights);
+  }
+
+  template <class WeightsView>
+  void init(const WeightsView& weights) {
+    static_assert(WeightsView::Rank == 1,
+                  "Kokkos::Random_AliasTable: weights must be of rank 1");
+    const int n = weights.extent(0);
+    if (n == 0) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Random_AliasTable: no weights");
+    }
+    auto h_weights =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), weights);
+    double total = 0;
+    for (int i = 0; i < n; ++i) {
+      if (!(h_weights(i) >= 0)) {
+        Kokkos::Impl::throw_runtime_exception(
+            "Kokkos::Random_AliasTable: negative weight");
+      }
+      total += h_weights(i);
+    }
+    if (!(total > 0)) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Random_AliasTable: weights sum to zero");
+    }
+
+    probability_ = Kokkos::View<double*, device_type>(
+        "Kokkos::Random_AliasTable::probability", n);
+    alias_ = Kokkos::View<int*, device_type>("Kokkos::Random_AliasTable::alias",
+                                             n);
+    auto h_probability = Kokkos::create_mirror_view(probability_);
+    auto h_alias       = Kokkos::create_mirror_view(alias_);
+
+    // Pair each underfull column with an overfull one topping it up
+    std::vector<double> scaled(n);
+    std::vector<int> small, large;
+    for (int i = 0; i < n; ++i) {
+      scaled[i] = h_weights(i) * n / total;
+      (scaled[i] < 1 ? small : large).push_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      const int s = small.back();
+      const int l = large.back();
+      small.pop_back();
+      h_probability(s) = scaled[s];
+      h_alias(s)       = l;
+      scaled[l] -= 1 - scaled[s];
+      if (scaled[l] < 1) {
+        large.pop_back();
+        small.push_back(l);
+      }
+    }
+    // Whatever is left is full up to rounding
+    for (int i : small) {
+      h_probability(i) = 1;
+      h_alias(i)       = i;
+    }
+    for (int i : large) {
+      h_probability(i) = 1;
+      h_alias(i)       = i;
+    }
+    Kokkos::deep_copy(probability_, h_probability);
+    Kokkos::deep_copy(alias_, h_alias);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int size() const { return probability_.extent(0); }
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION int draw(Generator& gen) const {
+    const int n = size();
+    const int i = gen.urand(n);
+    return gen.drand() < probability_(i) ? i : alias_(i);
+  }
+};
+
+namespace Impl {
+
+// Generator for the i-th chunk of fill_random. Counter-based generators draw
+// the stream of the chunk, so that the result does not depend on the threads.
+template <class RandomPool, class IndexType>
+KOKKOS_INLINE_FUNCTION typename RandomPool::generator_type
+fill_random_get_state(const RandomPool& rand_pool, const IndexType) {
+  return rand_pool.get_state();
+}
+
+template <class DeviceType, class Bijection, class IndexType>
+KOKKOS_INLINE_FUNCTION Random_CounterBased<DeviceType, Bijection>
+fill_random_get_state(
+    const Random_CounterBased_Pool<DeviceType, Bijection>& rand_pool,
+    const IndexType i) {
+  return rand_pool.get_state(i);
+}
+
 template <class ViewType, class RandomPool, int loops, int rank,
           class IndexType>
 struct fill_random_functor_begin_end;
@@ -1293,9 +1970,10 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 0,
       : a(a_), rand_pool(rand_pool_), begin(begin_), end(end_) {}
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(IndexType) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
-    a()                                     = Rand::draw(gen, begin, end);
+  void operator()(IndexType i) const {
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
+    a() = Rand::draw(gen, begin, end);
     rand_pool.free_state(gen);
   }
 };
@@ -1318,7 +1996,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 1,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0)))
@@ -1346,7 +2025,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 2,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1376,7 +2056,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 3,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1407,7 +2088,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 4,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1439,7 +2121,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 5,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1473,7 +2156,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 6,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1509,7 +2193,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 7,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1547,7 +2232,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1569,10 +2255,196 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
   }
 };
 
-template <class ViewType, class RandomPool, class IndexType = int64_t>
+// Independent xorshift64* streams advanced in lockstep, so that the loops
+// over the lanes vectorize. The lanes are seeded from a generator of the pool,
+// whose draws are decorrelated by the splitmix64 finalizer.
+struct fill_random_lanes {
+  enum : int { size = 8 };
+  uint64_t state[size];
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION explicit fill_random_lanes(Generator& gen) {
+    for (int l = 0; l < size; ++l) {
+      uint64_t z = gen.urand64() + 0x9E3779B97F4A7C15ULL;
+      z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      z          = z ^ (z >> 31);
+      state[l]   = z == 0 ? uint64_t(1318319) : z;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t next(const int l) {
+    uint64_t s = state[l];
+    s ^= s >> 12;
+    s ^= s << 25;
+    s ^= s >> 27;
+    state[l] = s;
+    return s * 2685821657736338717ULL;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void next(uint64_t r[size]) {
+    for (int l = 0; l < size; ++l) r[l] = next(l);
+  }
+};
+
+// Maps a draw of a lane to [begin,end), redrawing from the same lane when
+// the draw has to be rejected
+template <class Scalar, class Enable = void>
+struct fill_random_bulk_convert;
+
+template <>
+struct fill_random_bulk_convert<float> {
+  KOKKOS_INLINE_FUNCTION
+  static float apply(fill_random_lanes&, const int, const uint64_t r,
+                     const float begin, const float end) {
+    return begin + (end - begin) * ((r >> 40) * (1.0f / 16777216.0f));
+  }
+};
+
+template <>
+struct fill_random_bulk_convert<double> {
+  KOKKOS_INLINE_FUNCTION
+  static double apply(fill_random_lanes&, const int, const uint64_t r,
+                      const double begin, const double end) {
+    return begin + (end - begin) * ((r >> 11) * (1.0 / 9007199254740992.0));
+  }
+};
+
+template <class Scalar>
+struct fill_random_bulk_convert<
+    Scalar, std::enable_if_t<std::is_integral<Scalar>::value &&
+                             !std::is_same<Scalar, bool>::value>> {
+  KOKKOS_INLINE_FUNCTION
+  static Scalar apply(fill_random_lanes& lanes, const int l, uint64_t r,
+                      const Scalar begin, const Scalar end) {
+    const uint64_t range =
+        static_cast<uint64_t>(end) - static_cast<uint64_t>(begin);
+    uint64_t offset;
+    if (range <= 0xffffffffULL) {
+      // Lemire's multiply and shift, rejecting the few biased products
+      uint64_t m = (r >> 32) * range;
+      if (static_cast<uint32_t>(m) < range) {
+        const uint32_t threshold =
+            (0u - static_cast<uint32_t>(range)) % static_cast<uint32_t>(range);
+        while (static_cast<uint32_t>(m) < threshold) {
+          m = (lanes.next(l) >> 32) * range;
+        }
+      }
+      offset = m >> 32;
+    } else {
+      const uint64_t max_val = (~uint64_t(0) / range) * range;
+      while (r >= max_val) r = lanes.next(l);
+      offset = r % range;
+    }
+    return static_cast<Scalar>(static_cast<uint64_t>(begin) + offset);
+  }
+};
+
+template <class Scalar>
+struct fill_random_is_bulk
+    : std::integral_constant<bool, std::is_arithmetic<Scalar>::value &&
+                                       !std::is_same<Scalar, bool>::value> {};
+
+// Fills out[0], ..., out[n - 1] with values uniformly distributed in
+// [begin,end), drawn from lanes seeded by gen
+template <class Scalar, class Generator, class IndexType>
+KOKKOS_INLINE_FUNCTION void fill_random_block(Generator& gen, Scalar* out,
+                                              const IndexType n,
+                                              const Scalar begin,
+                                              const Scalar end) {
+  using convert             = fill_random_bulk_convert<Scalar>;
+  constexpr int lanes_size  = fill_random_lanes::size;
+  fill_random_lanes lanes(gen);
+  for (IndexType j = 0; j < n; j += lanes_size) {
+    uint64_t r[lanes_size];
+    lanes.next(r);
+    const int m = n - j < lanes_size ? int(n - j) : lanes_size;
+    for (int l = 0; l < m; ++l) {
+      out[j + l] = convert::apply(lanes, l, r[l], begin, end);
+    }
+  }
+}
+
+// Fills out[0], ..., out[n - 1] with normally distributed values, two per
+// draw of a lane pair by the Box-Muller transform
+template <class Scalar, class Generator, class IndexType>
+KOKKOS_INLINE_FUNCTION void fill_random_normal_block(Generator& gen,
+                                                     Scalar* out,
+                                                     const IndexType n,
+                                                     const Scalar mean,
+                                                     const Scalar std_dev) {
+  constexpr int lanes_size = fill_random_lanes::size;
+  constexpr double two_pi  = 6.283185307179586;
+  constexpr double scale   = 1.0 / 9007199254740992.0;
+  fill_random_lanes lanes(gen);
+  for (IndexType j = 0; j < n; j += 2 * lanes_size) {
+    double z[2 * lanes_size];
+    for (int l = 0; l < lanes_size; ++l) {
+      // u1 is in (0,1] so that its logarithm is finite
+      const double u1     = ((lanes.next(l) >> 11) + 1) * scale;
+      const double u2     = (lanes.next(l) >> 11) * scale;
+      const double radius = std::sqrt(-2.0 * std::log(u1));
+      z[l]                = radius * std::cos(two_pi * u2);
+      z[l + lanes_size]   = radius * std::sin(two_pi * u2);
+    }
+    const int m = n - j < 2 * lanes_size ? int(n - j) : 2 * lanes_size;
+    for (int k = 0; k < m; ++k) {
+      out[j + k] = static_cast<Scalar>(mean + std_dev * z[k]);
+    }
+  }
+}
+
+// Fills the span of a contiguous view by blocks, one generator per block
+template <class ViewType, class RandomPool, class IndexType, bool Normal>
+struct fill_random_bulk_functor {
+  using execution_space = typename ViewType::execution_space;
+  using value_type      = typename ViewType::non_const_value_type;
+
+  enum : int { block_size = 4096 };
+
+  ViewType a;
+  RandomPool rand_pool;
+  value_type begin, end;
+
+  fill_random_bulk_functor(ViewType a_, RandomPool rand_pool_,
+                           value_type begin_, value_type end_)
+      : a(a_), rand_pool(rand_pool_), begin(begin_), end(end_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(IndexType i) const {
+    typename RandomPool::generator_type gen =
+        fill_random_get_state(rand_pool, i);
+    const IndexType first = i * block_size;
+    const IndexType span  = a.span();
+    const IndexType n =
+        span - first < block_size ? span - first : IndexType(block_size);
+    if (Normal) {
+      fill_random_normal_block(gen, a.data() + first, n, begin, end);
+    } else {
+      fill_random_block(gen, a.data() + first, n, begin, end);
+    }
+    rand_pool.free_state(gen);
+  }
+};
+
+template <bool Normal, class IndexType, class ViewType, class RandomPool>
+void fill_random_bulk(ViewType a, RandomPool g,
+                      typename ViewType::const_value_type begin,
+                      typename ViewType::const_value_type end) {
+  using functor_type =
+      fill_random_bulk_functor<ViewType, RandomPool, IndexType, Normal>;
+  const int64_t num_blocks =
+      (a.span() + functor_type::block_size - 1) / functor_type::block_size;
+  parallel_for("Kokkos::fill_random", num_blocks,
+               functor_type(a, g, begin, end));
+}
+
+template <class ViewType, class RandomPool, class IndexType>
 void fill_random(ViewType a, RandomPool g,
                  typename ViewType::const_value_type begin,
-                 typename ViewType::const_value_type end) {
+                 typename ViewType::const_value_type end, std::false_type) {
   int64_t LDA = a.extent(0);
   if (LDA > 0)
     parallel_for("Kokkos::fill_random", (LDA + 127) / 128,
@@ -1581,6 +2453,58 @@ void fill_random(ViewType a, RandomPool g,
                      a, g, begin, end));
 }
 
+// Contiguous views of arithmetic values are filled by blocks, the others
+// value by value
+template <class ViewType, class RandomPool, class IndexType>
+void fill_random(ViewType a, RandomPool g,
+                 typename ViewType::const_value_type begin,
+                 typename ViewType::const_value_type end, std::true_type) {
+  if (a.span_is_contiguous()) {
+    fill_random_bulk<false, IndexType>(a, g, begin, end);
+    return;
+  }
+  fill_random<ViewType, RandomPool, IndexType>(a, g, begin, end,
+                                               std::false_type());
+}
+
+template <class ViewType, class RandomPool, class IndexType = int64_t>
+void fill_random(ViewType a, RandomPool g,
+                 typename ViewType::const_value_type begin,
+                 typename ViewType::const_value_type end) {
+  if (a.size() == 0) return;
+  fill_random<ViewType, RandomPool, IndexType>(
+      a, g, begin, end,
+      fill_random_is_bulk<typename ViewType::non_const_value_type>());
+}
+
+template <class ViewType, class RandomPool, class IndexType = int64_t>
+void fill_random_normal(ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean,
+                        typename ViewType::const_value_type std_dev) {
+  static_assert(
+      std::is_floating_point<typename ViewType::value_type>::value,
+      "Kokkos::fill_random_normal: the values must be floating point");
+  if (a.size() == 0) return;
+  if (a.span_is_contiguous()) {
+    fill_random_bulk<true, IndexType>(a, g, mean, std_dev);
+    return;
+  }
+
+  // Fill a contiguous copy of the view
+  using tmp_view_type =
+      Kokkos::View<typename ViewType::non_const_data_type, Kokkos::LayoutRight,
+                   typename ViewType::device_type>;
+  typename tmp_view_type::array_layout layout;
+  for (unsigned r = 0; r < ViewType::Rank; ++r) {
+    layout.dimension[r] = a.extent(r);
+  }
+  tmp_view_type tmp(
+      view_alloc(WithoutInitializing, "Kokkos::fill_random_normal::tmp"),
+      layout);
+  fill_random_bulk<true, IndexType>(tmp, g, mean, std_dev);
+  deep_copy(a, tmp);
+}
+
 }  // namespace Impl
 
 template <class ViewType, class RandomPool, class IndexType = int64_t>
@@ -1597,6 +2521,19 @@ void fill_random(ViewType a, RandomPool g,
   fill_random(a, g, 0, range);
 }
 
+// Fills view with normally distributed values of the given mean and standard
+// deviation
+template <class ViewType, class RandomPool, class IndexType = int64_t>
+void fill_random_normal(ViewType a, RandomPool g,
+                        typename ViewType::const_value_type mean    = 0,
+                        typename ViewType::const_value_type std_dev = 1) {
+  Impl::apply_to_view_of_static_rank(
+      [&](auto dst) {
+        Kokkos::Impl::fill_random_normal(dst, g, mean, std_dev);
+      },
+      a);
+}
+
 }  // namespace Kokkos
 
 #endif
@@ -0,0 +1,432 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SEGMENTED_SORT_HPP_
+#define KOKKOS_SEGMENTED_SORT_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_NestedSort.hpp>
+#include <Kokkos_Sort.hpp>
+#include <Kokkos_StaticCrsGraph.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Team scratch for the values of a segment, nothing when sorting keys only
+template <class ValuesType, class ScratchSpace>
+struct SegmentedSortScratchValues {
+  using type = Kokkos::View<typename ValuesType::non_const_value_type*,
+                           ScratchSpace, Kokkos::MemoryUnmanaged>;
+
+  template <class TeamMember>
+  KOKKOS_INLINE_FUNCTION static type allocate(const TeamMember& t,
+                                              const size_t n) {
+    return type(t.team_scratch(0), n);
+  }
+
+  static size_t shmem_size(const size_t n) { return type::shmem_size(n); }
+};
+
+template <class ScratchSpace>
+struct SegmentedSortScratchValues<NestedSortNoValues, ScratchSpace> {
+  using type = NestedSortNoValues;
+
+  template <class TeamMember>
+  KOKKOS_INLINE_FUNCTION static type allocate(const TeamMember&,
+                                              const size_t) {
+    return type{};
+  }
+
+  static size_t shmem_size(const size_t) { return 0; }
+};
+
+template <class ViewType, class RangeType>
+KOKKOS_INLINE_FUNCTION auto segmented_sort_segment(const ViewType& view,
+                                                   const RangeType& range) {
+  return Kokkos::subview(view, range);
+}
+
+template <class RangeType>
+KOKKOS_INLINE_FUNCTION NestedSortNoValues
+segmented_sort_segment(NestedSortNoValues, const RangeType&) {
+  return NestedSortNoValues{};
+}
+
+template <class TeamMember, class DstType, class SrcType>
+KOKKOS_INLINE_FUNCTION void segmented_sort_copy(const TeamMember& t,
+                                                const DstType& dst,
+                                                const SrcType& src) {
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(t, dst.extent(0)),
+                       [&](const size_t i) { dst(i) = src(i); });
+}
+
+template <class TeamMember>
+KOKKOS_INLINE_FUNCTION void segmented_sort_copy(const TeamMember&,
+                                                NestedSortNoValues,
+                                                NestedSortNoValues) {}
+
+// Sorts the entries of every row of a CRS structure in ascending order.
+// Rows are put in one of three buckets by length and each bucket is sorted
+// with its own strategy: short rows by insertion sort in a single thread,
+// medium rows by one team with a bitonic network in team scratch (or in
+// place when the row does not fit), and long rows one after another by the
+// device-wide Kokkos::sort and Kokkos::sort_by_key.
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType>
+class SegmentedSort {
+ public:
+  using size_type     = typename RowMapType::non_const_value_type;
+  using memory_space  = typename EntriesType::memory_space;
+  using key_type      = typename EntriesType::non_const_value_type;
+  using segments_type = Kokkos::View<size_type*, memory_space>;
+  using long_segments_type =
+      Kokkos::View<Kokkos::pair<size_type, size_type>*, memory_space>;
+
+  using scratch_space = typename ExecutionSpace::scratch_memory_space;
+  using keys_scratch_type =
+      Kokkos::View<key_type*, scratch_space, Kokkos::MemoryUnmanaged>;
+  using values_scratch_traits =
+      SegmentedSortScratchValues<ValuesType, scratch_space>;
+
+  enum : size_t {
+    short_segment_size   = 32,
+    scratch_segment_size = 1024,
+    long_segment_size    = 8192
+  };
+
+  // Number of segments in each bucket, short, medium and long
+  struct bucket_counts {
+    size_type count[3];
+  };
+  using value_type = bucket_counts;
+
+  struct count_tag {};
+  struct find_tag {};
+  struct short_tag {};
+  struct medium_tag {};
+
+ private:
+  RowMapType m_row_map;
+  EntriesType m_entries;
+  ValuesType m_values;
+  segments_type m_short_segments;
+  segments_type m_medium_segments;
+  long_segments_type m_long_segments;
+
+ public:
+  SegmentedSort(const RowMapType& row_map, const EntriesType& entries,
+                const ValuesType& values)
+      : m_row_map(row_map),
+        m_entries(entries),
+        m_values(values) {}
+
+  void sort(const ExecutionSpace& exec) {
+    const size_t num_rows =
+        m_row_map.extent(0) > 0 ? m_row_map.extent(0) - 1 : 0;
+    if (num_rows == 0) return;
+
+    bucket_counts counts;
+    Kokkos::parallel_reduce(
+        "Kokkos::SegmentedSort::CountSegments",
+        Kokkos::RangePolicy<ExecutionSpace, count_tag>(exec, 0, num_rows),
+        *this, counts);
+
+    m_short_segments = segments_type(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::SegmentedSort::short_segments"),
+        counts.count[0]);
+    m_medium_segments = segments_type(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::SegmentedSort::medium_segments"),
+        counts.count[1]);
+    m_long_segments = long_segments_type(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::SegmentedSort::long_segments"),
+        counts.count[2]);
+    Kokkos::parallel_scan(
+        "Kokkos::SegmentedSort::FindSegments",
+        Kokkos::RangePolicy<ExecutionSpace, find_tag>(exec, 0, num_rows),
+        *this);
+
+    if (counts.count[0] > 0) {
+      Kokkos::parallel_for(
+          "Kokkos::SegmentedSort::SortShortSegments",
+          Kokkos::RangePolicy<ExecutionSpace, short_tag>(exec, 0,
+                                                         counts.count[0]),
+          *this);
+    }
+    if (counts.count[1] > 0) {
+      Kokkos::TeamPolicy<ExecutionSpace, medium_tag> policy(
+          exec, counts.count[1], Kokkos::AUTO);
+      policy.set_scratch_size(
+          0, Kokkos::PerTeam(
+                 keys_scratch_type::shmem_size(scratch_segment_size) +
+                 values_scratch_traits::shmem_size(scratch_segment_size)));
+      Kokkos::parallel_for("Kokkos::SegmentedSort::SortMediumSegments", policy,
+                           *this);
+    }
+    if (counts.count[2] > 0) {
+      auto long_segments = Kokkos::create_mirror_view_and_copy(
+          exec, Kokkos::HostSpace(), m_long_segments);
+      // The mirror copy is asynchronous on exec; wait for it before the
+      // host walks the segment list.
+      exec.fence();
+      for (size_t i = 0; i < long_segments.extent(0); ++i) {
+        sort_long_segment(exec, long_segments(i), m_values);
+      }
+    }
+
+    m_short_segments  = segments_type();
+    m_medium_segments = segments_type();
+    m_long_segments   = long_segments_type();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static int bucket(const size_type len) {
+    return len <= short_segment_size ? 0 : len <= long_segment_size ? 1 : 2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void init_counts(bucket_counts& counts) {
+    for (int b = 0; b < 3; ++b) counts.count[b] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void join_counts(volatile bucket_counts& dst,
+                          const volatile bucket_counts& src) {
+    for (int b = 0; b < 3; ++b) dst.count[b] += src.count[b];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(const count_tag& /*tag*/, bucket_counts& counts) const {
+    init_counts(counts);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(const find_tag& /*tag*/, bucket_counts& counts) const {
+    init_counts(counts);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(const count_tag& /*tag*/, volatile bucket_counts& dst,
+            const volatile bucket_counts& src) const {
+    join_counts(dst, src);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(const find_tag& /*tag*/, volatile bucket_counts& dst,
+            const volatile bucket_counts& src) const {
+    join_counts(dst, src);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const count_tag& /*tag*/, const size_t row,
+                  bucket_counts& counts) const {
+    ++counts.count[bucket(m_row_map(row + 1) - m_row_map(row))];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const find_tag& /*tag*/, const size_t row,
+                  bucket_counts& counts, const bool final) const {
+    const size_type begin = m_row_map(row);
+    const size_type end   = m_row_map(row + 1);
+    const int b           = bucket(end - begin);
+    if (final) {
+      if (b == 0) {
+        m_short_segments(counts.count[0]) = row;
+      } else if (b == 1) {
+        m_medium_segments(counts.count[1]) = row;
+      } else {
+        m_long_segments(counts.count[2]) = Kokkos::make_pair(begin, end);
+      }
+    }
+    ++counts.count[b];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const short_tag& /*tag*/, const size_t i) const {
+    const size_type row   = m_short_segments(i);
+    const size_type begin = m_row_map(row);
+    const size_type end   = m_row_map(row + 1);
+    for (size_type k = begin + 1; k < end; ++k) {
+      for (size_type j = k; j > begin && m_entries(j) < m_entries(j - 1); --j) {
+        nested_sort_swap(m_entries, j - 1, j);
+        nested_sort_swap(m_values, j - 1, j);
+      }
+    }
+  }
+
+  template <class TeamMember>
+  KOKKOS_INLINE_FUNCTION void operator()(const medium_tag& /*tag*/,
+                                         const TeamMember& t) const {
+    const size_type row = m_medium_segments(t.league_rank());
+    const auto range    = Kokkos::make_pair(m_row_map(row), m_row_map(row + 1));
+    const auto keys     = Kokkos::subview(m_entries, range);
+    const auto values   = segmented_sort_segment(m_values, range);
+    const NestedSortLessThan<key_type> comp{};
+
+    if (keys.extent(0) > scratch_segment_size) {
+      nested_sort(NestedSortTeamTag{}, t, keys, values, comp);
+      return;
+    }
+    const keys_scratch_type keys_scratch(t.team_scratch(0), keys.extent(0));
+    const auto values_scratch =
+        values_scratch_traits::allocate(t, keys.extent(0));
+    segmented_sort_copy(t, keys_scratch, keys);
+    segmented_sort_copy(t, values_scratch, values);
+    t.team_barrier();
+    nested_sort(NestedSortTeamTag{}, t, keys_scratch, values_scratch, comp);
+    segmented_sort_copy(t, keys, keys_scratch);
+    segmented_sort_copy(t, values, values_scratch);
+  }
+
+ private:
+  void sort_long_segment(const ExecutionSpace& exec,
+                         const Kokkos::pair<size_type, size_type>& range,
+                         NestedSortNoValues) const {
+    Kokkos::sort(exec, Kokkos::subview(m_entries, range));
+  }
+
+  template <class SegmentValuesType>
+  void sort_long_segment(const ExecutionSpace& exec,
+                         const Kokkos::pair<size_type, size_type>& range,
+                         const SegmentValuesType& values) const {
+    Kokkos::sort_by_key(exec, Kokkos::subview(m_entries, range),
+                        Kokkos::subview(values, range));
+  }
+};
+
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType>
+void segmented_sort(const ExecutionSpace& exec, const RowMapType& row_map,
+                    const EntriesType& entries, const ValuesType& values) {
+  static_assert(RowMapType::rank == 1 && EntriesType::rank == 1,
+                "Kokkos::Experimental::segmented_sort requires rank 1 Views");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename EntriesType::memory_space>::accessible,
+      "Kokkos::Experimental::segmented_sort: the execution space must be "
+      "able to access the entries");
+
+  SegmentedSort<ExecutionSpace, RowMapType, EntriesType, ValuesType> sorter(
+      row_map, entries, values);
+  sorter.sort(exec);
+}
+
+}  // namespace Impl
+
+// Sorts the entries of every row of a CRS structure, entries(row_map(r))
+// to entries(row_map(r + 1) - 1) for each row r, in ascending order
+template <class ExecutionSpace, class RowMapType, class EntriesType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>
+segmented_sort(const ExecutionSpace& exec, const RowMapType& row_map,
+               const EntriesType& entries) {
+  Impl::segmented_sort(exec, row_map, entries, Impl::NestedSortNoValues{});
+}
+
+// Sorts the entries of every row and moves values along with them
+template <class ExecutionSpace, class RowMapType, class EntriesType,
+          class ValuesType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>
+segmented_sort(const ExecutionSpace& exec, const RowMapType& row_map,
+               const EntriesType& entries, const ValuesType& values) {
+  static_assert(ValuesType::rank == 1,
+                "Kokkos::Experimental::segmented_sort requires rank 1 Views");
+  if (values.extent(0) != entries.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::segmented_sort: values and entries must have "
+        "the same extent");
+  }
+  Impl::segmented_sort(exec, row_map, entries, values);
+}
+
+template <class RowMapType, class EntriesType>
+std::enable_if_t<Kokkos::is_view<RowMapType>::value> segmented_sort(
+    const RowMapType& row_map, const EntriesType& entries) {
+  typename EntriesType::execution_space exec;
+  segmented_sort(exec, row_map, entries);
+  exec.fence("Kokkos::Experimental::segmented_sort: fence after sorting");
+}
+
+template <class RowMapType, class EntriesType, class ValuesType>
+std::enable_if_t<Kokkos::is_view<RowMapType>::value> segmented_sort(
+    const RowMapType& row_map, const EntriesType& entries,
+    const ValuesType& values) {
+  typename EntriesType::execution_space exec;
+  segmented_sort(exec, row_map, entries, values);
+  exec.fence("Kokkos::Experimental::segmented_sort: fence after sorting");
+}
+
+// Sorts the entries of every row of a StaticCrsGraph or Crs
+template <class ExecutionSpace, class GraphType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>
+sort_crs_graph(const ExecutionSpace& exec, const GraphType& graph) {
+  segmented_sort(exec, graph.row_map, graph.entries);
+}
+
+template <class GraphType>
+void sort_crs_graph(const GraphType& graph) {
+  typename GraphType::execution_space exec;
+  sort_crs_graph(exec, graph);
+  exec.fence("Kokkos::Experimental::sort_crs_graph: fence after sorting");
+}
+
+// Like Kokkos::create_staticcrsgraph, with the entries of every row sorted
+template <class StaticCrsGraphType, class InputSizeType>
+typename StaticCrsGraphType::staticcrsgraph_type create_sorted_staticcrsgraph(
+    const std::string& label,
+    const std::vector<std::vector<InputSizeType> >& input) {
+  auto graph = Kokkos::create_staticcrsgraph<StaticCrsGraphType>(label, input);
+  sort_crs_graph(graph);
+  return graph;
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -46,8 +46,12 @@
 #define KOKKOS_SORT_HPP_
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_Histogram.hpp>
+#include <Kokkos_NestedSort.hpp>
 
 #include <algorithm>
+#include <cstring>
+#include <string>
 
 namespace Kokkos {
 
@@ -84,6 +88,104 @@ struct CopyOp<DstViewType, SrcViewType, 3> {
         dst(i_dst, j, k) = src(i_src, j, k);
   }
 };
+
+// Uninitialized View shaped like values but with len entries in the first
+// dimension
+template <class ExecutionSpace, class ValuesViewType>
+Kokkos::View<typename ValuesViewType::non_const_data_type,
+             typename ValuesViewType::array_layout,
+             typename ValuesViewType::device_type>
+make_scratch_view(const ExecutionSpace& exec, const std::string& label,
+                  const ValuesViewType& values, const size_t len) {
+  using scratch_view_type =
+      Kokkos::View<typename ValuesViewType::non_const_data_type,
+                   typename ValuesViewType::array_layout,
+                   typename ValuesViewType::device_type>;
+
+  return scratch_view_type(
+      view_alloc(exec, WithoutInitializing, label),
+      values.rank_dynamic > 0 ? len : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 1 ? values.extent(1) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 2 ? values.extent(2) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 3 ? values.extent(3) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 4 ? values.extent(4) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 5 ? values.extent(5) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 6 ? values.extent(6) : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+      values.rank_dynamic > 7 ? values.extent(7)
+                              : KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+}
+
+// Merges pairs of neighbouring sorted runs of the given width from src into
+// dst, writing only the output positions [begin, end). The merge of a pair of
+// runs is stable and its start is found with a binary search along the merge
+// path, so that any split of the output can be merged independently.
+template <class SrcType, class DstType, class ComparatorType>
+KOKKOS_INLINE_FUNCTION void merge_runs(const SrcType& src, const DstType& dst,
+                                       const ComparatorType& comp,
+                                       const size_t size, const size_t width,
+                                       size_t begin, const size_t end) {
+  // The output range may span several pairs of runs
+  while (begin < end) {
+    const size_t first = begin - begin % (2 * width);
+    const size_t mid   = first + width < size ? first + width : size;
+    const size_t last  = first + 2 * width < size ? first + 2 * width : size;
+    const size_t stop  = end < last ? end : last;
+
+    // Number of elements of the first run ahead of begin in the output
+    const size_t diag = begin - first;
+    size_t lo         = diag > last - mid ? diag - (last - mid) : 0;
+    size_t hi         = diag < mid - first ? diag : mid - first;
+    while (lo < hi) {
+      const size_t k = (lo + hi) / 2;
+      if (comp(src[mid + diag - k - 1], src[first + k])) {
+        hi = k;
+      } else {
+        lo = k + 1;
+      }
+    }
+
+    size_t i = first + lo;
+    size_t j = mid + diag - lo;
+    for (; begin < stop; ++begin) {
+      if (j >= last || (i < mid && !comp(src[j], src[i]))) {
+        dst[begin] = src[i++];
+      } else {
+        dst[begin] = src[j++];
+      }
+    }
+  }
+}
+
+template <class ValuesType, class ComparatorType>
+KOKKOS_INLINE_FUNCTION void heap_sift_down(const ValuesType& values,
+                                           size_t root, const size_t size,
+                                           const ComparatorType& comp) {
+  for (size_t child = 2 * root + 1; child < size; child = 2 * root + 1) {
+    if (child + 1 < size && comp(values[child], values[child + 1])) ++child;
+    if (!comp(values[root], values[child])) return;
+    const auto tmp = values[root];
+    values[root]   = values[child];
+    values[child]  = tmp;
+    root           = child;
+  }
+}
+
+// In place O(n log n) sort of values[0], ..., values[size - 1] by a single
+// thread, without extra memory
+template <class ValuesType, class ComparatorType>
+KOKKOS_INLINE_FUNCTION void heap_sort(const ValuesType& values,
+                                      const size_t size,
+                                      const ComparatorType& comp) {
+  for (size_t root = size / 2; root-- > 0;) {
+    heap_sift_down(values, root, size, comp);
+  }
+  for (size_t last = size; last-- > 1;) {
+    const auto tmp = values[0];
+    values[0]      = values[last];
+    values[last]   = tmp;
+    heap_sift_down(values, 0, last, comp);
+  }
+}
 }  // namespace Impl
 
 //----------------------------------------------------------------------------
@@ -154,10 +256,18 @@ class BinSort {
   using execution_space = typename Space::execution_space;
   using bin_op_type     = BinSortOp;
 
-  struct bin_count_tag {};
   struct bin_offset_tag {};
   struct bin_binning_tag {};
   struct bin_sort_bins_tag {};
+  struct bin_count_large_bins_tag {};
+  struct bin_find_large_bins_tag {};
+  struct bin_sort_large_bins_tag {};
+
+  // Bins up to this size are sorted by bubble sort, larger ones by heap sort
+  enum : int { small_bin_size = 64 };
+
+  // Bins above this size are sorted by a whole team with a merge sort
+  enum : int { large_bin_size = 8192 };
 
  public:
   using size_type  = SizeType;
@@ -185,6 +295,17 @@ class BinSort {
   using bin_count_atomic_type =
       Kokkos::View<int*, Space, Kokkos::MemoryTraits<Kokkos::Atomic> >;
 
+  // Orders indices of keys as bin_op does
+  struct bin_order {
+    const_rnd_key_view_type keys;
+    BinSortOp op;
+
+    KOKKOS_INLINE_FUNCTION
+    bool operator()(const size_type i, const size_type j) const {
+      return op(keys, i, j);
+    }
+  };
+
  private:
   const_key_view_type keys;
   const_rnd_key_view_type keys_rnd;
@@ -196,10 +317,20 @@ class BinSort {
   bin_count_type bin_count_const;
   offset_type sort_order;
 
+ private:
+  Kokkos::View<int*, Space> large_bins;
+  offset_type sort_buffer;
+
+ public:
   int range_begin;
   int range_end;
   bool sort_within_bins;
 
+  // How the keys are counted into the bins, chosen from the number of keys,
+  // bins and threads by default
+  Experimental::HistogramStrategy count_strategy =
+      Experimental::HistogramStrategy::Automatic;
+
  public:
   BinSort() = default;
 
@@ -253,10 +384,13 @@ class BinSort {
   template <class ExecutionSpace = execution_space>
   void create_permute_vector(const ExecutionSpace& exec = execution_space{}) {
     const size_t len = range_end - range_begin;
-    Kokkos::parallel_for(
-        "Kokkos::Sort::BinCount",
-        Kokkos::RangePolicy<ExecutionSpace, bin_count_tag>(exec, 0, len),
-        *this);
+    using bin_functor_type =
+        Experimental::Impl::HistogramBinOpFunctor<const_key_view_type,
+                                                  BinSortOp>;
+    Experimental::Impl::histogram_impl(
+        exec, Kokkos::View<int*, Space>(bin_count_atomic),
+        bin_functor_type{keys, bin_op, range_begin}, int(len),
+        count_strategy);
     Kokkos::parallel_scan("Kokkos::Sort::BinOffset",
                           Kokkos::RangePolicy<ExecutionSpace, bin_offset_tag>(
                               exec, 0, bin_op.max_bins()),
@@ -268,24 +402,60 @@ class BinSort {
         Kokkos::RangePolicy<ExecutionSpace, bin_binning_tag>(exec, 0, len),
         *this);
 
-    if (sort_within_bins)
+    if (sort_within_bins) {
       Kokkos::parallel_for(
           "Kokkos::Sort::BinSort",
           Kokkos::RangePolicy<ExecutionSpace, bin_sort_bins_tag>(
               exec, 0, bin_op.max_bins()),
           *this);
+      sort_large_bins(exec);
+    }
+  }
+
+ private:
+  // Sorts bins too large for a single thread, one team per bin
+  template <class ExecutionSpace>
+  void sort_large_bins(const ExecutionSpace& exec) {
+    size_type num_large_bins = 0;
+    Kokkos::parallel_reduce(
+        "Kokkos::Sort::BinCountLargeBins",
+        Kokkos::RangePolicy<ExecutionSpace, bin_count_large_bins_tag>(
+            exec, 0, bin_op.max_bins()),
+        *this, num_large_bins);
+    if (num_large_bins == 0) return;
+
+    large_bins = Kokkos::View<int*, Space>(
+        view_alloc(exec, WithoutInitializing,
+                   "Kokkos::SortImpl::BinSortFunctor::large_bins"),
+        num_large_bins);
+    sort_buffer =
+        offset_type(view_alloc(exec, WithoutInitializing,
+                               "Kokkos::SortImpl::BinSortFunctor::sort_buffer"),
+                    range_end - range_begin);
+    Kokkos::parallel_scan(
+        "Kokkos::Sort::BinFindLargeBins",
+        Kokkos::RangePolicy<ExecutionSpace, bin_find_large_bins_tag>(
+            exec, 0, bin_op.max_bins()),
+        *this);
+
+    using policy_type =
+        Kokkos::TeamPolicy<ExecutionSpace, bin_sort_large_bins_tag>;
+    const int team_size = policy_type(exec, num_large_bins, 1)
+                              .team_size_max(*this, ParallelForTag());
+    Kokkos::parallel_for("Kokkos::Sort::BinSortLargeBins",
+                         policy_type(exec, num_large_bins, team_size), *this);
+
+    large_bins  = Kokkos::View<int*, Space>();
+    sort_buffer = offset_type();
   }
 
+ public:
+
   // Sort a subset of a view with respect to the first dimension using the
   // permutation array
   template <class ExecutionSpace, class ValuesViewType>
   void sort(const ExecutionSpace& exec, ValuesViewType const& values,
             int values_range_begin, int values_range_end) const {
-    using scratch_view_type =
-        Kokkos::View<typename ValuesViewType::data_type,
-                     typename ValuesViewType::array_layout,
-                     typename ValuesViewType::device_type>;
-
     const size_t len        = range_end - range_begin;
     const size_t values_len = values_range_end - values_range_begin;
     if (len != values_len) {
@@ -293,24 +463,9 @@ class BinSort {
           "BinSort::sort: values range length != permutation vector length");
     }
 
-    scratch_view_type sorted_values(
-        view_alloc(exec, WithoutInitializing,
-                   "Kokkos::SortImpl::BinSortFunctor::sorted_values"),
-        values.rank_dynamic > 0 ? len : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 1 ? values.extent(1)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 2 ? values.extent(2)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 3 ? values.extent(3)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 4 ? values.extent(4)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 5 ? values.extent(5)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 6 ? values.extent(6)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG,
-        values.rank_dynamic > 7 ? values.extent(7)
-                                : KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+    auto sorted_values = Impl::make_scratch_view(
+        exec, "Kokkos::SortImpl::BinSortFunctor::sorted_values", values, len);
+    using scratch_view_type = decltype(sorted_values);
 
     {
       copy_permute_functor<scratch_view_type /* DstViewType */
@@ -368,12 +523,6 @@ class BinSort {
   bin_count_type get_bin_count() const { return bin_count_const; }
 
  public:
-  KOKKOS_INLINE_FUNCTION
-  void operator()(const bin_count_tag& /*tag*/, const int i) const {
-    const int j = range_begin + i;
-    bin_count_atomic(bin_op.bin(keys, j))++;
-  }
-
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_offset_tag& /*tag*/, const int i,
                   value_type& offset, const bool& final) const {
@@ -395,7 +544,15 @@ class BinSort {
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_sort_bins_tag& /*tag*/, const int i) const {
     auto bin_size = bin_count_const(i);
-    if (bin_size <= 1) return;
+    if (bin_size <= 1 || bin_size > large_bin_size) return;
+    if (bin_size > small_bin_size) {
+      Impl::heap_sort(Kokkos::subview(sort_order,
+                                      Kokkos::make_pair(bin_offsets(i),
+                                                        bin_offsets(i) +
+                                                            bin_size)),
+                      bin_size, bin_order{keys_rnd, bin_op});
+      return;
+    }
     int upper_bound = bin_offsets(i) + bin_size;
     bool sorted     = false;
     while (!sorted) {
@@ -416,6 +573,62 @@ class BinSort {
       upper_bound--;
     }
   }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const bin_count_large_bins_tag& /*tag*/, const int i,
+                  size_type& count) const {
+    if (bin_count_const(i) > large_bin_size) ++count;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const bin_find_large_bins_tag& /*tag*/, const int i,
+                  size_type& count, const bool final) const {
+    if (bin_count_const(i) > large_bin_size) {
+      if (final) large_bins(count) = i;
+      ++count;
+    }
+  }
+
+  // Every team member heap sorts a chunk of the bin, then the chunks are
+  // merged pairwise with each member writing its share of the output
+  template <class TeamMember>
+  KOKKOS_INLINE_FUNCTION void operator()(const bin_sort_large_bins_tag& /*tag*/,
+                                         const TeamMember& team) const {
+    const int bin         = large_bins(team.league_rank());
+    const size_type begin = bin_offsets(bin);
+    const size_type size  = bin_count_const(bin);
+    const auto range      = Kokkos::make_pair(begin, begin + size);
+    const auto order      = Kokkos::subview(sort_order, range);
+    const auto buffer     = Kokkos::subview(sort_buffer, range);
+    const bin_order comp{keys_rnd, bin_op};
+
+    const size_type chunk = (size + team.team_size() - 1) / team.team_size();
+    const size_type chunk_begin =
+        team.team_rank() * chunk < size ? team.team_rank() * chunk : size;
+    const size_type chunk_end =
+        chunk_begin + chunk < size ? chunk_begin + chunk : size;
+
+    Impl::heap_sort(
+        Kokkos::subview(order, Kokkos::make_pair(chunk_begin, chunk_end)),
+        chunk_end - chunk_begin, comp);
+    team.team_barrier();
+
+    bool in_buffer = false;
+    for (size_type width = chunk; width < size; width *= 2) {
+      if (in_buffer) {
+        Impl::merge_runs(buffer, order, comp, size, width, chunk_begin,
+                         chunk_end);
+      } else {
+        Impl::merge_runs(order, buffer, comp, size, width, chunk_begin,
+                         chunk_end);
+      }
+      in_buffer = !in_buffer;
+      team.team_barrier();
+    }
+    if (in_buffer) {
+      for (size_type k = chunk_begin; k < chunk_end; ++k) order(k) = buffer(k);
+    }
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -571,6 +784,608 @@ struct min_max_functor {
   }
 };
 
+// Map arithmetic keys onto unsigned integers with the same ordering so that
+// they can be sorted digit by digit.
+template <class T, class Enable = void>
+struct radix_sort_key_traits {
+  enum : bool { is_sortable = false };
+};
+
+template <class T>
+struct radix_sort_key_traits<
+    T, std::enable_if_t<std::is_integral<T>::value &&
+                        std::is_unsigned<T>::value &&
+                        !std::is_same<T, bool>::value && sizeof(T) <= 8>> {
+  enum : bool { is_sortable = true };
+  using bits_type = T;
+
+  KOKKOS_INLINE_FUNCTION static bits_type to_bits(const T key) { return key; }
+  KOKKOS_INLINE_FUNCTION static T from_bits(const bits_type bits) {
+    return bits;
+  }
+};
+
+// Flipping the sign bit orders negative values before positive ones
+template <class T>
+struct radix_sort_key_traits<
+    T, std::enable_if_t<std::is_integral<T>::value &&
+                        std::is_signed<T>::value && sizeof(T) <= 8>> {
+  enum : bool { is_sortable = true };
+  using bits_type = std::make_unsigned_t<T>;
+
+  KOKKOS_INLINE_FUNCTION static constexpr bits_type sign_bit() {
+    return bits_type(bits_type(1) << (8 * sizeof(bits_type) - 1));
+  }
+  KOKKOS_INLINE_FUNCTION static bits_type to_bits(const T key) {
+    return bits_type(bits_type(key) ^ sign_bit());
+  }
+  KOKKOS_INLINE_FUNCTION static T from_bits(const bits_type bits) {
+    return T(bits_type(bits ^ sign_bit()));
+  }
+};
+
+// For IEEE floating point keys all bits of negative values are flipped and
+// only the sign bit of positive ones
+template <class T>
+struct radix_sort_key_traits<
+    T, std::enable_if_t<std::is_floating_point<T>::value &&
+                        std::numeric_limits<T>::is_iec559 &&
+                        (sizeof(T) == 4 || sizeof(T) == 8)>> {
+  enum : bool { is_sortable = true };
+  using bits_type = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+  KOKKOS_INLINE_FUNCTION static constexpr bits_type sign_bit() {
+    return bits_type(1) << (8 * sizeof(bits_type) - 1);
+  }
+  KOKKOS_INLINE_FUNCTION static bits_type to_bits(const T key) {
+    bits_type bits;
+    memcpy(&bits, &key, sizeof(T));
+    return bits ^ ((bits & sign_bit()) ? ~bits_type(0) : sign_bit());
+  }
+  KOKKOS_INLINE_FUNCTION static T from_bits(bits_type bits) {
+    bits ^= (bits & sign_bit()) ? sign_bit() : ~bits_type(0);
+    T key;
+    memcpy(&key, &bits, sizeof(T));
+    return key;
+  }
+};
+
+// Least significant digit radix sort of a rank 1 View of arithmetic keys.
+//
+// The keys are split into contiguous blocks, at most one per unit of
+// concurrency. Every pass counts the current digit per block, scans the
+// counts digit-major into the write offset of every (digit, block) pair and
+// scatters each block in order, which keeps the sort stable. Digits which are
+// the same for all keys are skipped. On request the original index of every
+// key is carried along, giving the permutation applied to the keys.
+template <class ExecutionSpace, class ViewType>
+class RadixSort {
+ public:
+  using key_type     = typename ViewType::non_const_value_type;
+  using key_traits   = radix_sort_key_traits<key_type>;
+  using bits_type    = typename key_traits::bits_type;
+  using memory_space = typename ViewType::memory_space;
+  using size_type    = size_t;
+
+  using bits_view_type        = Kokkos::View<bits_type*, memory_space>;
+  using count_view_type       = Kokkos::View<size_type**, memory_space>;
+  using permutation_view_type = Kokkos::View<size_type*, memory_space>;
+
+  enum : int { radix_bits = 8, radix = 1 << radix_bits };
+  enum : int { num_passes = sizeof(bits_type) };
+
+  // Smallest number of keys per block, to amortize the per block counts
+  enum : size_type { min_block_size = 4096 };
+
+  struct from_bits_tag {};
+  struct count_tag {};
+  struct scatter_tag {};
+
+  // Converts the keys and finds the bits set in any and in all of them
+  struct to_bits_functor {
+    struct value_type {
+      bits_type any_set;
+      bits_type all_set;
+    };
+
+    ViewType keys;
+    bits_view_type bits;
+    permutation_view_type permutation;
+
+    KOKKOS_INLINE_FUNCTION
+    void init(value_type& dst) const {
+      dst.any_set = 0;
+      dst.all_set = ~bits_type(0);
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void join(volatile value_type& dst, const volatile value_type& src) const {
+      dst.any_set |= src.any_set;
+      dst.all_set &= src.all_set;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type i, value_type& dst) const {
+      const bits_type b = key_traits::to_bits(keys(i));
+      bits(i)           = b;
+      if (permutation.extent(0) != 0) permutation(i) = i;
+      dst.any_set |= b;
+      dst.all_set &= b;
+    }
+  };
+
+  // Exclusive scan of the counts over (digit, block) pairs, digit-major
+  struct offset_functor {
+    using value_type = size_type;
+
+    count_view_type counts;
+    count_view_type offsets;
+    size_type num_blocks;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type k, size_type& update,
+                    const bool final) const {
+      const size_type digit = k / num_blocks;
+      const size_type block = k % num_blocks;
+      if (final) offsets(block, digit) = update;
+      update += counts(block, digit);
+    }
+  };
+
+ private:
+  ViewType m_keys;
+  bits_view_type m_src;
+  bits_view_type m_dst;
+  permutation_view_type m_perm_src;
+  permutation_view_type m_perm_dst;
+  count_view_type m_counts;
+  count_view_type m_offsets;
+  size_type m_size;
+  size_type m_num_blocks;
+  size_type m_block_size;
+  int m_shift;
+
+ public:
+  RadixSort(const ExecutionSpace& exec, const ViewType& keys,
+            const bool with_permutation = false)
+      : m_keys(keys), m_size(keys.extent(0)), m_shift(0) {
+    const size_type max_blocks =
+        (m_size + size_type(min_block_size) - 1) / size_type(min_block_size);
+    m_num_blocks = std::max<size_type>(
+        1, std::min<size_type>(max_blocks, ExecutionSpace::concurrency()));
+    m_block_size = (m_size + m_num_blocks - 1) / m_num_blocks;
+
+    m_src = bits_view_type(
+        view_alloc(exec, WithoutInitializing, "Kokkos::RadixSort::bits"),
+        m_size);
+    m_dst = bits_view_type(
+        view_alloc(exec, WithoutInitializing, "Kokkos::RadixSort::buffer"),
+        m_size);
+    m_counts = count_view_type(
+        view_alloc(exec, WithoutInitializing, "Kokkos::RadixSort::counts"),
+        m_num_blocks, int(radix));
+    m_offsets = count_view_type(
+        view_alloc(exec, WithoutInitializing, "Kokkos::RadixSort::offsets"),
+        m_num_blocks, int(radix));
+
+    if (with_permutation) {
+      m_perm_src = permutation_view_type(
+          view_alloc(exec, WithoutInitializing,
+                     "Kokkos::RadixSort::permutation"),
+          m_size);
+      m_perm_dst = permutation_view_type(
+          view_alloc(exec, WithoutInitializing,
+                     "Kokkos::RadixSort::permutation_buffer"),
+          m_size);
+    }
+  }
+
+  // After sort() the key now at position i came from position permutation(i)
+  permutation_view_type get_permute_vector() const { return m_perm_src; }
+
+  void sort(const ExecutionSpace& exec) {
+    typename to_bits_functor::value_type range;
+    Kokkos::parallel_reduce(
+        "Kokkos::RadixSort::ToBits",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, m_size),
+        to_bits_functor{m_keys, m_src, m_perm_src}, range);
+    const bits_type varying = range.any_set & ~range.all_set;
+    if (varying == 0) return;
+
+    for (int pass = 0; pass < int(num_passes); ++pass) {
+      m_shift = pass * int(radix_bits);
+      if (((varying >> m_shift) & bits_type(radix - 1)) == 0) continue;
+
+      Kokkos::parallel_for(
+          "Kokkos::RadixSort::Count",
+          Kokkos::RangePolicy<ExecutionSpace, count_tag>(exec, 0,
+                                                         m_num_blocks),
+          *this);
+      Kokkos::parallel_scan(
+          "Kokkos::RadixSort::Offsets",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, m_num_blocks * radix),
+          offset_functor{m_counts, m_offsets, m_num_blocks});
+      Kokkos::parallel_for(
+          "Kokkos::RadixSort::Scatter",
+          Kokkos::RangePolicy<ExecutionSpace, scatter_tag>(exec, 0,
+                                                           m_num_blocks),
+          *this);
+      std::swap(m_src, m_dst);
+      std::swap(m_perm_src, m_perm_dst);
+    }
+
+    Kokkos::parallel_for(
+        "Kokkos::RadixSort::FromBits",
+        Kokkos::RangePolicy<ExecutionSpace, from_bits_tag>(exec, 0, m_size),
+        *this);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const from_bits_tag&, const size_type i) const {
+    m_keys(i) = key_traits::from_bits(m_src(i));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const count_tag&, const size_type block) const {
+    size_type count[radix];
+    for (int d = 0; d < radix; ++d) count[d] = 0;
+
+    const size_type begin = block * m_block_size;
+    const size_type end =
+        begin + m_block_size < m_size ? begin + m_block_size : m_size;
+    for (size_type i = begin; i < end; ++i) {
+      ++count[(m_src(i) >> m_shift) & bits_type(radix - 1)];
+    }
+    for (int d = 0; d < radix; ++d) m_counts(block, d) = count[d];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const scatter_tag&, const size_type block) const {
+    size_type offset[radix];
+    for (int d = 0; d < radix; ++d) offset[d] = m_offsets(block, d);
+
+    const size_type begin = block * m_block_size;
+    const size_type end =
+        begin + m_block_size < m_size ? begin + m_block_size : m_size;
+    if (m_perm_src.extent(0) == 0) {
+      for (size_type i = begin; i < end; ++i) {
+        const bits_type bits = m_src(i);
+        m_dst(offset[(bits >> m_shift) & bits_type(radix - 1)]++) = bits;
+      }
+    } else {
+      for (size_type i = begin; i < end; ++i) {
+        const bits_type bits = m_src(i);
+        const size_type j = offset[(bits >> m_shift) & bits_type(radix - 1)]++;
+        m_dst(j)          = bits;
+        m_perm_dst(j)     = m_perm_src(i);
+      }
+    }
+  }
+};
+
+// Below this many keys the passes over the counts dominate
+constexpr size_t radix_sort_min_size = 1 << 14;
+
+template <class ViewType, class ExecutionSpace>
+bool try_radix_sort(std::false_type, const ViewType&, const ExecutionSpace&) {
+  return false;
+}
+
+template <class ViewType, class ExecutionSpace>
+bool try_radix_sort(std::true_type, const ViewType& view,
+                    const ExecutionSpace& exec) {
+  if (view.extent(0) < radix_sort_min_size) return false;
+  RadixSort<ExecutionSpace, ViewType> radix_sort(exec, view);
+  radix_sort.sort(exec);
+  return true;
+}
+
+// Sorts with RadixSort if the keys are arithmetic and there are enough of
+// them. Only host execution spaces take this path, devices keep BinSort.
+template <class ViewType, class ExecutionSpace>
+bool try_radix_sort(const ViewType& view, const ExecutionSpace& exec) {
+  using key_type     = typename ViewType::non_const_value_type;
+  using memory_space = typename ViewType::memory_space;
+  using possible     = std::integral_constant<
+      bool, ViewType::Rank == 1 &&
+                radix_sort_key_traits<key_type>::is_sortable &&
+                SpaceAccessibility<ExecutionSpace, memory_space>::accessible &&
+                SpaceAccessibility<
+                    HostSpace,
+                    typename ExecutionSpace::memory_space>::accessible>;
+  return try_radix_sort(possible{}, view, exec);
+}
+
+// Stable merge sort of the n elements values[0], ..., values[n - 1] ordered
+// by comp.
+//
+// Short runs are sorted by insertion first. Every following pass merges
+// pairs of neighbouring runs, ping-ponging between values and a buffer. The
+// output of a pass is split into equal chunks merged independently, so that
+// the work of a pass is balanced even when only a few long runs are left.
+template <class ExecutionSpace, class ValuesType, class ComparatorType>
+class MergeSort {
+ public:
+  using value_type = std::remove_cv_t<
+      std::remove_reference_t<decltype(std::declval<ValuesType>()[0])>>;
+  using buffer_type =
+      Kokkos::View<value_type*, typename ExecutionSpace::memory_space>;
+  using size_type = size_t;
+
+  // Length of the runs sorted by insertion
+  enum : size_type { run_size = 16 };
+
+  // Smallest number of elements merged by one chunk
+  enum : size_type { min_chunk_size = 256 };
+
+  struct run_functor {
+    ValuesType values;
+    ComparatorType comp;
+    size_type size;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type run) const {
+      const size_type begin = run * size_type(run_size);
+      const size_type end =
+          begin + run_size < size ? begin + size_type(run_size) : size;
+      for (size_type i = begin + 1; i < end; ++i) {
+        value_type tmp = values[i];
+        size_type j    = i;
+        for (; j > begin && comp(tmp, values[j - 1]); --j) {
+          values[j] = values[j - 1];
+        }
+        values[j] = tmp;
+      }
+    }
+  };
+
+  template <class SrcType, class DstType>
+  struct merge_functor {
+    SrcType src;
+    DstType dst;
+    ComparatorType comp;
+    size_type size;
+    size_type width;
+    size_type chunk_size;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const size_type chunk) const {
+      const size_type begin = chunk * chunk_size;
+      const size_type end =
+          begin + chunk_size < size ? begin + chunk_size : size;
+      merge_runs(src, dst, comp, size, width, begin, end);
+    }
+  };
+
+ private:
+  ValuesType m_values;
+  ComparatorType m_comp;
+  size_type m_size;
+
+ public:
+  MergeSort(const ValuesType& values, const size_type size,
+            const ComparatorType& comp)
+      : m_values(values), m_comp(comp), m_size(size) {}
+
+  void sort(const ExecutionSpace& exec, const std::string& label) {
+    if (m_size <= 1) return;
+
+    const size_type num_runs =
+        (m_size + size_type(run_size) - 1) / size_type(run_size);
+    Kokkos::parallel_for(label + "::Runs",
+                         Kokkos::RangePolicy<ExecutionSpace>(exec, 0, num_runs),
+                         run_functor{m_values, m_comp, m_size});
+    if (num_runs == 1) return;
+
+    const size_type concurrency = exec.concurrency();
+    const size_type chunk_size  = std::max<size_type>(
+        min_chunk_size, (m_size + concurrency - 1) / concurrency);
+    const size_type num_chunks = (m_size + chunk_size - 1) / chunk_size;
+    const Kokkos::RangePolicy<ExecutionSpace> policy(exec, 0, num_chunks);
+
+    // every merge pass writes all the elements of its destination
+    buffer_type buffer(
+        view_alloc(exec, WithoutInitializing, label + "::Buffer"), m_size);
+    bool in_buffer = false;
+    for (size_type width = run_size; width < m_size; width *= 2) {
+      if (in_buffer) {
+        Kokkos::parallel_for(label + "::Merge", policy,
+                             merge_functor<buffer_type, ValuesType>{
+                                 buffer, m_values, m_comp, m_size, width,
+                                 chunk_size});
+      } else {
+        Kokkos::parallel_for(label + "::Merge", policy,
+                             merge_functor<ValuesType, buffer_type>{
+                                 m_values, buffer, m_comp, m_size, width,
+                                 chunk_size});
+      }
+      in_buffer = !in_buffer;
+    }
+
+    // A single run spanning all elements is copied unchanged
+    if (in_buffer) {
+      Kokkos::parallel_for(label + "::Copy", policy,
+                           merge_functor<buffer_type, ValuesType>{
+                               buffer, m_values, m_comp, m_size, m_size,
+                               chunk_size});
+    }
+  }
+};
+
+template <class ExecutionSpace, class ValuesType, class ComparatorType>
+void merge_sort(const std::string& label, const ExecutionSpace& exec,
+                const ValuesType& values, const size_t size,
+                const ComparatorType& comp) {
+  MergeSort<ExecutionSpace, ValuesType, ComparatorType> merge_sort(values,
+                                                                   size, comp);
+  merge_sort.sort(exec, label);
+}
+
+// Gathers values(permutation(i)) into a scratch View for each of several
+// value Views, and copies the scratch Views back, one index at a time so
+// that all Views move in the same kernel.
+template <class... ValuesTypes>
+struct PermuteValues;
+
+template <>
+struct PermuteValues<> {
+  template <class ExecutionSpace>
+  PermuteValues(const ExecutionSpace&, const size_t) {}
+
+  template <class PermutationType>
+  KOKKOS_INLINE_FUNCTION void gather(const PermutationType&,
+                                     const size_t) const {}
+  KOKKOS_INLINE_FUNCTION void copy_back(const size_t) const {}
+};
+
+template <class ValuesType, class... Rest>
+struct PermuteValues<ValuesType, Rest...> {
+  using scratch_type = Kokkos::View<typename ValuesType::non_const_data_type,
+                                    typename ValuesType::array_layout,
+                                    typename ValuesType::device_type>;
+
+  ValuesType values;
+  scratch_type scratch;
+  PermuteValues<Rest...> rest;
+
+  template <class ExecutionSpace>
+  PermuteValues(const ExecutionSpace& exec, const size_t len,
+                const ValuesType& values_, const Rest&... rest_)
+      : values(values_),
+        scratch(make_scratch_view(exec, "Kokkos::SortByKey::scratch", values_,
+                                  len)),
+        rest(exec, len, rest_...) {}
+
+  template <class PermutationType>
+  KOKKOS_INLINE_FUNCTION void gather(const PermutationType& permutation,
+                                     const size_t i) const {
+    CopyOp<scratch_type, ValuesType>::copy(scratch, i, values, permutation(i));
+    rest.gather(permutation, i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void copy_back(const size_t i) const {
+    CopyOp<ValuesType, scratch_type>::copy(values, i, scratch, i);
+    rest.copy_back(i);
+  }
+};
+
+template <class PermutationType, class... ValuesTypes>
+struct apply_permutation_functor {
+  struct gather_tag {};
+  struct copy_back_tag {};
+
+  PermutationType permutation;
+  PermuteValues<ValuesTypes...> values;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const gather_tag&, const size_t i) const {
+    values.gather(permutation, i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const copy_back_tag&, const size_t i) const {
+    values.copy_back(i);
+  }
+};
+
+inline void check_permutation_extents(const size_t) {}
+
+template <class ValuesType, class... Rest>
+void check_permutation_extents(const size_t len, const ValuesType& values,
+                               const Rest&... rest) {
+  if (values.extent(0) != len) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::sort_by_key: the extent of a View of values differs from the "
+        "number of keys");
+  }
+  check_permutation_extents(len, rest...);
+}
+
+template <class ExecutionSpace, class PermutationType, class... ValuesTypes>
+void apply_permutation(const ExecutionSpace& exec,
+                       const PermutationType& permutation,
+                       const ValuesTypes&... values) {
+  using functor_type =
+      apply_permutation_functor<PermutationType, ValuesTypes...>;
+  using gather_tag    = typename functor_type::gather_tag;
+  using copy_back_tag = typename functor_type::copy_back_tag;
+
+  const size_t len = permutation.extent(0);
+  check_permutation_extents(len, values...);
+  if (sizeof...(ValuesTypes) == 0) return;
+
+  functor_type functor{permutation, {exec, len, values...}};
+  Kokkos::parallel_for(
+      "Kokkos::Sort::PermuteGather",
+      Kokkos::RangePolicy<ExecutionSpace, gather_tag>(exec, 0, len), functor);
+  Kokkos::parallel_for(
+      "Kokkos::Sort::PermuteCopyBack",
+      Kokkos::RangePolicy<ExecutionSpace, copy_back_tag>(exec, 0, len),
+      functor);
+}
+
+// Orders indices by the keys at those indices
+template <class KeysType>
+struct key_index_less {
+  KeysType keys;
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const size_t a, const size_t b) const {
+    return keys(a) < keys(b);
+  }
+};
+
+template <class KeysType>
+struct iota_functor {
+  Kokkos::View<size_t*, typename KeysType::memory_space> permutation;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const { permutation(i) = i; }
+};
+
+// Stable sort of the keys returning the permutation that was applied
+template <class ExecutionSpace, class KeysType>
+Kokkos::View<size_t*, typename KeysType::memory_space> sort_permutation(
+    std::false_type, const ExecutionSpace& exec, const KeysType& keys) {
+  const size_t len = keys.extent(0);
+  Kokkos::View<size_t*, typename KeysType::memory_space> permutation(
+      view_alloc(exec, WithoutInitializing, "Kokkos::SortByKey::permutation"),
+      len);
+  Kokkos::parallel_for("Kokkos::Sort::Iota",
+                       Kokkos::RangePolicy<ExecutionSpace>(exec, 0, len),
+                       iota_functor<KeysType>{permutation});
+  merge_sort("Kokkos::Sort::MergeSortByKey", exec, permutation, len,
+             key_index_less<KeysType>{keys});
+  Kokkos::Impl::apply_permutation(exec, permutation, keys);
+  return permutation;
+}
+
+template <class ExecutionSpace, class KeysType>
+Kokkos::View<size_t*, typename KeysType::memory_space> sort_permutation(
+    std::true_type, const ExecutionSpace& exec, const KeysType& keys) {
+  if (keys.extent(0) < radix_sort_min_size) {
+    return sort_permutation(std::false_type{}, exec, keys);
+  }
+  RadixSort<ExecutionSpace, KeysType> radix_sort(exec, keys, true);
+  radix_sort.sort(exec);
+  return radix_sort.get_permute_vector();
+}
+
+template <class ExecutionSpace, class KeysType>
+Kokkos::View<size_t*, typename KeysType::memory_space> sort_permutation(
+    const ExecutionSpace& exec, const KeysType& keys) {
+  using key_type     = typename KeysType::non_const_value_type;
+  using memory_space = typename KeysType::memory_space;
+  // as in try_radix_sort, only host execution spaces use RadixSort
+  using use_radix = std::integral_constant<
+      bool, radix_sort_key_traits<key_type>::is_sortable &&
+                SpaceAccessibility<ExecutionSpace, memory_space>::accessible &&
+                SpaceAccessibility<
+                    HostSpace,
+                    typename ExecutionSpace::memory_space>::accessible>;
+  return sort_permutation(use_radix{}, exec, keys);
+}
+
 }  // namespace Impl
 
 template <class ExecutionSpace, class ViewType>
@@ -578,6 +1393,7 @@ std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value> sort(
     const ExecutionSpace& exec, ViewType const& view,
     bool const always_use_kokkos_sort = false) {
   if (!always_use_kokkos_sort) {
+    if (Impl::try_radix_sort(view, exec)) return;
     if (Impl::try_std_sort(view, exec)) return;
   }
   using CompType = BinOp1D<ViewType>;
@@ -650,6 +1466,63 @@ void sort(ViewType view, size_t const begin, size_t const end) {
   exec.fence("Kokkos::Sort: fence after sorting");
 }
 
+template <class ExecutionSpace, class ViewType, class ComparatorType>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value> sort(
+    const ExecutionSpace& exec, ViewType const& view,
+    ComparatorType const& comp) {
+  static_assert(ViewType::Rank == 1,
+                "Kokkos::sort with a comparator requires a rank 1 View");
+  Impl::merge_sort("Kokkos::Sort::MergeSort", exec, view, view.extent(0),
+                   comp);
+}
+
+template <class ViewType, class ComparatorType>
+std::enable_if_t<Kokkos::is_view<ViewType>::value> sort(
+    ViewType const& view, ComparatorType const& comp) {
+  typename ViewType::execution_space exec;
+  sort(exec, view, comp);
+  exec.fence("Kokkos::Sort: fence after sorting");
+}
+
+// Sorts keys stably and reorders every View of values the same way along
+// their first dimension. All value Views move in one pass over the data.
+// Returns the permutation, the entry now at position i came from position
+// permutation(i), so that it can be applied to more Views later with
+// apply_permutation.
+template <class ExecutionSpace, class KeysType, class... ValuesTypes>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value,
+                 Kokkos::View<size_t*, typename KeysType::memory_space>>
+sort_by_key(const ExecutionSpace& exec, const KeysType& keys,
+            const ValuesTypes&... values) {
+  static_assert(KeysType::Rank == 1,
+                "Kokkos::sort_by_key requires a rank 1 View of keys");
+  Impl::check_permutation_extents(keys.extent(0), values...);
+
+  auto permutation = Impl::sort_permutation(exec, keys);
+  Impl::apply_permutation(exec, permutation, values...);
+  return permutation;
+}
+
+template <class KeysType, class... ValuesTypes>
+std::enable_if_t<Kokkos::is_view<KeysType>::value,
+                 Kokkos::View<size_t*, typename KeysType::memory_space>>
+sort_by_key(const KeysType& keys, const ValuesTypes&... values) {
+  typename KeysType::execution_space exec;
+  auto permutation = sort_by_key(exec, keys, values...);
+  exec.fence("Kokkos::Sort: fence after sorting");
+  return permutation;
+}
+
+// Reorders the Views of values along their first dimension such that the
+// entry now at position i came from position permutation(i)
+template <class ExecutionSpace, class PermutationType, class... ValuesTypes>
+std::enable_if_t<Kokkos::is_execution_space<ExecutionSpace>::value>
+apply_permutation(const ExecutionSpace& exec,
+                  const PermutationType& permutation,
+                  const ValuesTypes&... values) {
+  Impl::apply_permutation(exec, permutation, values...);
+}
+
 }  // namespace Kokkos
 
 #endif
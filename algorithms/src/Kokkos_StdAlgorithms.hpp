@@ -55,6 +55,10 @@
 // distance
 #include <std_algorithms/Kokkos_Distance.hpp>
 
+// views::transform, views::replace_if_not, views::zip, views::iota,
+// views::stride
+#include <std_algorithms/Kokkos_RangeAdaptors.hpp>
+
 // move, swap, iter_swap
 #include "std_algorithms/Kokkos_ModifyingOperations.hpp"
 
@@ -84,19 +88,29 @@
 // shift_left, shift_right
 #include <std_algorithms/Kokkos_ModifyingSequenceOperations.hpp>
 
-// is_sorted_until, is_sorted
+// is_sorted_until, is_sorted, sort, nth_element, partial_sort
 #include <std_algorithms/Kokkos_SortingOperations.hpp>
 
 // min_element, max_element, minmax_element
 #include <std_algorithms/Kokkos_MinMaxElementOperations.hpp>
 
 // is_partitioned, partition_copy, partition_point
+// partition, stable_partition
 #include <std_algorithms/Kokkos_PartitioningOperations.hpp>
 
+// lower_bound, upper_bound, equal_range
+// batched_lower_bound, batched_upper_bound
+#include <std_algorithms/Kokkos_BinarySearchOperations.hpp>
+
+// merge, inplace_merge
+// set_union, set_intersection, set_difference
+#include <std_algorithms/Kokkos_MergeAndSetOperations.hpp>
+
 // adjacent_difference
 // reduce, transform_reduce
 // exclusive_scan, transform_exclusive_scan
 // inclusive_scan, transform_inclusive_scan
+// inclusive_scan_by_key, exclusive_scan_by_key, reduce_by_key
 #include <std_algorithms/Kokkos_Numeric.hpp>
 
 #endif
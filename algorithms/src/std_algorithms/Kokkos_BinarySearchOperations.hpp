@@ -0,0 +1,917 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_BINARY_SEARCH_OPERATIONS_HPP
+#define KOKKOS_STD_BINARY_SEARCH_OPERATIONS_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_BeginEnd.hpp"
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_Distance.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+// Selects interpolation search in batched_lower_bound and
+// batched_upper_bound, which beats binary search on haystacks of
+// arithmetic values spread close to uniformly
+struct InterpolationSearch {};
+
+namespace Impl {
+
+// ------------------
+//
+// helpers
+//
+// ------------------
+
+// true for the elements before the lower bound of m_value
+template <class ValueType, class ComparatorType>
+struct StdLowerBoundPredicate {
+  ValueType m_value;
+  ComparatorType m_comp;
+
+  template <class T>
+  KOKKOS_FUNCTION bool operator()(const T& element) const {
+    return m_comp(element, m_value);
+  }
+};
+
+// true for the elements before the upper bound of m_value
+template <class ValueType, class ComparatorType>
+struct StdUpperBoundPredicate {
+  ValueType m_value;
+  ComparatorType m_comp;
+
+  template <class T>
+  KOKKOS_FUNCTION bool operator()(const T& element) const {
+    return !m_comp(m_value, element);
+  }
+};
+
+// Returns the first index in [begin, end) for which pred is false, or
+// end, assuming pred is true for a prefix of the range only.
+// The loop always runs log2(end - begin) halvings and picks the next base
+// with a select instead of a branch, so that the threads of a warp or the
+// lanes of a vector stay converged.
+template <class IteratorType, class IndexType, class PredicateType>
+KOKKOS_FUNCTION IndexType partition_point_index(const IteratorType& first,
+                                                IndexType begin, IndexType end,
+                                                const PredicateType& pred) {
+  if (begin == end) return begin;
+  IndexType base = begin;
+  IndexType len  = end - begin;
+  while (len > 1) {
+    const IndexType half = len / 2;
+    base                 = pred(first[base + half]) ? base + half : base;
+    len -= half;
+  }
+  return pred(first[base]) ? base + 1 : base;
+}
+
+template <class IteratorType, class IndexType, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION IndexType lower_bound_index(const IteratorType& first,
+                                            IndexType begin, IndexType end,
+                                            const ValueType& value,
+                                            const ComparatorType& comp) {
+  return partition_point_index(
+      first, begin, end,
+      StdLowerBoundPredicate<ValueType, ComparatorType>{value, comp});
+}
+
+template <class IteratorType, class IndexType, class ValueType,
+          class ComparatorType>
+KOKKOS_FUNCTION IndexType upper_bound_index(const IteratorType& first,
+                                            IndexType begin, IndexType end,
+                                            const ValueType& value,
+                                            const ComparatorType& comp) {
+  return partition_point_index(
+      first, begin, end,
+      StdUpperBoundPredicate<ValueType, ComparatorType>{value, comp});
+}
+
+// ------------------
+//
+// functors
+//
+// ------------------
+
+template <class IteratorType, class ValueType, class ComparatorType,
+          bool IsUpperBound>
+struct StdBoundFunctor {
+  using index_type = typename IteratorType::difference_type;
+
+  IteratorType m_first;
+  index_type m_num_elements;
+  ValueType m_value;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type /*i*/, index_type& result) const {
+    result = IsUpperBound ? upper_bound_index(m_first, index_type(0),
+                                              m_num_elements, m_value, m_comp)
+                          : lower_bound_index(m_first, index_type(0),
+                                              m_num_elements, m_value, m_comp);
+  }
+
+  KOKKOS_FUNCTION
+  StdBoundFunctor(IteratorType first, index_type num_elements,
+                  ValueType value, ComparatorType comp)
+      : m_first(std::move(first)),
+        m_num_elements(num_elements),
+        m_value(std::move(value)),
+        m_comp(std::move(comp)) {}
+};
+
+// Every team copies every stride-th element of the haystack to scratch,
+// searches each of its needles among those samples first and finishes in
+// the one stride of the haystack the samples leave, so the upper levels of
+// every search hit scratch instead of global memory.
+template <class ExecutionSpace, class HaystackIteratorType,
+          class NeedlesIteratorType, class IndicesIteratorType,
+          class ComparatorType, bool IsUpperBound>
+struct StdBatchedSearchFunctor {
+  using index_type = typename HaystackIteratorType::difference_type;
+  using value_type =
+      std::remove_cv_t<typename HaystackIteratorType::value_type>;
+  using needle_type =
+      std::remove_cv_t<typename NeedlesIteratorType::value_type>;
+  using samples_type =
+      Kokkos::View<value_type*, typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryUnmanaged>;
+  using predicate_type =
+      std::conditional_t<IsUpperBound,
+                         StdUpperBoundPredicate<needle_type, ComparatorType>,
+                         StdLowerBoundPredicate<needle_type, ComparatorType>>;
+
+  HaystackIteratorType m_haystack;
+  index_type m_num_elements;
+  NeedlesIteratorType m_needles;
+  index_type m_num_needles;
+  IndicesIteratorType m_indices;
+  ComparatorType m_comp;
+  index_type m_stride;
+  index_type m_num_samples;
+  index_type m_needles_per_team;
+
+  template <class TeamMember>
+  KOKKOS_FUNCTION void operator()(const TeamMember& member) const {
+    const samples_type samples(member.team_scratch(0), m_num_samples);
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, m_num_samples),
+        [&](const index_type k) { samples(k) = m_haystack[k * m_stride]; });
+    member.team_barrier();
+
+    const index_type begin = member.league_rank() * m_needles_per_team;
+    const index_type end   = begin + m_needles_per_team < m_num_needles
+                               ? begin + m_needles_per_team
+                               : m_num_needles;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(member, begin, end), [&](const index_type i) {
+          const predicate_type pred{m_needles[i], m_comp};
+          const index_type s = partition_point_index(
+              samples, index_type(0), m_num_samples, pred);
+          const index_type lo = s > 0 ? (s - 1) * m_stride + 1 : 0;
+          const index_type hi =
+              s < m_num_samples ? s * m_stride : m_num_elements;
+          m_indices[i] = partition_point_index(m_haystack, lo, hi, pred);
+        });
+  }
+};
+
+// Interpolation search, narrowing [lo, hi) by guessing the position of the
+// needle from the values at both ends, and falling back to binary search
+// once the range is small or after as many guesses as a binary search
+// would take
+template <class HaystackIteratorType, class NeedlesIteratorType,
+          class IndicesIteratorType, bool IsUpperBound>
+struct StdInterpolationSearchFunctor {
+  using index_type = typename HaystackIteratorType::difference_type;
+  using value_type =
+      std::remove_cv_t<typename HaystackIteratorType::value_type>;
+  using needle_type =
+      std::remove_cv_t<typename NeedlesIteratorType::value_type>;
+  using comparator_type = StdAlgoLessThanBinaryPredicate<value_type>;
+  using predicate_type =
+      std::conditional_t<IsUpperBound,
+                         StdUpperBoundPredicate<needle_type, comparator_type>,
+                         StdLowerBoundPredicate<needle_type, comparator_type>>;
+
+  static_assert(std::is_arithmetic<value_type>::value &&
+                    std::is_arithmetic<needle_type>::value,
+                "Kokkos: interpolation search requires arithmetic values");
+
+  HaystackIteratorType m_haystack;
+  index_type m_num_elements;
+  NeedlesIteratorType m_needles;
+  IndicesIteratorType m_indices;
+  int m_max_guesses;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type i) const {
+    const needle_type needle = m_needles[i];
+    const predicate_type pred{needle, comparator_type()};
+
+    index_type lo = 0;
+    index_type hi = m_num_elements;
+    for (int guess = 0; guess < m_max_guesses && hi - lo > 8; ++guess) {
+      const value_type front = m_haystack[lo];
+      const value_type back  = m_haystack[hi - 1];
+      if (!pred(front)) {
+        hi = lo;
+        break;
+      }
+      if (pred(back)) {
+        lo = hi;
+        break;
+      }
+      // front < needle <= back, or front <= needle < back for the upper
+      // bound, so back > front and the answer lies in (lo, hi - 1]
+      const double fraction =
+          (double(needle) - double(front)) / (double(back) - double(front));
+      index_type pos = lo + 1 + index_type(fraction * double(hi - 2 - lo));
+      pos            = pos < lo + 1 ? lo + 1 : pos > hi - 1 ? hi - 1 : pos;
+      if (pred(m_haystack[pos])) {
+        lo = pos + 1;
+      } else {
+        hi  = pos;
+        lo += 1;
+      }
+    }
+    m_indices[i] = partition_point_index(m_haystack, lo, hi, pred);
+  }
+};
+
+// ------------------------------------------
+// lower_bound_impl, upper_bound_impl
+// ------------------------------------------
+template <bool IsUpperBound, class ExecutionSpace, class IteratorType,
+          class ValueType, class ComparatorType>
+IteratorType bound_impl(const std::string& label, const ExecutionSpace& ex,
+                        IteratorType first, IteratorType last,
+                        const ValueType& value, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return first;
+  }
+
+  // aliases
+  using index_type = typename IteratorType::difference_type;
+  using func_t =
+      StdBoundFunctor<IteratorType, ValueType, ComparatorType, IsUpperBound>;
+
+  // run a single search, in the execution space since the range may not
+  // be accessible from the host
+  index_type result       = 0;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(label, RangePolicy<ExecutionSpace>(ex, 0, 1),
+                            func_t(first, num_elements, value, std::move(comp)),
+                            result);
+
+  // fence not needed because reducing into scalar
+  return first + result;
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType lower_bound_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, const ValueType& value,
+                              ComparatorType comp) {
+  return bound_impl<false>(label, ex, first, last, value, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType lower_bound_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, const ValueType& value) {
+  using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type, ValueType>;
+  return bound_impl<false>(label, ex, first, last, value, pred_t());
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType upper_bound_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, const ValueType& value,
+                              ComparatorType comp) {
+  return bound_impl<true>(label, ex, first, last, value, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType upper_bound_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, const ValueType& value) {
+  using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<ValueType, value_type>;
+  return bound_impl<true>(label, ex, first, last, value, pred_t());
+}
+
+// ------------------------------------------
+// equal_range_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value, ComparatorType comp) {
+  auto range_first = bound_impl<false>(label, ex, first, last, value, comp);
+  auto range_last  = bound_impl<true>(label, ex, range_first, last, value,
+                                     std::move(comp));
+  return {range_first, range_last};
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value) {
+  using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  return equal_range_impl(label, ex, first, last, value, pred_t());
+}
+
+// ------------------------------------------
+// batched_search_impl
+// ------------------------------------------
+template <bool IsUpperBound, class ExecutionSpace, class HaystackIteratorType,
+          class NeedlesIteratorType, class IndicesIteratorType,
+          class ComparatorType>
+void batched_search_impl(const std::string& label, const ExecutionSpace& ex,
+                         HaystackIteratorType first, HaystackIteratorType last,
+                         NeedlesIteratorType needles_first,
+                         NeedlesIteratorType needles_last,
+                         IndicesIteratorType indices_first,
+                         ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first, needles_first,
+                                                   indices_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(needles_first, needles_last);
+
+  // aliases
+  using func_t =
+      StdBatchedSearchFunctor<ExecutionSpace, HaystackIteratorType,
+                              NeedlesIteratorType, IndicesIteratorType,
+                              ComparatorType, IsUpperBound>;
+  using index_type  = typename func_t::index_type;
+  using policy_type = TeamPolicy<ExecutionSpace>;
+
+  const index_type num_needles =
+      Kokkos::Experimental::distance(needles_first, needles_last);
+  if (num_needles == 0) {
+    return;
+  }
+
+  // at most max_samples samples, which bounds the scratch per team, and
+  // enough needles per team that loading them is cheap in comparison
+  constexpr index_type max_samples = 1024;
+  const index_type num_elements = Kokkos::Experimental::distance(first, last);
+  const index_type stride =
+      num_elements > max_samples
+          ? (num_elements + max_samples - 1) / max_samples
+          : 1;
+  const index_type num_samples      = (num_elements + stride - 1) / stride;
+  const index_type needles_per_team = 8 * max_samples;
+  const index_type num_teams =
+      (num_needles + needles_per_team - 1) / needles_per_team;
+
+  func_t functor{first,         num_elements,   needles_first,
+                 num_needles,   indices_first,  std::move(comp),
+                 stride,        num_samples,    needles_per_team};
+  policy_type policy(ex, num_teams, Kokkos::AUTO);
+  policy.set_scratch_size(
+      0, Kokkos::PerTeam(func_t::samples_type::shmem_size(num_samples)));
+  ::Kokkos::parallel_for(label, policy, functor);
+  ex.fence("Kokkos::batched_search: fence after operation");
+}
+
+template <bool IsUpperBound, class ExecutionSpace, class HaystackIteratorType,
+          class NeedlesIteratorType, class IndicesIteratorType>
+void batched_search_impl(const std::string& label, const ExecutionSpace& ex,
+                         HaystackIteratorType first, HaystackIteratorType last,
+                         NeedlesIteratorType needles_first,
+                         NeedlesIteratorType needles_last,
+                         IndicesIteratorType indices_first,
+                         InterpolationSearch) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first, needles_first,
+                                                   indices_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(needles_first, needles_last);
+
+  // aliases
+  using func_t =
+      StdInterpolationSearchFunctor<HaystackIteratorType, NeedlesIteratorType,
+                                    IndicesIteratorType, IsUpperBound>;
+  using index_type = typename func_t::index_type;
+
+  const index_type num_elements = Kokkos::Experimental::distance(first, last);
+  int max_guesses               = 1;
+  while ((index_type(1) << max_guesses) < num_elements) ++max_guesses;
+
+  const auto num_needles =
+      Kokkos::Experimental::distance(needles_first, needles_last);
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_needles),
+      func_t{first, num_elements, needles_first, indices_first, max_guesses});
+  ex.fence("Kokkos::batched_search: fence after operation");
+}
+
+}  // namespace Impl
+
+// ----------------------------------
+// lower_bound public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType lower_bound(const ExecutionSpace& ex, IteratorType first,
+                         IteratorType last, const ValueType& value) {
+  return Impl::lower_bound_impl("Kokkos::lower_bound_iterator_api_default", ex,
+                                first, last, value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType lower_bound(const std::string& label, const ExecutionSpace& ex,
+                         IteratorType first, IteratorType last,
+                         const ValueType& value) {
+  return Impl::lower_bound_impl(label, ex, first, last, value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto lower_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lower_bound_impl("Kokkos::lower_bound_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto lower_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lower_bound_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType lower_bound(const ExecutionSpace& ex, IteratorType first,
+                         IteratorType last, const ValueType& value,
+                         ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::lower_bound_impl("Kokkos::lower_bound_iterator_api_default", ex,
+                                first, last, value, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType lower_bound(const std::string& label, const ExecutionSpace& ex,
+                         IteratorType first, IteratorType last,
+                         const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::lower_bound_impl(label, ex, first, last, value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto lower_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lower_bound_impl("Kokkos::lower_bound_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto lower_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lower_bound_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value, std::move(comp));
+}
+
+// ----------------------------------
+// upper_bound public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType upper_bound(const ExecutionSpace& ex, IteratorType first,
+                         IteratorType last, const ValueType& value) {
+  return Impl::upper_bound_impl("Kokkos::upper_bound_iterator_api_default", ex,
+                                first, last, value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+IteratorType upper_bound(const std::string& label, const ExecutionSpace& ex,
+                         IteratorType first, IteratorType last,
+                         const ValueType& value) {
+  return Impl::upper_bound_impl(label, ex, first, last, value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto upper_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::upper_bound_impl("Kokkos::upper_bound_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto upper_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::upper_bound_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType upper_bound(const ExecutionSpace& ex, IteratorType first,
+                         IteratorType last, const ValueType& value,
+                         ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::upper_bound_impl("Kokkos::upper_bound_iterator_api_default", ex,
+                                first, last, value, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+IteratorType upper_bound(const std::string& label, const ExecutionSpace& ex,
+                         IteratorType first, IteratorType last,
+                         const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::upper_bound_impl(label, ex, first, last, value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto upper_bound(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::upper_bound_impl("Kokkos::upper_bound_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto upper_bound(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::upper_bound_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value, std::move(comp));
+}
+
+// ----------------------------------
+// equal_range public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType, class ValueType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const ExecutionSpace& ex, IteratorType first, IteratorType last,
+    const ValueType& value) {
+  return Impl::equal_range_impl("Kokkos::equal_range_iterator_api_default", ex,
+                                first, last, value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value) {
+  return Impl::equal_range_impl(label, ex, first, last, value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto equal_range(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_range_impl("Kokkos::equal_range_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType>
+auto equal_range(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_range_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value);
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const ExecutionSpace& ex, IteratorType first, IteratorType last,
+    const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::equal_range_impl("Kokkos::equal_range_iterator_api_default", ex,
+                                first, last, value, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          class ComparatorType>
+::Kokkos::pair<IteratorType, IteratorType> equal_range(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last, const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::equal_range_impl(label, ex, first, last, value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto equal_range(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_range_impl("Kokkos::equal_range_view_api_default", ex,
+                                KE::cbegin(view), KE::cend(view), value,
+                                std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ValueType, class ComparatorType>
+auto equal_range(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 const ValueType& value, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_range_impl(label, ex, KE::cbegin(view), KE::cend(view),
+                                value, std::move(comp));
+}
+
+// ----------------------------------
+// batched_lower_bound public API
+// ----------------------------------
+// indices(i) is the lower bound of needles(i) in the sorted haystack
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+void batched_lower_bound(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+
+  namespace KE = ::Kokkos::Experimental;
+  using value_type =
+      typename ::Kokkos::View<DataType1, Properties1...>::non_const_value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  Impl::batched_search_impl<false>(
+      "Kokkos::batched_lower_bound_view_api_default", ex, KE::cbegin(haystack),
+      KE::cend(haystack), KE::cbegin(needles), KE::cend(needles),
+      KE::begin(indices), pred_t());
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+void batched_lower_bound(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+
+  namespace KE = ::Kokkos::Experimental;
+  using value_type =
+      typename ::Kokkos::View<DataType1, Properties1...>::non_const_value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  Impl::batched_search_impl<false>(
+      label, ex, KE::cbegin(haystack), KE::cend(haystack), KE::cbegin(needles),
+      KE::cend(needles), KE::begin(indices), pred_t());
+}
+
+// comp is either a comparator or InterpolationSearch{}
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+void batched_lower_bound(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::batched_search_impl<false>(
+      "Kokkos::batched_lower_bound_view_api_default", ex, KE::cbegin(haystack),
+      KE::cend(haystack), KE::cbegin(needles), KE::cend(needles),
+      KE::begin(indices), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+void batched_lower_bound(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::batched_search_impl<false>(
+      label, ex, KE::cbegin(haystack), KE::cend(haystack), KE::cbegin(needles),
+      KE::cend(needles), KE::begin(indices), std::move(comp));
+}
+
+// ----------------------------------
+// batched_upper_bound public API
+// ----------------------------------
+// indices(i) is the upper bound of needles(i) in the sorted haystack
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+void batched_upper_bound(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+
+  namespace KE = ::Kokkos::Experimental;
+  using value_type =
+      typename ::Kokkos::View<DataType1, Properties1...>::non_const_value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  Impl::batched_search_impl<true>(
+      "Kokkos::batched_upper_bound_view_api_default", ex, KE::cbegin(haystack),
+      KE::cend(haystack), KE::cbegin(needles), KE::cend(needles),
+      KE::begin(indices), pred_t());
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+void batched_upper_bound(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+
+  namespace KE = ::Kokkos::Experimental;
+  using value_type =
+      typename ::Kokkos::View<DataType1, Properties1...>::non_const_value_type;
+  using pred_t = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  Impl::batched_search_impl<true>(
+      label, ex, KE::cbegin(haystack), KE::cend(haystack), KE::cbegin(needles),
+      KE::cend(needles), KE::begin(indices), pred_t());
+}
+
+// comp is either a comparator or InterpolationSearch{}
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+void batched_upper_bound(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::batched_search_impl<true>(
+      "Kokkos::batched_upper_bound_view_api_default", ex, KE::cbegin(haystack),
+      KE::cend(haystack), KE::cbegin(needles), KE::cend(needles),
+      KE::begin(indices), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+void batched_upper_bound(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& haystack,
+    const ::Kokkos::View<DataType2, Properties2...>& needles,
+    const ::Kokkos::View<DataType3, Properties3...>& indices,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(haystack);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(needles);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(indices);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::batched_search_impl<true>(
+      label, ex, KE::cbegin(haystack), KE::cend(haystack), KE::cbegin(needles),
+      KE::cend(needles), KE::begin(indices), std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -120,18 +120,67 @@ struct are_random_access_iterators<Head, Tail...> {
                                 are_random_access_iterators<Tail...>::value;
 };
 
+//
+// is_team_handle
+//
+template <class T>
+using team_rank_t = decltype(std::declval<const T&>().team_rank());
+
+template <class T>
+using league_rank_t = decltype(std::declval<const T&>().league_rank());
+
+template <class T>
+using team_barrier_t = decltype(std::declval<const T&>().team_barrier());
+
+template <class T>
+struct is_team_handle {
+  static constexpr bool value = Kokkos::is_detected<team_rank_t, T>::value &&
+                                Kokkos::is_detected<league_rank_t, T>::value &&
+                                Kokkos::is_detected<team_barrier_t, T>::value;
+};
+
+// the execution space overloads and the team handle overloads of the
+// algorithms have the same arity, so they are told apart with these
+template <class T>
+using enable_if_execution_space =
+    std::enable_if_t< ::Kokkos::is_execution_space<T>::value, int>;
+
+template <class T>
+using enable_if_team_handle = std::enable_if_t<is_team_handle<T>::value, int>;
+
+//
+// the execution space an algorithm runs on, also for a team handle
+//
+template <class T, class enable = void>
+struct execution_space_of {
+  using type = T;
+};
+
+template <class T>
+struct execution_space_of<T, std::enable_if_t<is_team_handle<T>::value> > {
+  using type = typename T::execution_space;
+};
+
 //
 // iterators_are_accessible_from
 //
+// iterators over a view are accessible if the view is, the range adaptors
+// specialize iterator_is_accessible_from for their own iterators
+template <class ExeSpace, class IteratorType>
+struct iterator_is_accessible_from {
+  using view_type = typename IteratorType::view_type;
+  static constexpr bool value =
+      SpaceAccessibility<ExeSpace,
+                         typename view_type::memory_space>::accessible;
+};
+
 template <class... Args>
 struct iterators_are_accessible_from;
 
 template <class ExeSpace, class IteratorType>
 struct iterators_are_accessible_from<ExeSpace, IteratorType> {
-  using view_type = typename IteratorType::view_type;
   static constexpr bool value =
-      SpaceAccessibility<ExeSpace,
-                         typename view_type::memory_space>::accessible;
+      iterator_is_accessible_from<ExeSpace, IteratorType>::value;
 };
 
 template <class ExeSpace, class Head, class... Tail>
@@ -149,7 +198,9 @@ static_assert_random_access_and_accessible(const ExecutionSpace& /* ex */,
       are_random_access_iterators<IteratorTypes...>::value,
       "Currently, Kokkos standard algorithms require random access iterators.");
   static_assert(
-      iterators_are_accessible_from<ExecutionSpace, IteratorTypes...>::value,
+      iterators_are_accessible_from<
+          typename execution_space_of<ExecutionSpace>::type,
+          IteratorTypes...>::value,
       "Incompatible view/iterator and execution space");
 }
 
@@ -213,16 +264,19 @@ struct not_openmptarget {
 template <class ExecutionSpace>
 KOKKOS_INLINE_FUNCTION constexpr void static_assert_is_not_openmptarget(
     const ExecutionSpace&) {
-  static_assert(not_openmptarget<ExecutionSpace>::value,
-                "Currently, Kokkos standard algorithms do not support custom "
-                "comparators in OpenMPTarget");
+  static_assert(
+      not_openmptarget<
+          typename execution_space_of<ExecutionSpace>::type>::value,
+      "Currently, Kokkos standard algorithms do not support custom "
+      "comparators in OpenMPTarget");
 }
 
 //
 // valid range
 //
 template <class IteratorType>
-void expect_valid_range(IteratorType first, IteratorType last) {
+KOKKOS_INLINE_FUNCTION void expect_valid_range(IteratorType first,
+                                               IteratorType last) {
   // this is a no-op for release
   KOKKOS_EXPECTS(last >= first);
   // avoid compiler complaining when KOKKOS_EXPECTS is no-op
@@ -0,0 +1,1102 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_MERGE_AND_SET_OPERATIONS_HPP
+#define KOKKOS_STD_MERGE_AND_SET_OPERATIONS_HPP
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_BeginEnd.hpp"
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_Distance.hpp"
+#include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_BinarySearchOperations.hpp"
+#include "Kokkos_ModifyingSequenceOperations.hpp"
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// ------------------
+//
+// helpers
+//
+// ------------------
+
+// Returns how many of the first diag elements of the merge of
+// [first1, first1 + n1) and [first2, first2 + n2) come from the first
+// range, taking from the first range on ties. This is the point where the
+// merge path crosses the diag-th cross diagonal.
+template <class IteratorType1, class IteratorType2, class IndexType,
+          class ComparatorType>
+KOKKOS_FUNCTION IndexType merge_path_split(const IteratorType1& first1,
+                                           IndexType n1,
+                                           const IteratorType2& first2,
+                                           IndexType n2, IndexType diag,
+                                           const ComparatorType& comp) {
+  IndexType lo = diag > n2 ? diag - n2 : IndexType(0);
+  IndexType hi = diag < n1 ? diag : n1;
+  while (lo < hi) {
+    const IndexType mid = lo + (hi - lo) / 2;
+    if (!comp(first2[diag - 1 - mid], first1[mid])) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// ------------------
+//
+// functors
+//
+// ------------------
+
+// Every index merges one chunk of the output: it finds where the merge
+// path enters and leaves the chunk and then merges sequentially, so the
+// work is balanced no matter how the two inputs interleave
+template <class IndexType, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+struct StdMergeFunctor {
+  IteratorType1 m_first1;
+  IndexType m_n1;
+  IteratorType2 m_first2;
+  IndexType m_n2;
+  OutputIteratorType m_dest_first;
+  ComparatorType m_comp;
+  IndexType m_chunk_size;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType chunk) const {
+    const IndexType total   = m_n1 + m_n2;
+    const IndexType d_begin = chunk * m_chunk_size;
+    const IndexType d_end =
+        d_begin + m_chunk_size < total ? d_begin + m_chunk_size : total;
+
+    IndexType i = merge_path_split(m_first1, m_n1, m_first2, m_n2, d_begin,
+                                   m_comp);
+    IndexType j = d_begin - i;
+    const IndexType i_end =
+        merge_path_split(m_first1, m_n1, m_first2, m_n2, d_end, m_comp);
+    const IndexType j_end = d_end - i_end;
+
+    IndexType d = d_begin;
+    while (i < i_end && j < j_end) {
+      if (m_comp(m_first2[j], m_first1[i])) {
+        m_dest_first[d++] = m_first2[j++];
+      } else {
+        m_dest_first[d++] = m_first1[i++];
+      }
+    }
+    while (i < i_end) {
+      m_dest_first[d++] = m_first1[i++];
+    }
+    while (j < j_end) {
+      m_dest_first[d++] = m_first2[j++];
+    }
+  }
+
+  KOKKOS_FUNCTION
+  StdMergeFunctor(IteratorType1 first1, IndexType n1, IteratorType2 first2,
+                  IndexType n2, OutputIteratorType dest_first,
+                  ComparatorType comp, IndexType chunk_size)
+      : m_first1(std::move(first1)),
+        m_n1(n1),
+        m_first2(std::move(first2)),
+        m_n2(n2),
+        m_dest_first(std::move(dest_first)),
+        m_comp(std::move(comp)),
+        m_chunk_size(chunk_size) {}
+};
+
+// The element first1[i] is the r-th of its equivalents in the first range,
+// with r = i - lower_bound_1(first1[i]), and it has a match in the second
+// range iff the second range has more than r equivalents to it.
+// set_intersection keeps the elements with a match, set_difference those
+// without one.
+template <class IndexType, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType, bool KeepMatched>
+struct StdSetSelectFunctor {
+  IteratorType1 m_first1;
+  IndexType m_n1;
+  IteratorType2 m_first2;
+  IndexType m_n2;
+  OutputIteratorType m_dest_first;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  bool is_selected(const IndexType i) const {
+    const auto& value = m_first1[i];
+    const IndexType rank =
+        i - lower_bound_index(m_first1, IndexType(0), i, value, m_comp);
+    const IndexType match =
+        lower_bound_index(m_first2, IndexType(0), m_n2, value, m_comp) + rank;
+    const bool matched = match < m_n2 && !m_comp(value, m_first2[match]);
+    return matched == KeepMatched;
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, IndexType& update,
+                  const bool final_pass) const {
+    if (is_selected(i)) {
+      if (final_pass) {
+        m_dest_first[update] = m_first1[i];
+      }
+      update += 1;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  StdSetSelectFunctor(IteratorType1 first1, IndexType n1,
+                      IteratorType2 first2, IndexType n2,
+                      OutputIteratorType dest_first, ComparatorType comp)
+      : m_first1(std::move(first1)),
+        m_n1(n1),
+        m_first2(std::move(first2)),
+        m_n2(n2),
+        m_dest_first(std::move(dest_first)),
+        m_comp(std::move(comp)) {}
+};
+
+// set_union keeps all of the first range and those elements of the second
+// range that have no match in the first one, see StdSetSelectFunctor.
+// The scan stores, for every element of the second range, how many kept
+// elements of the second range precede it.
+template <class IndexType, class IteratorType1, class IteratorType2,
+          class OffsetsViewType, class ComparatorType>
+struct StdSetUnionScanFunctor {
+  IteratorType1 m_first1;
+  IndexType m_n1;
+  IteratorType2 m_first2;
+  IndexType m_n2;
+  OffsetsViewType m_offsets;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType j, IndexType& update,
+                  const bool final_pass) const {
+    const auto& value = m_first2[j];
+    const IndexType rank =
+        j - lower_bound_index(m_first2, IndexType(0), j, value, m_comp);
+    const IndexType match =
+        lower_bound_index(m_first1, IndexType(0), m_n1, value, m_comp) + rank;
+    const bool matched = match < m_n1 && !m_comp(value, m_first1[match]);
+    if (final_pass) {
+      m_offsets(j) = update;
+    }
+    if (!matched) {
+      update += 1;
+    }
+    if (final_pass && j == m_n2 - 1) {
+      m_offsets(m_n2) = update;
+    }
+  }
+};
+
+// Equivalent elements of the first range go before those of the second
+// range, like in merge
+template <class IndexType, class IteratorType1, class IteratorType2,
+          class OffsetsViewType, class OutputIteratorType,
+          class ComparatorType>
+struct StdSetUnionScatterFunctor {
+  IteratorType1 m_first1;
+  IndexType m_n1;
+  IteratorType2 m_first2;
+  IndexType m_n2;
+  OffsetsViewType m_offsets;
+  OutputIteratorType m_dest_first;
+  ComparatorType m_comp;
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i) const {
+    if (i < m_n1) {
+      const auto& value = m_first1[i];
+      const IndexType num_less_in_2 =
+          lower_bound_index(m_first2, IndexType(0), m_n2, value, m_comp);
+      m_dest_first[i + m_offsets(num_less_in_2)] = value;
+    } else {
+      const IndexType j = i - m_n1;
+      if (m_offsets(j + 1) != m_offsets(j)) {
+        const auto& value = m_first2[j];
+        const IndexType num_not_greater_in_1 =
+            upper_bound_index(m_first1, IndexType(0), m_n1, value, m_comp);
+        m_dest_first[num_not_greater_in_1 + m_offsets(j)] = value;
+      }
+    }
+  }
+};
+
+// ------------------------------------------
+// merge_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType merge_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType1 first1,
+                              IteratorType1 last1, IteratorType2 first2,
+                              IteratorType2 last2, OutputIteratorType d_first,
+                              ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t     = StdMergeFunctor<index_type, IteratorType1, IteratorType2,
+                                 OutputIteratorType, ComparatorType>;
+
+  const index_type n1    = Kokkos::Experimental::distance(first1, last1);
+  const index_type n2    = Kokkos::Experimental::distance(first2, last2);
+  const index_type total = n1 + n2;
+  if (total == 0) {
+    return d_first;
+  }
+
+  // one chunk per thread, unless that makes the two split searches
+  // expensive compared to the merge itself
+  const index_type min_chunk_size = 256;
+  const index_type per_thread =
+      (total + ex.concurrency() - 1) / index_type(ex.concurrency());
+  const index_type chunk_size =
+      per_thread > min_chunk_size ? per_thread : min_chunk_size;
+  const index_type num_chunks = (total + chunk_size - 1) / chunk_size;
+
+  // run
+  ::Kokkos::parallel_for(label,
+                         RangePolicy<ExecutionSpace>(ex, 0, num_chunks),
+                         func_t(first1, n1, first2, n2, d_first,
+                                std::move(comp), chunk_size));
+  ex.fence("Kokkos::merge: fence after operation");
+
+  return d_first + total;
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+OutputIteratorType merge_impl(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType1 first1,
+                              IteratorType1 last1, IteratorType2 first2,
+                              IteratorType2 last2,
+                              OutputIteratorType d_first) {
+  using value_type1 = typename IteratorType1::value_type;
+  using value_type2 = typename IteratorType2::value_type;
+  using pred_t =
+      Impl::StdAlgoLessThanBinaryPredicate<value_type1, value_type2>;
+  return merge_impl(label, ex, first1, last1, first2, last2, d_first,
+                    pred_t());
+}
+
+// ------------------------------------------
+// inplace_merge_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void inplace_merge_impl(const std::string& label, const ExecutionSpace& ex,
+                        IteratorType first, IteratorType middle,
+                        IteratorType last, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, middle);
+  Impl::expect_valid_range(middle, last);
+
+  if (first == middle || middle == last) {
+    return;
+  }
+
+  // aliases
+  using index_type = typename IteratorType::difference_type;
+  using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+  using tmp_view_type = Kokkos::View<value_type*, ExecutionSpace>;
+
+  // merge into a temporary view and move the result back
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  tmp_view_type tmp_view(
+      Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                         "inplace_merge_impl_tmp_view"),
+      num_elements);
+  auto tmp_first = ::Kokkos::Experimental::begin(tmp_view);
+  merge_impl(label, ex, first, middle, middle, last, tmp_first,
+             std::move(comp));
+
+  using move_func_t =
+      StdMoveFunctor<index_type, decltype(tmp_first), IteratorType>;
+  ::Kokkos::parallel_for(label,
+                         RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                         move_func_t(tmp_first, first));
+  ex.fence("Kokkos::inplace_merge: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void inplace_merge_impl(const std::string& label, const ExecutionSpace& ex,
+                        IteratorType first, IteratorType middle,
+                        IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  inplace_merge_impl(label, ex, first, middle, last, pred_t());
+}
+
+// ------------------------------------------
+// set_intersection_impl, set_difference_impl
+// ------------------------------------------
+template <bool KeepMatched, class ExecutionSpace, class IteratorType1,
+          class IteratorType2, class OutputIteratorType, class ComparatorType>
+OutputIteratorType set_select_impl(const std::string& label,
+                                   const ExecutionSpace& ex,
+                                   IteratorType1 first1, IteratorType1 last1,
+                                   IteratorType2 first2, IteratorType2 last2,
+                                   OutputIteratorType d_first,
+                                   ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  if (first1 == last1) {
+    return d_first;
+  }
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t =
+      StdSetSelectFunctor<index_type, IteratorType1, IteratorType2,
+                          OutputIteratorType, ComparatorType, KeepMatched>;
+
+  // run
+  const index_type n1 = Kokkos::Experimental::distance(first1, last1);
+  const index_type n2 = Kokkos::Experimental::distance(first2, last2);
+  index_type count    = 0;
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, n1),
+      func_t(first1, n1, first2, n2, d_first, std::move(comp)), count);
+
+  // fence not needed because of the scan accumulating into count
+  return d_first + count;
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType set_intersection_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  return set_select_impl<true>(label, ex, first1, last1, first2, last2,
+                               d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+OutputIteratorType set_intersection_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first) {
+  using value_type = typename IteratorType1::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  return set_select_impl<true>(label, ex, first1, last1, first2, last2,
+                               d_first, pred_t());
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType set_difference_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first, ComparatorType comp) {
+  return set_select_impl<false>(label, ex, first1, last1, first2, last2,
+                                d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+OutputIteratorType set_difference_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+    OutputIteratorType d_first) {
+  using value_type = typename IteratorType1::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  return set_select_impl<false>(label, ex, first1, last1, first2, last2,
+                                d_first, pred_t());
+}
+
+// ------------------------------------------
+// set_union_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType, class ComparatorType>
+OutputIteratorType set_union_impl(const std::string& label,
+                                  const ExecutionSpace& ex,
+                                  IteratorType1 first1, IteratorType1 last1,
+                                  IteratorType2 first2, IteratorType2 last2,
+                                  OutputIteratorType d_first,
+                                  ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type        = typename IteratorType1::difference_type;
+  using offsets_view_type = Kokkos::View<index_type*, ExecutionSpace>;
+  using scan_func_t =
+      StdSetUnionScanFunctor<index_type, IteratorType1, IteratorType2,
+                             offsets_view_type, ComparatorType>;
+  using scatter_func_t =
+      StdSetUnionScatterFunctor<index_type, IteratorType1, IteratorType2,
+                                offsets_view_type, OutputIteratorType,
+                                ComparatorType>;
+
+  const index_type n1 = Kokkos::Experimental::distance(first1, last1);
+  const index_type n2 = Kokkos::Experimental::distance(first2, last2);
+  if (n2 == 0) {
+    return Impl::copy_impl(label, ex, first1, last1, d_first);
+  }
+
+  // count the kept elements of the second range
+  offsets_view_type offsets(
+      Kokkos::view_alloc(ex, Kokkos::WithoutInitializing,
+                         "set_union_impl_offsets"),
+      n2 + 1);
+  index_type count2 = 0;
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, n2),
+      scan_func_t{first1, n1, first2, n2, offsets, comp}, count2);
+
+  // scatter both ranges to their final positions
+  ::Kokkos::parallel_for(
+      label, RangePolicy<ExecutionSpace>(ex, 0, n1 + n2),
+      scatter_func_t{first1, n1, first2, n2, offsets, d_first,
+                     std::move(comp)});
+  ex.fence("Kokkos::set_union: fence after operation");
+
+  return d_first + n1 + count2;
+}
+
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          class OutputIteratorType>
+OutputIteratorType set_union_impl(const std::string& label,
+                                  const ExecutionSpace& ex,
+                                  IteratorType1 first1, IteratorType1 last1,
+                                  IteratorType2 first2, IteratorType2 last2,
+                                  OutputIteratorType d_first) {
+  using value_type = typename IteratorType1::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  return set_union_impl(label, ex, first1, last1, first2, last2, d_first,
+                        pred_t());
+}
+
+}  // namespace Impl
+
+// -------------------
+// merge public API
+// -------------------
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator merge(const ExecutionSpace& ex, InputIterator1 first1,
+                     InputIterator1 last1, InputIterator2 first2,
+                     InputIterator2 last2, OutputIterator d_first) {
+  return Impl::merge_impl("Kokkos::merge_iterator_api_default", ex, first1,
+                          last1, first2, last2, d_first);
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator merge(const std::string& label, const ExecutionSpace& ex,
+                     InputIterator1 first1, InputIterator1 last1,
+                     InputIterator2 first2, InputIterator2 last2,
+                     OutputIterator d_first) {
+  return Impl::merge_impl(label, ex, first1, last1, first2, last2, d_first);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto merge(const ExecutionSpace& ex,
+           const ::Kokkos::View<DataType1, Properties1...>& view1,
+           const ::Kokkos::View<DataType2, Properties2...>& view2,
+           const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::merge_impl("Kokkos::merge_view_api_default", ex,
+                          KE::cbegin(view1), KE::cend(view1), KE::cbegin(view2),
+                          KE::cend(view2), KE::begin(dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto merge(const std::string& label, const ExecutionSpace& ex,
+           const ::Kokkos::View<DataType1, Properties1...>& view1,
+           const ::Kokkos::View<DataType2, Properties2...>& view2,
+           const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::merge_impl(label, ex, KE::cbegin(view1), KE::cend(view1),
+                          KE::cbegin(view2), KE::cend(view2), KE::begin(dest));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator merge(const ExecutionSpace& ex, InputIterator1 first1,
+                     InputIterator1 last1, InputIterator2 first2,
+                     InputIterator2 last2, OutputIterator d_first,
+                     ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::merge_impl("Kokkos::merge_iterator_api_default", ex, first1,
+                          last1, first2, last2, d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator merge(const std::string& label, const ExecutionSpace& ex,
+                     InputIterator1 first1, InputIterator1 last1,
+                     InputIterator2 first2, InputIterator2 last2,
+                     OutputIterator d_first, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::merge_impl(label, ex, first1, last1, first2, last2, d_first,
+                          std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto merge(const ExecutionSpace& ex,
+           const ::Kokkos::View<DataType1, Properties1...>& view1,
+           const ::Kokkos::View<DataType2, Properties2...>& view2,
+           const ::Kokkos::View<DataType3, Properties3...>& dest,
+           ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::merge_impl("Kokkos::merge_view_api_default", ex,
+                          KE::cbegin(view1), KE::cend(view1), KE::cbegin(view2),
+                          KE::cend(view2), KE::begin(dest), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto merge(const std::string& label, const ExecutionSpace& ex,
+           const ::Kokkos::View<DataType1, Properties1...>& view1,
+           const ::Kokkos::View<DataType2, Properties2...>& view2,
+           const ::Kokkos::View<DataType3, Properties3...>& dest,
+           ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::merge_impl(label, ex, KE::cbegin(view1), KE::cend(view1),
+                          KE::cbegin(view2), KE::cend(view2), KE::begin(dest),
+                          std::move(comp));
+}
+
+// -------------------
+// inplace_merge public API
+// -------------------
+template <class ExecutionSpace, class IteratorType>
+void inplace_merge(const ExecutionSpace& ex, IteratorType first,
+                   IteratorType middle, IteratorType last) {
+  Impl::inplace_merge_impl("Kokkos::inplace_merge_iterator_api_default", ex,
+                           first, middle, last);
+}
+
+template <class ExecutionSpace, class IteratorType>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   IteratorType first, IteratorType middle, IteratorType last) {
+  Impl::inplace_merge_impl(label, ex, first, middle, last);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void inplace_merge(const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::inplace_merge_impl("Kokkos::inplace_merge_view_api_default", ex,
+                           KE::begin(view), KE::begin(view) + middle_location,
+                           KE::end(view));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::inplace_merge_impl(label, ex, KE::begin(view),
+                           KE::begin(view) + middle_location, KE::end(view));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void inplace_merge(const ExecutionSpace& ex, IteratorType first,
+                   IteratorType middle, IteratorType last,
+                   ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::inplace_merge_impl("Kokkos::inplace_merge_iterator_api_default", ex,
+                           first, middle, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   IteratorType first, IteratorType middle, IteratorType last,
+                   ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::inplace_merge_impl(label, ex, first, middle, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void inplace_merge(const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::inplace_merge_impl("Kokkos::inplace_merge_view_api_default", ex,
+                           KE::begin(view), KE::begin(view) + middle_location,
+                           KE::end(view), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void inplace_merge(const std::string& label, const ExecutionSpace& ex,
+                   const ::Kokkos::View<DataType, Properties...>& view,
+                   std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::inplace_merge_impl(label, ex, KE::begin(view),
+                           KE::begin(view) + middle_location, KE::end(view),
+                           std::move(comp));
+}
+
+// -------------------
+// set_union public API
+// -------------------
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_union(const ExecutionSpace& ex, InputIterator1 first1,
+                         InputIterator1 last1, InputIterator2 first2,
+                         InputIterator2 last2, OutputIterator d_first) {
+  return Impl::set_union_impl("Kokkos::set_union_iterator_api_default", ex,
+                              first1, last1, first2, last2, d_first);
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_union(const std::string& label, const ExecutionSpace& ex,
+                         InputIterator1 first1, InputIterator1 last1,
+                         InputIterator2 first2, InputIterator2 last2,
+                         OutputIterator d_first) {
+  return Impl::set_union_impl(label, ex, first1, last1, first2, last2, d_first);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_union(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_union_impl("Kokkos::set_union_view_api_default", ex,
+                              KE::cbegin(view1), KE::cend(view1),
+                              KE::cbegin(view2), KE::cend(view2),
+                              KE::begin(dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_union(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_union_impl(label, ex, KE::cbegin(view1), KE::cend(view1),
+                              KE::cbegin(view2), KE::cend(view2),
+                              KE::begin(dest));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_union(const ExecutionSpace& ex, InputIterator1 first1,
+                         InputIterator1 last1, InputIterator2 first2,
+                         InputIterator2 last2, OutputIterator d_first,
+                         ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_union_impl("Kokkos::set_union_iterator_api_default", ex,
+                              first1, last1, first2, last2, d_first,
+                              std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_union(const std::string& label, const ExecutionSpace& ex,
+                         InputIterator1 first1, InputIterator1 last1,
+                         InputIterator2 first2, InputIterator2 last2,
+                         OutputIterator d_first, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_union_impl(label, ex, first1, last1, first2, last2, d_first,
+                              std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_union(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& dest,
+               ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_union_impl("Kokkos::set_union_view_api_default", ex,
+                              KE::cbegin(view1), KE::cend(view1),
+                              KE::cbegin(view2), KE::cend(view2),
+                              KE::begin(dest), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_union(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType1, Properties1...>& view1,
+               const ::Kokkos::View<DataType2, Properties2...>& view2,
+               const ::Kokkos::View<DataType3, Properties3...>& dest,
+               ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_union_impl(label, ex, KE::cbegin(view1), KE::cend(view1),
+                              KE::cbegin(view2), KE::cend(view2),
+                              KE::begin(dest), std::move(comp));
+}
+
+// -------------------
+// set_intersection public API
+// -------------------
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_intersection(const ExecutionSpace& ex, InputIterator1 first1,
+                                InputIterator1 last1, InputIterator2 first2,
+                                InputIterator2 last2, OutputIterator d_first) {
+  return Impl::set_intersection_impl(
+      "Kokkos::set_intersection_iterator_api_default", ex, first1, last1,
+      first2, last2, d_first);
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_intersection(const std::string& label,
+                                const ExecutionSpace& ex, InputIterator1 first1,
+                                InputIterator1 last1, InputIterator2 first2,
+                                InputIterator2 last2, OutputIterator d_first) {
+  return Impl::set_intersection_impl(label, ex, first1, last1, first2, last2,
+                                     d_first);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_intersection(const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType1, Properties1...>& view1,
+                      const ::Kokkos::View<DataType2, Properties2...>& view2,
+                      const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_intersection_impl(
+      "Kokkos::set_intersection_view_api_default", ex, KE::cbegin(view1),
+      KE::cend(view1), KE::cbegin(view2), KE::cend(view2), KE::begin(dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_intersection(const std::string& label, const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType1, Properties1...>& view1,
+                      const ::Kokkos::View<DataType2, Properties2...>& view2,
+                      const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_intersection_impl(label, ex, KE::cbegin(view1),
+                                     KE::cend(view1), KE::cbegin(view2),
+                                     KE::cend(view2), KE::begin(dest));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_intersection(const ExecutionSpace& ex, InputIterator1 first1,
+                                InputIterator1 last1, InputIterator2 first2,
+                                InputIterator2 last2, OutputIterator d_first,
+                                ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_intersection_impl(
+      "Kokkos::set_intersection_iterator_api_default", ex, first1, last1,
+      first2, last2, d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_intersection(const std::string& label,
+                                const ExecutionSpace& ex, InputIterator1 first1,
+                                InputIterator1 last1, InputIterator2 first2,
+                                InputIterator2 last2, OutputIterator d_first,
+                                ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_intersection_impl(label, ex, first1, last1, first2, last2,
+                                     d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_intersection(const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType1, Properties1...>& view1,
+                      const ::Kokkos::View<DataType2, Properties2...>& view2,
+                      const ::Kokkos::View<DataType3, Properties3...>& dest,
+                      ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_intersection_impl(
+      "Kokkos::set_intersection_view_api_default", ex, KE::cbegin(view1),
+      KE::cend(view1), KE::cbegin(view2), KE::cend(view2), KE::begin(dest),
+      std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_intersection(const std::string& label, const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType1, Properties1...>& view1,
+                      const ::Kokkos::View<DataType2, Properties2...>& view2,
+                      const ::Kokkos::View<DataType3, Properties3...>& dest,
+                      ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_intersection_impl(label, ex, KE::cbegin(view1),
+                                     KE::cend(view1), KE::cbegin(view2),
+                                     KE::cend(view2), KE::begin(dest),
+                                     std::move(comp));
+}
+
+// -------------------
+// set_difference public API
+// -------------------
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_difference(const ExecutionSpace& ex, InputIterator1 first1,
+                              InputIterator1 last1, InputIterator2 first2,
+                              InputIterator2 last2, OutputIterator d_first) {
+  return Impl::set_difference_impl(
+      "Kokkos::set_difference_iterator_api_default", ex, first1, last1, first2,
+      last2, d_first);
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator>
+OutputIterator set_difference(const std::string& label,
+                              const ExecutionSpace& ex, InputIterator1 first1,
+                              InputIterator1 last1, InputIterator2 first2,
+                              InputIterator2 last2, OutputIterator d_first) {
+  return Impl::set_difference_impl(label, ex, first1, last1, first2, last2,
+                                   d_first);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_difference(const ExecutionSpace& ex,
+                    const ::Kokkos::View<DataType1, Properties1...>& view1,
+                    const ::Kokkos::View<DataType2, Properties2...>& view2,
+                    const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_difference_impl("Kokkos::set_difference_view_api_default",
+                                   ex, KE::cbegin(view1), KE::cend(view1),
+                                   KE::cbegin(view2), KE::cend(view2),
+                                   KE::begin(dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto set_difference(const std::string& label, const ExecutionSpace& ex,
+                    const ::Kokkos::View<DataType1, Properties1...>& view1,
+                    const ::Kokkos::View<DataType2, Properties2...>& view2,
+                    const ::Kokkos::View<DataType3, Properties3...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_difference_impl(label, ex, KE::cbegin(view1),
+                                   KE::cend(view1), KE::cbegin(view2),
+                                   KE::cend(view2), KE::begin(dest));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_difference(const ExecutionSpace& ex, InputIterator1 first1,
+                              InputIterator1 last1, InputIterator2 first2,
+                              InputIterator2 last2, OutputIterator d_first,
+                              ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_difference_impl(
+      "Kokkos::set_difference_iterator_api_default", ex, first1, last1, first2,
+      last2, d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class InputIterator1, class InputIterator2,
+          class OutputIterator, class ComparatorType>
+OutputIterator set_difference(const std::string& label,
+                              const ExecutionSpace& ex, InputIterator1 first1,
+                              InputIterator1 last1, InputIterator2 first2,
+                              InputIterator2 last2, OutputIterator d_first,
+                              ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  return Impl::set_difference_impl(label, ex, first1, last1, first2, last2,
+                                   d_first, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_difference(const ExecutionSpace& ex,
+                    const ::Kokkos::View<DataType1, Properties1...>& view1,
+                    const ::Kokkos::View<DataType2, Properties2...>& view2,
+                    const ::Kokkos::View<DataType3, Properties3...>& dest,
+                    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_difference_impl("Kokkos::set_difference_view_api_default",
+                                   ex, KE::cbegin(view1), KE::cend(view1),
+                                   KE::cbegin(view2), KE::cend(view2),
+                                   KE::begin(dest), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ComparatorType>
+auto set_difference(const std::string& label, const ExecutionSpace& ex,
+                    const ::Kokkos::View<DataType1, Properties1...>& view1,
+                    const ::Kokkos::View<DataType2, Properties2...>& view2,
+                    const ::Kokkos::View<DataType3, Properties3...>& dest,
+                    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::set_difference_impl(label, ex, KE::cbegin(view1),
+                                   KE::cend(view1), KE::cbegin(view2),
+                                   KE::cend(view2), KE::begin(dest),
+                                   std::move(comp));
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
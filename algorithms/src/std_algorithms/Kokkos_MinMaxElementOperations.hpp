@@ -129,6 +129,40 @@ IteratorType min_or_max_element_impl(const std::string& label,
   return first + red_result.loc;
 }
 
+template <template <class... Args> class ReducerType, class TeamHandleType,
+          class IteratorType, class... Args>
+KOKKOS_FUNCTION IteratorType
+min_or_max_element_team_impl(const TeamHandleType& teamHandle,
+                             IteratorType first, IteratorType last,
+                             Args&&... args) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return last;
+  }
+
+  // aliases
+  using index_type           = typename IteratorType::difference_type;
+  using value_type           = typename IteratorType::value_type;
+  using reducer_type         = ReducerType<value_type, index_type, Args...>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t = StdMinOrMaxElemFunctor<IteratorType, reducer_type>;
+
+  // run
+  reduction_value_type red_result;
+  reducer_type reducer(red_result, std::forward<Args>(args)...);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_t(first, reducer), reducer);
+
+  // no barrier needed because every member gets the reduced value
+
+  // return
+  return first + red_result.loc;
+}
+
 // ------------------------------------------
 // minmax_element_impl
 // ------------------------------------------
@@ -166,12 +200,46 @@ template <template <class... Args> class ReducerType, class ExecutionSpace,
   return {first + red_result.min_loc, first + red_result.max_loc};
 }
 
+template <template <class... Args> class ReducerType, class TeamHandleType,
+          class IteratorType, class... Args>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType, IteratorType>
+minmax_element_team_impl(const TeamHandleType& teamHandle, IteratorType first,
+                         IteratorType last, Args&&... args) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return {first, first};
+  }
+
+  // aliases
+  using index_type           = typename IteratorType::difference_type;
+  using value_type           = typename IteratorType::value_type;
+  using reducer_type         = ReducerType<value_type, index_type, Args...>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t               = StdMinMaxElemFunctor<IteratorType, reducer_type>;
+
+  // run
+  reduction_value_type red_result;
+  reducer_type reducer(red_result, std::forward<Args>(args)...);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_t(first, reducer), reducer);
+
+  // no barrier needed because every member gets the reduced value
+
+  // return
+  return {first + red_result.min_loc, first + red_result.max_loc};
+}
+
 }  // end namespace Impl
 
 // ----------------------
 // min_element public API
 // ----------------------
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto min_element(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last) {
   return Impl::min_or_max_element_impl<MinFirstLoc>(
@@ -184,7 +252,8 @@ auto min_element(const std::string& label, const ExecutionSpace& ex,
   return Impl::min_or_max_element_impl<MinFirstLoc>(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class IteratorType, class ComparatorType>
+template <class ExecutionSpace, class IteratorType, class ComparatorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto min_element(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last, ComparatorType comp) {
   Impl::static_assert_is_not_openmptarget(ex);
@@ -203,7 +272,8 @@ auto min_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, first, last, std::move(comp));
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto min_element(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& v) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
@@ -213,7 +283,8 @@ auto min_element(const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class ComparatorType,
-          class... Properties>
+          class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto min_element(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& v,
                  ComparatorType comp) {
@@ -246,10 +317,54 @@ auto min_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, begin(v), end(v), std::move(comp));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto min_element(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last) {
+  return Impl::min_or_max_element_team_impl<MinFirstLoc>(teamHandle, first,
+                                                         last);
+}
+
+template <class TeamHandleType, class IteratorType, class ComparatorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto min_element(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last,
+                                 ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::min_or_max_element_team_impl<MinFirstLocCustomComparator>(
+      teamHandle, first, last, std::move(comp));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto min_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+
+  return Impl::min_or_max_element_team_impl<MinFirstLoc>(teamHandle, begin(v),
+                                                         end(v));
+}
+
+template <class TeamHandleType, class DataType, class ComparatorType,
+          class... Properties, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto min_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::min_or_max_element_team_impl<MinFirstLocCustomComparator>(
+      teamHandle, begin(v), end(v), std::move(comp));
+}
+
 // ----------------------
 // max_element public API
 // ----------------------
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto max_element(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last) {
   return Impl::min_or_max_element_impl<MaxFirstLoc>(
@@ -262,7 +377,8 @@ auto max_element(const std::string& label, const ExecutionSpace& ex,
   return Impl::min_or_max_element_impl<MaxFirstLoc>(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class IteratorType, class ComparatorType>
+template <class ExecutionSpace, class IteratorType, class ComparatorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto max_element(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last, ComparatorType comp) {
   Impl::static_assert_is_not_openmptarget(ex);
@@ -281,7 +397,8 @@ auto max_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, first, last, std::move(comp));
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto max_element(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& v) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
@@ -300,7 +417,8 @@ auto max_element(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class ComparatorType,
-          class... Properties>
+          class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto max_element(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& v,
                  ComparatorType comp) {
@@ -324,10 +442,54 @@ auto max_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, begin(v), end(v), std::move(comp));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto max_element(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last) {
+  return Impl::min_or_max_element_team_impl<MaxFirstLoc>(teamHandle, first,
+                                                         last);
+}
+
+template <class TeamHandleType, class IteratorType, class ComparatorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto max_element(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last,
+                                 ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::min_or_max_element_team_impl<MaxFirstLocCustomComparator>(
+      teamHandle, first, last, std::move(comp));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto max_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+
+  return Impl::min_or_max_element_team_impl<MaxFirstLoc>(teamHandle, begin(v),
+                                                         end(v));
+}
+
+template <class TeamHandleType, class DataType, class ComparatorType,
+          class... Properties, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto max_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::min_or_max_element_team_impl<MaxFirstLocCustomComparator>(
+      teamHandle, begin(v), end(v), std::move(comp));
+}
+
 // -------------------------
 // minmax_element public API
 // -------------------------
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto minmax_element(const ExecutionSpace& ex, IteratorType first,
                     IteratorType last) {
   return Impl::minmax_element_impl<MinMaxFirstLastLoc>(
@@ -340,7 +502,8 @@ auto minmax_element(const std::string& label, const ExecutionSpace& ex,
   return Impl::minmax_element_impl<MinMaxFirstLastLoc>(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class IteratorType, class ComparatorType>
+template <class ExecutionSpace, class IteratorType, class ComparatorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto minmax_element(const ExecutionSpace& ex, IteratorType first,
                     IteratorType last, ComparatorType comp) {
   Impl::static_assert_is_not_openmptarget(ex);
@@ -360,7 +523,8 @@ auto minmax_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, first, last, std::move(comp));
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto minmax_element(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType, Properties...>& v) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
@@ -379,7 +543,8 @@ auto minmax_element(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class ComparatorType,
-          class... Properties>
+          class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto minmax_element(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType, Properties...>& v,
                     ComparatorType comp) {
@@ -403,6 +568,49 @@ auto minmax_element(const std::string& label, const ExecutionSpace& ex,
       label, ex, begin(v), end(v), std::move(comp));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto minmax_element(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last) {
+  return Impl::minmax_element_team_impl<MinMaxFirstLastLoc>(teamHandle, first,
+                                                            last);
+}
+
+template <class TeamHandleType, class IteratorType, class ComparatorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto minmax_element(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last,
+                                    ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::minmax_element_team_impl<MinMaxFirstLastLocCustomComparator>(
+      teamHandle, first, last, std::move(comp));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto minmax_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+
+  return Impl::minmax_element_team_impl<MinMaxFirstLastLoc>(teamHandle,
+                                                            begin(v), end(v));
+}
+
+template <class TeamHandleType, class DataType, class ComparatorType,
+          class... Properties, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto minmax_element(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& v, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+
+  return Impl::minmax_element_team_impl<MinMaxFirstLastLocCustomComparator>(
+      teamHandle, begin(v), end(v), std::move(comp));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -463,6 +463,58 @@ struct StdFindEndFunctor {
         m_p(std::move(p)) {}
 };
 
+// ------------------------------------------
+// first_loc_chunked_impl
+// ------------------------------------------
+// Computes the FirstLoc reduction of the functor over [0, num_indices)
+// as a sequence of parallel_reduce over consecutive chunks whose size
+// doubles every time. Once a chunk contains a match we can stop, since all
+// the indices before that chunk are known not to match: an early match
+// then costs about its position rather than a sweep over the whole range.
+// Returns reduction_identity<IndexType>::min() if nothing matches.
+//
+// The first chunk has a small fixed size rather than one derived from the
+// concurrency of the execution space, which on devices would exceed most
+// ranges and turn every search into a full sweep.
+constexpr int first_loc_first_chunk_size = 4096;
+
+template <class IndexType, class ExecutionSpace, class FunctorType>
+IndexType first_loc_chunked_impl(const std::string& label,
+                                 const ExecutionSpace& ex,
+                                 const IndexType num_indices,
+                                 const FunctorType& functor) {
+  using reducer_type         = FirstLoc<IndexType>;
+  using reduction_value_type = typename reducer_type::value_type;
+  constexpr auto not_found = ::Kokkos::reduction_identity<IndexType>::min();
+
+  // the doubling bounds the number of launches by the log of the range
+  IndexType chunk_size  = first_loc_first_chunk_size;
+  IndexType chunk_begin = 0;
+  while (chunk_begin < num_indices) {
+    const IndexType chunk_end = (num_indices - chunk_begin <= chunk_size)
+                                    ? num_indices
+                                    : chunk_begin + chunk_size;
+
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, chunk_begin, chunk_end),
+        functor, reducer);
+
+    // fence not needed because reducing into scalar
+    if (red_result.min_loc_true != not_found) {
+      return red_result.min_loc_true;
+    }
+
+    chunk_begin = chunk_end;
+    if (chunk_size < num_indices) {
+      chunk_size *= 2;
+    }
+  }
+
+  return not_found;
+}
+
 // ------------------------------------------
 // find_if_or_not_impl
 // ------------------------------------------
@@ -491,19 +543,54 @@ IteratorType find_if_or_not_impl(const std::string& label,
   reduction_value_type red_result;
   reducer_type reducer(red_result);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(label,
-                            RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+
+  const auto loc = first_loc_chunked_impl(label, ex, num_elements,
+                                          func_t(first, reducer, pred));
+
+  // decide and return
+  if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
+    // here, it means a valid loc has not been found,
+    return last;
+  } else {
+    // a location has been found
+    return first + loc;
+  }
+}
+
+template <bool is_find_if, class TeamHandleType, class IteratorType,
+          class PredicateType>
+KOKKOS_FUNCTION IteratorType find_if_or_not_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return last;
+  }
+
+  // aliases
+  using index_type           = typename IteratorType::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t = StdFindIfOrNotFunctor<is_find_if, index_type, IteratorType,
+                                       reducer_type, PredicateType>;
+
+  // run
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
                             func_t(first, reducer, pred), reducer);
 
-  // fence not needed because reducing into scalar
+  // no barrier needed because every member gets the reduced value
 
   // decide and return
   if (red_result.min_loc_true ==
       ::Kokkos::reduction_identity<index_type>::min()) {
-    // here, it means a valid loc has not been found,
     return last;
   } else {
-    // a location has been found
     return first + red_result.min_loc_true;
   }
 }
@@ -520,6 +607,16 @@ InputIterator find_impl(const std::string& label, ExecutionSpace ex,
       ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
 }
 
+template <class TeamHandleType, class InputIterator, class T>
+KOKKOS_FUNCTION InputIterator find_team_impl(const TeamHandleType& teamHandle,
+                                             InputIterator first,
+                                             InputIterator last,
+                                             const T& value) {
+  return find_if_or_not_team_impl<true>(
+      teamHandle, first, last,
+      ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
+}
+
 // ------------------------------------------
 // for_each_impl
 // ------------------------------------------
@@ -541,6 +638,24 @@ UnaryFunctorType for_each_impl(const std::string& label,
   return functor;
 }
 
+template <class TeamHandleType, class IteratorType, class UnaryFunctorType>
+KOKKOS_FUNCTION UnaryFunctorType for_each_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    UnaryFunctorType functor) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, num_elements),
+      StdForEachFunctor<IteratorType, UnaryFunctorType>(first, functor));
+  teamHandle.team_barrier();
+
+  return functor;
+}
+
 // ------------------------------------------
 // for_each_n_impl
 // ------------------------------------------
@@ -563,6 +678,25 @@ IteratorType for_each_n_impl(const std::string& label, const ExecutionSpace& ex,
   return last;
 }
 
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class UnaryFunctorType>
+KOKKOS_FUNCTION IteratorType for_each_n_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, SizeType n,
+    UnaryFunctorType functor) {
+  auto last = first + n;
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, last);
+  Impl::expect_valid_range(first, last);
+
+  if (n == 0) {
+    return first;
+  }
+
+  for_each_team_impl(teamHandle, first, last, std::move(functor));
+  // no need to add a barrier since for_each_team_impl does it already
+
+  return last;
+}
+
 // ------------------------------------------
 // count_if_impl
 // ------------------------------------------
@@ -590,6 +724,27 @@ typename IteratorType::difference_type count_if_impl(const std::string& label,
   return count;
 }
 
+template <class TeamHandleType, class IteratorType, class Predicate>
+KOKKOS_FUNCTION typename IteratorType::difference_type count_if_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    Predicate predicate) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using func_t = StdCountIfFunctor<IteratorType, Predicate>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  typename IteratorType::difference_type count = 0;
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_t(first, predicate), count);
+
+  // no barrier needed because every member gets the reduced value
+  return count;
+}
+
 // ------------------------------------------
 // count_impl
 // ------------------------------------------
@@ -601,6 +756,15 @@ auto count_impl(const std::string& label, const ExecutionSpace& ex,
       ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
 }
 
+template <class TeamHandleType, class IteratorType, class T>
+KOKKOS_FUNCTION auto count_team_impl(const TeamHandleType& teamHandle,
+                                     IteratorType first, IteratorType last,
+                                     const T& value) {
+  return count_if_team_impl(
+      teamHandle, first, last,
+      ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
+}
+
 // ------------------------------------------
 // mismatch_impl
 // ------------------------------------------
@@ -638,15 +802,13 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
   const auto num_elemen_par_reduce = (num_e1 <= num_e2) ? num_e1 : num_e2;
   reduction_value_type red_result;
   reducer_type reducer(red_result);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
-      functor_type(first1, first2, reducer, std::move(predicate)), reducer);
-
-  // fence not needed because reducing into scalar
+  const auto loc = first_loc_chunked_impl(
+      label, ex, num_elemen_par_reduce,
+      functor_type(first1, first2, reducer, std::move(predicate)));
 
   // decide and return
   constexpr auto red_min = ::Kokkos::reduction_identity<index_type>::min();
-  if (red_result.min_loc_true == red_min) {
+  if (loc == red_min) {
     // in here means mismatch has not been found
     if (num_e1 == num_e2) {
       return return_type(last1, last2);
@@ -657,8 +819,7 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
     }
   } else {
     // in here means mismatch has been found
-    return return_type(first1 + red_result.min_loc_true,
-                       first2 + red_result.min_loc_true);
+    return return_type(first1 + loc, first2 + loc);
   }
 }
 
@@ -672,6 +833,71 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2>
   return mismatch_impl(label, ex, first1, last1, first2, last2, pred_t());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType1, IteratorType2>
+mismatch_team_impl(const TeamHandleType& teamHandle, IteratorType1 first1,
+                   IteratorType1 last1, IteratorType2 first2,
+                   IteratorType2 last2, BinaryPredicateType predicate) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using return_type          = ::Kokkos::pair<IteratorType1, IteratorType2>;
+  using index_type           = typename IteratorType1::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using functor_type =
+      StdMismatchRedFunctor<index_type, IteratorType1, IteratorType2,
+                            reducer_type, BinaryPredicateType>;
+
+  const auto num_e1 = last1 - first1;
+  const auto num_e2 = last2 - first2;
+  if (num_e1 == 0 || num_e2 == 0) {
+    return return_type(first1, first2);
+  }
+
+  // run
+  const auto num_elemen_par_reduce = (num_e1 <= num_e2) ? num_e1 : num_e2;
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  ::Kokkos::parallel_reduce(
+      TeamThreadRange(teamHandle, 0, num_elemen_par_reduce),
+      functor_type(first1, first2, reducer, std::move(predicate)), reducer);
+
+  // no barrier needed because every member gets the reduced value
+
+  // decide and return
+  constexpr auto red_min = ::Kokkos::reduction_identity<index_type>::min();
+  if (red_result.min_loc_true == red_min) {
+    if (num_e1 == num_e2) {
+      return return_type(last1, last2);
+    } else if (num_e1 < num_e2) {
+      return return_type(last1, first2 + num_e1);
+    } else {
+      return return_type(first1 + num_e2, last2);
+    }
+  } else {
+    return return_type(first1 + red_result.min_loc_true,
+                       first2 + red_result.min_loc_true);
+  }
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType1, IteratorType2>
+mismatch_team_impl(const TeamHandleType& teamHandle, IteratorType1 first1,
+                   IteratorType1 last1, IteratorType2 first2,
+                   IteratorType2 last2) {
+  using value_type1 = typename IteratorType1::value_type;
+  using value_type2 = typename IteratorType2::value_type;
+  using pred_t      = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return mismatch_team_impl(teamHandle, first1, last1, first2, last2,
+                            pred_t());
+}
+
 // ------------------------------------------
 // all_of_impl, any_of_impl, none_of_impl
 // ------------------------------------------
@@ -694,6 +920,30 @@ bool none_of_impl(const std::string& label, const ExecutionSpace& ex,
   return (find_if_or_not_impl<true>(label, ex, first, last, predicate) == last);
 }
 
+template <class TeamHandleType, class InputIterator, class Predicate>
+KOKKOS_FUNCTION bool all_of_team_impl(const TeamHandleType& teamHandle,
+                                      InputIterator first, InputIterator last,
+                                      Predicate predicate) {
+  return (find_if_or_not_team_impl<false>(teamHandle, first, last,
+                                          predicate) == last);
+}
+
+template <class TeamHandleType, class InputIterator, class Predicate>
+KOKKOS_FUNCTION bool any_of_team_impl(const TeamHandleType& teamHandle,
+                                      InputIterator first, InputIterator last,
+                                      Predicate predicate) {
+  return (find_if_or_not_team_impl<true>(teamHandle, first, last,
+                                         predicate) != last);
+}
+
+template <class TeamHandleType, class IteratorType, class Predicate>
+KOKKOS_FUNCTION bool none_of_team_impl(const TeamHandleType& teamHandle,
+                                       IteratorType first, IteratorType last,
+                                       Predicate predicate) {
+  return (find_if_or_not_team_impl<true>(teamHandle, first, last,
+                                         predicate) == last);
+}
+
 // ------------------------------------------
 // equal_impl
 // ------------------------------------------
@@ -760,6 +1010,68 @@ bool equal_impl(const std::string& label, const ExecutionSpace& ex,
   return equal_impl(label, ex, first1, last1, first2, last2, pred_t());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION bool equal_team_impl(const TeamHandleType& teamHandle,
+                                     IteratorType1 first1, IteratorType1 last1,
+                                     IteratorType2 first2,
+                                     BinaryPredicateType predicate) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t     = StdEqualFunctor<index_type, IteratorType1, IteratorType2,
+                                 BinaryPredicateType>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+  std::size_t different   = 0;
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_t(first1, first2, predicate), different);
+
+  // no barrier needed because every member gets the reduced value
+  return !different;
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION bool equal_team_impl(const TeamHandleType& teamHandle,
+                                     IteratorType1 first1, IteratorType1 last1,
+                                     IteratorType2 first2) {
+  using value_type1 = typename IteratorType1::value_type;
+  using value_type2 = typename IteratorType2::value_type;
+  using pred_t      = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return equal_team_impl(teamHandle, first1, last1, first2, pred_t());
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION bool equal_team_impl(const TeamHandleType& teamHandle,
+                                     IteratorType1 first1, IteratorType1 last1,
+                                     IteratorType2 first2, IteratorType2 last2,
+                                     BinaryPredicateType predicate) {
+  const auto d1 = ::Kokkos::Experimental::distance(first1, last1);
+  const auto d2 = ::Kokkos::Experimental::distance(first2, last2);
+  if (d1 != d2) {
+    return false;
+  }
+
+  return equal_team_impl(teamHandle, first1, last1, first2, predicate);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION bool equal_team_impl(const TeamHandleType& teamHandle,
+                                     IteratorType1 first1, IteratorType1 last1,
+                                     IteratorType2 first2,
+                                     IteratorType2 last2) {
+  using value_type1 = typename IteratorType1::value_type;
+  using value_type2 = typename IteratorType2::value_type;
+  using pred_t      = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return equal_team_impl(teamHandle, first1, last1, first2, last2, pred_t());
+}
+
 // ------------------------------------------
 // lexicographical_compare_impl
 // ------------------------------------------
@@ -830,6 +1142,60 @@ bool lexicographical_compare_impl(const std::string& label,
                                       predicate_t());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ComparatorType>
+KOKKOS_FUNCTION bool lexicographical_compare_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1, IteratorType1 last1,
+    IteratorType2 first2, IteratorType2 last2, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+  Impl::expect_valid_range(first2, last2);
+
+  // aliases
+  using index_type           = typename IteratorType1::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t =
+      StdLexicographicalCompareFunctor<index_type, IteratorType1, IteratorType2,
+                                       reducer_type, ComparatorType>;
+
+  // run
+  const auto d1    = Kokkos::Experimental::distance(first1, last1);
+  const auto d2    = Kokkos::Experimental::distance(first2, last2);
+  const auto range = Kokkos::Experimental::min(d1, d2);
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, range),
+                            func_t(first1, first2, reducer, comp), reducer);
+
+  // no barrier needed because every member gets the reduced value
+  // no mismatch
+  if (red_result.min_loc_true ==
+      ::Kokkos::reduction_identity<index_type>::min()) {
+    auto new_last1 = first1 + range;
+    auto new_last2 = first2 + range;
+    bool is_prefix = (new_last1 == last1) && (new_last2 != last2);
+    return is_prefix;
+  }
+
+  // check mismatched, every member compares the same pair
+  return comp(first1[red_result.min_loc_true], first2[red_result.min_loc_true]);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION bool lexicographical_compare_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1, IteratorType1 last1,
+    IteratorType2 first2, IteratorType2 last2) {
+  using value_type_1 = typename IteratorType1::value_type;
+  using value_type_2 = typename IteratorType2::value_type;
+  using predicate_t =
+      Impl::StdAlgoLessThanBinaryPredicate<value_type_1, value_type_2>;
+  return lexicographical_compare_team_impl(teamHandle, first1, last1, first2,
+                                           last2, predicate_t());
+}
+
 // ------------------------------------------
 // adjacent_find_impl
 // ------------------------------------------
@@ -858,16 +1224,13 @@ IteratorType adjacent_find_impl(const std::string& label,
 
   // note that we use below num_elements-1 because
   // each index i in the reduction checks i and (i+1).
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements - 1),
-      func_t(first, reducer, pred), reducer);
+  const auto loc = first_loc_chunked_impl(label, ex, num_elements - 1,
+                                          func_t(first, reducer, pred));
 
-  // fence not needed because reducing into scalar
-  if (red_result.min_loc_true ==
-      ::Kokkos::reduction_identity<index_type>::min()) {
+  if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
     return last;
   } else {
-    return first + red_result.min_loc_true;
+    return first + loc;
   }
 }
 
@@ -880,6 +1243,48 @@ IteratorType adjacent_find_impl(const std::string& label,
   return adjacent_find_impl(label, ex, first, last, default_pred_t());
 }
 
+template <class TeamHandleType, class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType adjacent_find_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+
+  if (num_elements <= 1) {
+    return last;
+  }
+
+  using index_type           = typename IteratorType::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t = StdAdjacentFindFunctor<index_type, IteratorType, reducer_type,
+                                        PredicateType>;
+
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements - 1),
+                            func_t(first, reducer, pred), reducer);
+
+  // no barrier needed because every member gets the reduced value
+  if (red_result.min_loc_true ==
+      ::Kokkos::reduction_identity<index_type>::min()) {
+    return last;
+  } else {
+    return first + red_result.min_loc_true;
+  }
+}
+
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION IteratorType adjacent_find_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last) {
+  using value_type     = typename IteratorType::value_type;
+  using default_pred_t = StdAlgoEqualBinaryPredicate<value_type>;
+  return adjacent_find_team_impl(teamHandle, first, last, default_pred_t());
+}
+
 // ------------------------------------------
 // search_impl
 // ------------------------------------------
@@ -932,20 +1337,17 @@ IteratorType1 search_impl(const std::string& label, const ExecutionSpace& ex,
     const auto range_size = num_elements - s_count + 1;
 
     // run par reduce
-    ::Kokkos::parallel_reduce(
-        label, RangePolicy<ExecutionSpace>(ex, 0, range_size),
-        func_t(first, last, s_first, s_last, reducer, pred), reducer);
-
-    // fence not needed because reducing into scalar
+    const auto loc = first_loc_chunked_impl(
+        label, ex, range_size,
+        func_t(first, last, s_first, s_last, reducer, pred));
 
     // decide and return
-    if (red_result.min_loc_true ==
-        ::Kokkos::reduction_identity<index_type>::min()) {
+    if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
       // location has not been found
       return last;
     } else {
       // location has been found
-      return first + red_result.min_loc_true;
+      return first + loc;
     }
   }
 }
@@ -960,6 +1362,79 @@ IteratorType1 search_impl(const std::string& label, const ExecutionSpace& ex,
   return search_impl(label, ex, first, last, s_first, s_last, predicate_type());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION IteratorType1 search_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 s_first, IteratorType2 s_last,
+    const BinaryPredicateType& pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, s_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, s_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(s_first, s_last);
+
+  // the target sequence should not be larger than the range [first, last)
+  namespace KE            = ::Kokkos::Experimental;
+  const auto num_elements = KE::distance(first, last);
+  const auto s_count      = KE::distance(s_first, s_last);
+  KOKKOS_EXPECTS(num_elements >= s_count);
+  (void)s_count;  // needed when macro above is a no-op
+
+  if (s_first == s_last) {
+    return first;
+  }
+
+  if (first == last) {
+    return last;
+  }
+
+  // special case where the two ranges have equal size
+  if (num_elements == s_count) {
+    const auto equal_result =
+        equal_team_impl(teamHandle, first, last, s_first, pred);
+    return (equal_result) ? first : last;
+  } else {
+    using index_type           = typename IteratorType1::difference_type;
+    using reducer_type         = FirstLoc<index_type>;
+    using reduction_value_type = typename reducer_type::value_type;
+    using func_t = StdSearchFunctor<index_type, IteratorType1, IteratorType2,
+                                    reducer_type, BinaryPredicateType>;
+
+    // run
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+
+    // the last feasible index to start looking is the index whose
+    // distance from the "last" is equal to the sequence count
+    const auto range_size = num_elements - s_count + 1;
+    ::Kokkos::parallel_reduce(
+        TeamThreadRange(teamHandle, 0, range_size),
+        func_t(first, last, s_first, s_last, reducer, pred), reducer);
+
+    // no barrier needed because every member gets the reduced value
+    if (red_result.min_loc_true ==
+        ::Kokkos::reduction_identity<index_type>::min()) {
+      return last;
+    } else {
+      return first + red_result.min_loc_true;
+    }
+  }
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType1 search_team_impl(const TeamHandleType& teamHandle,
+                                               IteratorType1 first,
+                                               IteratorType1 last,
+                                               IteratorType2 s_first,
+                                               IteratorType2 s_last) {
+  using value_type1    = typename IteratorType1::value_type;
+  using value_type2    = typename IteratorType2::value_type;
+  using predicate_type = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return search_team_impl(teamHandle, first, last, s_first, s_last,
+                          predicate_type());
+}
+
 // ------------------------------------------
 // search_n_impl
 // ------------------------------------------
@@ -1010,20 +1485,17 @@ IteratorType search_n_impl(const std::string& label, const ExecutionSpace& ex,
     const auto range_size = num_elements - count + 1;
 
     // run par reduce
-    ::Kokkos::parallel_reduce(
-        label, RangePolicy<ExecutionSpace>(ex, 0, range_size),
-        func_t(first, last, count, value, reducer, pred), reducer);
-
-    // fence not needed because reducing into scalar
+    const auto loc = first_loc_chunked_impl<index_type>(
+        label, ex, range_size,
+        func_t(first, last, count, value, reducer, pred));
 
     // decide and return
-    if (red_result.min_loc_true ==
-        ::Kokkos::reduction_identity<index_type>::min()) {
+    if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
       // location has not been found
       return last;
     } else {
       // location has been found
-      return first + red_result.min_loc_true;
+      return first + loc;
     }
   }
 }
@@ -1056,6 +1528,74 @@ IteratorType search_n_impl(const std::string& label, const ExecutionSpace& ex,
   return search_n_impl(label, ex, first, last, count, value, predicate_type());
 }
 
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class ValueType, class BinaryPredicateType>
+KOKKOS_FUNCTION IteratorType search_n_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    SizeType count, const ValueType& value, const BinaryPredicateType& pred) {
+  // checks
+  static_assert_random_access_and_accessible(teamHandle, first);
+  expect_valid_range(first, last);
+  KOKKOS_EXPECTS((std::ptrdiff_t)count >= 0);
+
+  // count should not be larger than the range [first, last)
+  namespace KE            = ::Kokkos::Experimental;
+  const auto num_elements = KE::distance(first, last);
+  // cast things to avoid compiler warning
+  KOKKOS_EXPECTS((std::size_t)num_elements >= (std::size_t)count);
+
+  if (first == last) {
+    return first;
+  }
+
+  // special case where num elements in [first, last) == count
+  if ((std::size_t)num_elements == (std::size_t)count) {
+    using equal_to_value = StdAlgoEqualsValUnaryPredicate<ValueType>;
+    const auto satisfies =
+        all_of_team_impl(teamHandle, first, last, equal_to_value(value));
+    return (satisfies) ? first : last;
+  } else {
+    // aliases
+    using index_type           = typename IteratorType::difference_type;
+    using reducer_type         = FirstLoc<index_type>;
+    using reduction_value_type = typename reducer_type::value_type;
+    using func_t =
+        StdSearchNFunctor<index_type, IteratorType, SizeType, ValueType,
+                          reducer_type, BinaryPredicateType>;
+
+    // run
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+
+    // the last feasible index to start looking is the index
+    // whose distance from the "last" is equal to count
+    const auto range_size = num_elements - count + 1;
+    ::Kokkos::parallel_reduce(
+        TeamThreadRange(teamHandle, 0, range_size),
+        func_t(first, last, count, value, reducer, pred), reducer);
+
+    // no barrier needed because every member gets the reduced value
+    if (red_result.min_loc_true ==
+        ::Kokkos::reduction_identity<index_type>::min()) {
+      return last;
+    } else {
+      return first + red_result.min_loc_true;
+    }
+  }
+}
+
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class ValueType>
+KOKKOS_FUNCTION IteratorType search_n_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    SizeType count, const ValueType& value) {
+  using iter_value_type = typename IteratorType::value_type;
+  using predicate_type =
+      StdAlgoEqualBinaryPredicate<iter_value_type, ValueType>;
+  return search_n_team_impl(teamHandle, first, last, count, value,
+                            predicate_type());
+}
+
 // ------------------------------------------
 // find_first_of_impl
 // ------------------------------------------
@@ -1086,20 +1626,17 @@ IteratorType1 find_first_of_impl(const std::string& label,
   reduction_value_type red_result;
   reducer_type reducer(red_result);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
-      func_t(first, s_first, s_last, reducer, pred), reducer);
 
-  // fence not needed because reducing into scalar
+  const auto loc = first_loc_chunked_impl(
+      label, ex, num_elements, func_t(first, s_first, s_last, reducer, pred));
 
   // decide and return
-  if (red_result.min_loc_true ==
-      ::Kokkos::reduction_identity<index_type>::min()) {
+  if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
     // if here, nothing found
     return last;
   } else {
     // a location has been found
-    return first + red_result.min_loc_true;
+    return first + loc;
   }
 }
 
@@ -1115,6 +1652,56 @@ IteratorType1 find_first_of_impl(const std::string& label,
                             predicate_type());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION IteratorType1 find_first_of_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 s_first, IteratorType2 s_last,
+    const BinaryPredicateType& pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, s_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, s_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(s_first, s_last);
+
+  if ((s_first == s_last) || (first == last)) {
+    return last;
+  }
+
+  using index_type           = typename IteratorType1::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using func_t = StdFindFirstOfFunctor<index_type, IteratorType1, IteratorType2,
+                                       reducer_type, BinaryPredicateType>;
+
+  // run
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_t(first, s_first, s_last, reducer, pred),
+                            reducer);
+
+  // no barrier needed because every member gets the reduced value
+  if (red_result.min_loc_true ==
+      ::Kokkos::reduction_identity<index_type>::min()) {
+    return last;
+  } else {
+    return first + red_result.min_loc_true;
+  }
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType1 find_first_of_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 s_first, IteratorType2 s_last) {
+  using value_type1    = typename IteratorType1::value_type;
+  using value_type2    = typename IteratorType2::value_type;
+  using predicate_type = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return find_first_of_team_impl(teamHandle, first, last, s_first, s_last,
+                                 predicate_type());
+}
+
 // ------------------------------------------
 // find_end_impl
 // ------------------------------------------
@@ -1196,12 +1783,84 @@ IteratorType1 find_end_impl(const std::string& label, const ExecutionSpace& ex,
                        predicate_type());
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType>
+KOKKOS_FUNCTION IteratorType1 find_end_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 s_first, IteratorType2 s_last,
+    const BinaryPredicateType& pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, s_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, s_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(s_first, s_last);
+
+  // the target sequence should not be larger than the range [first, last)
+  namespace KE            = ::Kokkos::Experimental;
+  const auto num_elements = KE::distance(first, last);
+  const auto s_count      = KE::distance(s_first, s_last);
+  KOKKOS_EXPECTS(num_elements >= s_count);
+  (void)s_count;  // needed when macro above is a no-op
+
+  if (s_first == s_last) {
+    return last;
+  }
+
+  if (first == last) {
+    return last;
+  }
+
+  // special case where the two ranges have equal size
+  if (num_elements == s_count) {
+    const auto equal_result =
+        equal_team_impl(teamHandle, first, last, s_first, pred);
+    return (equal_result) ? first : last;
+  } else {
+    using index_type           = typename IteratorType1::difference_type;
+    using reducer_type         = LastLoc<index_type>;
+    using reduction_value_type = typename reducer_type::value_type;
+    using func_t = StdFindEndFunctor<index_type, IteratorType1, IteratorType2,
+                                     reducer_type, BinaryPredicateType>;
+
+    // run
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+
+    // the last feasible index to start looking is the index whose
+    // distance from the "last" is equal to the sequence count
+    const auto range_size = num_elements - s_count + 1;
+    ::Kokkos::parallel_reduce(
+        TeamThreadRange(teamHandle, 0, range_size),
+        func_t(first, last, s_first, s_last, reducer, pred), reducer);
+
+    // no barrier needed because every member gets the reduced value
+    if (red_result.max_loc_true ==
+        ::Kokkos::reduction_identity<index_type>::max()) {
+      return last;
+    } else {
+      return first + red_result.max_loc_true;
+    }
+  }
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType1 find_end_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 s_first, IteratorType2 s_last) {
+  using value_type1    = typename IteratorType1::value_type;
+  using value_type2    = typename IteratorType2::value_type;
+  using predicate_type = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+  return find_end_team_impl(teamHandle, first, last, s_first, s_last,
+                            predicate_type());
+}
+
 }  // namespace Impl
 
 // ----------------------------------
 // find public API
 // ----------------------------------
-template <class ExecutionSpace, class InputIterator, class T>
+template <class ExecutionSpace, class InputIterator, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 InputIterator find(const ExecutionSpace& ex, InputIterator first,
                    InputIterator last, const T& value) {
   return Impl::find_impl("Kokkos::find_iterator_api_default", ex, first, last,
@@ -1214,7 +1873,8 @@ InputIterator find(const std::string& label, const ExecutionSpace& ex,
   return Impl::find_impl(label, ex, first, last, value);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties, class T>
+template <class ExecutionSpace, class DataType, class... Properties, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find(const ExecutionSpace& ex,
           const ::Kokkos::View<DataType, Properties...>& view, const T& value) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
@@ -1233,10 +1893,32 @@ auto find(const std::string& label, const ExecutionSpace& ex,
   return Impl::find_impl(label, ex, KE::begin(view), KE::end(view), value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION InputIterator find(const TeamHandleType& teamHandle,
+                                   InputIterator first, InputIterator last,
+                                   const T& value) {
+  return Impl::find_team_impl(teamHandle, first, last, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find(const TeamHandleType& teamHandle,
+                          const ::Kokkos::View<DataType, Properties...>& view,
+                          const T& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                              value);
+}
+
 // -------------------
 // find_if public API
 // -------------------
-template <class ExecutionSpace, class IteratorType, class PredicateType>
+template <class ExecutionSpace, class IteratorType, class PredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType find_if(const ExecutionSpace& ex, IteratorType first,
                      IteratorType last, PredicateType predicate) {
   return Impl::find_if_or_not_impl<true>("Kokkos::find_if_iterator_api_default",
@@ -1252,7 +1934,7 @@ IteratorType find_if(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_if(const ExecutionSpace& ex,
              const ::Kokkos::View<DataType, Properties...>& v,
              Predicate predicate) {
@@ -1274,10 +1956,35 @@ auto find_if(const std::string& label, const ExecutionSpace& ex,
                                          std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class PredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType find_if(const TeamHandleType& teamHandle,
+                                     IteratorType first, IteratorType last,
+                                     PredicateType predicate) {
+  return Impl::find_if_or_not_team_impl<true>(teamHandle, first, last,
+                                              std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class PredicateType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    PredicateType predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_if_or_not_team_impl<true>(teamHandle, KE::begin(view),
+                                              KE::end(view),
+                                              std::move(predicate));
+}
+
 // ----------------------------------
 // find_if_not public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType, class Predicate>
+template <class ExecutionSpace, class IteratorType, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType find_if_not(const ExecutionSpace& ex, IteratorType first,
                          IteratorType last, Predicate predicate) {
   return Impl::find_if_or_not_impl<false>(
@@ -1294,7 +2001,7 @@ IteratorType find_if_not(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_if_not(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& v,
                  Predicate predicate) {
@@ -1318,6 +2025,30 @@ auto find_if_not(const std::string& label, const ExecutionSpace& ex,
                                           std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class PredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType find_if_not(const TeamHandleType& teamHandle,
+                                         IteratorType first, IteratorType last,
+                                         PredicateType predicate) {
+  return Impl::find_if_or_not_team_impl<false>(teamHandle, first, last,
+                                               std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class PredicateType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_if_not(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    PredicateType predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_if_or_not_team_impl<false>(teamHandle, KE::begin(view),
+                                               KE::end(view),
+                                               std::move(predicate));
+}
+
 // ----------------------------------
 // for_each public API
 // ----------------------------------
@@ -1328,7 +2059,8 @@ UnaryFunctorType for_each(const std::string& label, const ExecutionSpace& ex,
   return Impl::for_each_impl(label, ex, first, last, std::move(functor));
 }
 
-template <class ExecutionSpace, class IteratorType, class UnaryFunctorType>
+template <class ExecutionSpace, class IteratorType, class UnaryFunctorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 UnaryFunctorType for_each(const ExecutionSpace& ex, IteratorType first,
                           IteratorType last, UnaryFunctorType functor) {
   return Impl::for_each_impl("Kokkos::for_each_iterator_api_default", ex, first,
@@ -1348,7 +2080,8 @@ UnaryFunctorType for_each(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class UnaryFunctorType>
+          class UnaryFunctorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 UnaryFunctorType for_each(const ExecutionSpace& ex,
                           const ::Kokkos::View<DataType, Properties...>& v,
                           UnaryFunctorType functor) {
@@ -1359,6 +2092,29 @@ UnaryFunctorType for_each(const ExecutionSpace& ex,
                              KE::begin(v), KE::end(v), std::move(functor));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class UnaryFunctorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION UnaryFunctorType for_each(const TeamHandleType& teamHandle,
+                                          IteratorType first, IteratorType last,
+                                          UnaryFunctorType functor) {
+  return Impl::for_each_team_impl(teamHandle, first, last, std::move(functor));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class UnaryFunctorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION UnaryFunctorType for_each(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    UnaryFunctorType functor) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::for_each_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                  std::move(functor));
+}
+
 // ----------------------------------
 // for_each_n public API
 // ----------------------------------
@@ -1371,7 +2127,8 @@ IteratorType for_each_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class IteratorType, class SizeType,
-          class UnaryFunctorType>
+          class UnaryFunctorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType for_each_n(const ExecutionSpace& ex, IteratorType first,
                         SizeType n, UnaryFunctorType functor) {
   return Impl::for_each_n_impl("Kokkos::for_each_n_iterator_api_default", ex,
@@ -1390,7 +2147,8 @@ auto for_each_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class SizeType, class UnaryFunctorType>
+          class SizeType, class UnaryFunctorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto for_each_n(const ExecutionSpace& ex,
                 const ::Kokkos::View<DataType, Properties...>& v, SizeType n,
                 UnaryFunctorType functor) {
@@ -1401,10 +2159,35 @@ auto for_each_n(const ExecutionSpace& ex,
                                KE::begin(v), n, std::move(functor));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class UnaryFunctorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType for_each_n(const TeamHandleType& teamHandle,
+                                        IteratorType first, SizeType n,
+                                        UnaryFunctorType functor) {
+  return Impl::for_each_n_team_impl(teamHandle, first, n, std::move(functor));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class SizeType, class UnaryFunctorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto for_each_n(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, SizeType n,
+    UnaryFunctorType functor) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::for_each_n_team_impl(teamHandle, KE::begin(view), n,
+                                    std::move(functor));
+}
+
 // ----------------------------------
 // count_if public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType, class Predicate>
+template <class ExecutionSpace, class IteratorType, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 typename IteratorType::difference_type count_if(const ExecutionSpace& ex,
                                                 IteratorType first,
                                                 IteratorType last,
@@ -1423,7 +2206,7 @@ typename IteratorType::difference_type count_if(const std::string& label,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto count_if(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType, Properties...>& v,
               Predicate predicate) {
@@ -1446,10 +2229,33 @@ auto count_if(const std::string& label, const ExecutionSpace& ex,
                              std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Predicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION typename IteratorType::difference_type
+count_if(const TeamHandleType& teamHandle, IteratorType first,
+         IteratorType last, Predicate predicate) {
+  return Impl::count_if_team_impl(teamHandle, first, last,
+                                  std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class Predicate, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto count_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, Predicate predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::count_if_team_impl(teamHandle, KE::cbegin(view), KE::cend(view),
+                                  std::move(predicate));
+}
+
 // ----------------------------------
 // count public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType, class T>
+template <class ExecutionSpace, class IteratorType, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 typename IteratorType::difference_type count(const ExecutionSpace& ex,
                                              IteratorType first,
                                              IteratorType last,
@@ -1467,7 +2273,8 @@ typename IteratorType::difference_type count(const std::string& label,
   return Impl::count_impl(label, ex, first, last, value);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties, class T>
+template <class ExecutionSpace, class DataType, class... Properties, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto count(const ExecutionSpace& ex,
            const ::Kokkos::View<DataType, Properties...>& v, const T& value) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
@@ -1486,6 +2293,27 @@ auto count(const std::string& label, const ExecutionSpace& ex,
   return Impl::count_impl(label, ex, KE::cbegin(v), KE::cend(v), value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION typename IteratorType::difference_type
+count(const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+      const T& value) {
+  return Impl::count_team_impl(teamHandle, first, last, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto count(const TeamHandleType& teamHandle,
+                           const ::Kokkos::View<DataType, Properties...>& view,
+                           const T& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::count_team_impl(teamHandle, KE::cbegin(view), KE::cend(view),
+                               value);
+}
+
 // ----------------------------------
 // mismatch public API
 // ----------------------------------
@@ -1496,7 +2324,8 @@ auto count(const std::string& label, const ExecutionSpace& ex,
 //
 // makes API ambiguous (with the overload accepting views).
 
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ::Kokkos::pair<IteratorType1, IteratorType2> mismatch(const ExecutionSpace& ex,
                                                       IteratorType1 first1,
                                                       IteratorType1 last1,
@@ -1507,7 +2336,8 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2>
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ::Kokkos::pair<IteratorType1, IteratorType2> mismatch(
     const ExecutionSpace& ex, IteratorType1 first1, IteratorType1 last1,
     IteratorType2 first2, IteratorType2 last2,
@@ -1535,7 +2365,8 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto mismatch(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType1, Properties1...>& view1,
               const ::Kokkos::View<DataType2, Properties2...>& view2) {
@@ -1549,7 +2380,8 @@ auto mismatch(const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicateType>
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto mismatch(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType1, Properties1...>& view1,
               const ::Kokkos::View<DataType2, Properties2...>& view2,
@@ -1592,10 +2424,63 @@ auto mismatch(const std::string& label, const ExecutionSpace& ex,
                              std::forward<BinaryPredicateType>(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType1, IteratorType2>
+mismatch(const TeamHandleType& teamHandle, IteratorType1 first1,
+         IteratorType1 last1, IteratorType2 first2, IteratorType2 last2) {
+  return Impl::mismatch_team_impl(teamHandle, first1, last1, first2, last2);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ::Kokkos::pair<IteratorType1, IteratorType2>
+mismatch(const TeamHandleType& teamHandle, IteratorType1 first1,
+         IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+         BinaryPredicateType predicate) {
+  return Impl::mismatch_team_impl(teamHandle, first1, last1, first2, last2,
+                                  std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto mismatch(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::mismatch_team_impl(teamHandle, KE::begin(view1), KE::end(view1),
+                                  KE::begin(view2), KE::end(view2));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto mismatch(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2,
+    BinaryPredicateType predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::mismatch_team_impl(teamHandle, KE::begin(view1), KE::end(view1),
+                                  KE::begin(view2), KE::end(view2),
+                                  std::move(predicate));
+}
+
 // ----------------------------------
 // all_of public API
 // ----------------------------------
-template <class ExecutionSpace, class InputIterator, class Predicate>
+template <class ExecutionSpace, class InputIterator, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool all_of(const ExecutionSpace& ex, InputIterator first, InputIterator last,
             Predicate predicate) {
   return Impl::all_of_impl("Kokkos::all_of_iterator_api_default", ex, first,
@@ -1609,7 +2494,7 @@ bool all_of(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool all_of(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& v,
             Predicate predicate) {
@@ -1632,10 +2517,32 @@ bool all_of(const std::string& label, const ExecutionSpace& ex,
                            std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Predicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool all_of(const TeamHandleType& teamHandle,
+                            IteratorType first, IteratorType last,
+                            Predicate predicate) {
+  return Impl::all_of_team_impl(teamHandle, first, last, std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class Predicate, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto all_of(const TeamHandleType& teamHandle,
+                            const ::Kokkos::View<DataType, Properties...>& view,
+                            Predicate predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::all_of_team_impl(teamHandle, KE::cbegin(view), KE::cend(view),
+                                std::move(predicate));
+}
+
 // ----------------------------------
 // any_of public API
 // ----------------------------------
-template <class ExecutionSpace, class InputIterator, class Predicate>
+template <class ExecutionSpace, class InputIterator, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool any_of(const ExecutionSpace& ex, InputIterator first, InputIterator last,
             Predicate predicate) {
   return Impl::any_of_impl("Kokkos::any_of_view_api_default", ex, first, last,
@@ -1649,7 +2556,7 @@ bool any_of(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool any_of(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& v,
             Predicate predicate) {
@@ -1672,10 +2579,32 @@ bool any_of(const std::string& label, const ExecutionSpace& ex,
                            std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Predicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool any_of(const TeamHandleType& teamHandle,
+                            IteratorType first, IteratorType last,
+                            Predicate predicate) {
+  return Impl::any_of_team_impl(teamHandle, first, last, std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class Predicate, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto any_of(const TeamHandleType& teamHandle,
+                            const ::Kokkos::View<DataType, Properties...>& view,
+                            Predicate predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::any_of_team_impl(teamHandle, KE::cbegin(view), KE::cend(view),
+                                std::move(predicate));
+}
+
 // ----------------------------------
 // none_of public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType, class Predicate>
+template <class ExecutionSpace, class IteratorType, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool none_of(const ExecutionSpace& ex, IteratorType first, IteratorType last,
              Predicate predicate) {
   return Impl::none_of_impl("Kokkos::none_of_iterator_api_default", ex, first,
@@ -1689,7 +2618,7 @@ bool none_of(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool none_of(const ExecutionSpace& ex,
              const ::Kokkos::View<DataType, Properties...>& v,
              Predicate predicate) {
@@ -1712,10 +2641,32 @@ bool none_of(const std::string& label, const ExecutionSpace& ex,
                             std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Predicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool none_of(const TeamHandleType& teamHandle,
+                             IteratorType first, IteratorType last,
+                             Predicate predicate) {
+  return Impl::none_of_team_impl(teamHandle, first, last, std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class Predicate, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto none_of(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, Predicate predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::none_of_team_impl(teamHandle, KE::cbegin(view), KE::cend(view),
+                                 std::move(predicate));
+}
+
 // ----------------------------------
 // equal public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       IteratorType1, IteratorType2>::value,
                   bool>
@@ -1735,7 +2686,8 @@ equal(const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       IteratorType1, IteratorType2>::value,
                   bool>
@@ -1758,7 +2710,8 @@ equal(const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool equal(const ExecutionSpace& ex,
            const ::Kokkos::View<DataType1, Properties1...>& view1,
            ::Kokkos::View<DataType2, Properties2...>& view2) {
@@ -1785,7 +2738,8 @@ bool equal(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicateType>
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool equal(const ExecutionSpace& ex,
            const ::Kokkos::View<DataType1, Properties1...>& view1,
            ::Kokkos::View<DataType2, Properties2...>& view2,
@@ -1813,7 +2767,8 @@ bool equal(const std::string& label, const ExecutionSpace& ex,
                           KE::cbegin(view2), std::move(predicate));
 }
 
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       IteratorType1, IteratorType2>::value,
                   bool>
@@ -1833,7 +2788,8 @@ equal(const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       IteratorType1, IteratorType2>::value,
                   bool>
@@ -1856,10 +2812,93 @@ equal(const std::string& label, const ExecutionSpace& ex, IteratorType1 first1,
                           std::move(predicate));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      IteratorType1, IteratorType2>::value,
+                  bool>
+equal(const TeamHandleType& teamHandle, IteratorType1 first1,
+      IteratorType1 last1, IteratorType2 first2) {
+  return Impl::equal_team_impl(teamHandle, first1, last1, first2);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      IteratorType1, IteratorType2>::value,
+                  bool>
+equal(const TeamHandleType& teamHandle, IteratorType1 first1,
+      IteratorType1 last1, IteratorType2 first2,
+      BinaryPredicateType predicate) {
+  return Impl::equal_team_impl(teamHandle, first1, last1, first2,
+                               std::move(predicate));
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      IteratorType1, IteratorType2>::value,
+                  bool>
+equal(const TeamHandleType& teamHandle, IteratorType1 first1,
+      IteratorType1 last1, IteratorType2 first2, IteratorType2 last2) {
+  return Impl::equal_team_impl(teamHandle, first1, last1, first2, last2);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      IteratorType1, IteratorType2>::value,
+                  bool>
+equal(const TeamHandleType& teamHandle, IteratorType1 first1,
+      IteratorType1 last1, IteratorType2 first2, IteratorType2 last2,
+      BinaryPredicateType predicate) {
+  return Impl::equal_team_impl(teamHandle, first1, last1, first2, last2,
+                               std::move(predicate));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool equal(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_team_impl(teamHandle, KE::cbegin(view1), KE::cend(view1),
+                               KE::cbegin(view2));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool equal(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2,
+    BinaryPredicateType predicate) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::equal_team_impl(teamHandle, KE::cbegin(view1), KE::cend(view1),
+                               KE::cbegin(view2), std::move(predicate));
+}
+
 // ----------------------------------
 // lexicographical_compare public API
 // ----------------------------------
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool lexicographical_compare(const ExecutionSpace& ex, IteratorType1 first1,
                              IteratorType1 last1, IteratorType2 first2,
                              IteratorType2 last2) {
@@ -1877,7 +2916,8 @@ bool lexicographical_compare(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool lexicographical_compare(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view1,
@@ -1907,7 +2947,8 @@ bool lexicographical_compare(
 }
 
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class ComparatorType>
+          class ComparatorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool lexicographical_compare(const ExecutionSpace& ex, IteratorType1 first1,
                              IteratorType1 last1, IteratorType2 first2,
                              IteratorType2 last2, ComparatorType comp) {
@@ -1927,7 +2968,8 @@ bool lexicographical_compare(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class ComparatorType>
+          class DataType2, class... Properties2, class ComparatorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 bool lexicographical_compare(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view1,
@@ -1956,11 +2998,67 @@ bool lexicographical_compare(
                                             KE::cend(view2), comp);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool lexicographical_compare(const TeamHandleType& teamHandle,
+                                             IteratorType1 first1,
+                                             IteratorType1 last1,
+                                             IteratorType2 first2,
+                                             IteratorType2 last2) {
+  return Impl::lexicographical_compare_team_impl(teamHandle, first1, last1,
+                                                 first2, last2);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ComparatorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool lexicographical_compare(
+    const TeamHandleType& teamHandle, IteratorType1 first1, IteratorType1 last1,
+    IteratorType2 first2, IteratorType2 last2, ComparatorType comp) {
+  return Impl::lexicographical_compare_team_impl(teamHandle, first1, last1,
+                                                 first2, last2, comp);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool lexicographical_compare(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lexicographical_compare_team_impl(
+      teamHandle, KE::cbegin(view1), KE::cend(view1), KE::cbegin(view2),
+      KE::cend(view2));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ComparatorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION bool lexicographical_compare(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view1,
+    const ::Kokkos::View<DataType2, Properties2...>& view2,
+    ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view2);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::lexicographical_compare_team_impl(
+      teamHandle, KE::cbegin(view1), KE::cend(view1), KE::cbegin(view2),
+      KE::cend(view2), comp);
+}
+
 // ----------------------------------
 // adjacent_find
 // ----------------------------------
 // overload set1
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType adjacent_find(const ExecutionSpace& ex, IteratorType first,
                            IteratorType last) {
   return Impl::adjacent_find_impl("Kokkos::adjacent_find_iterator_api_default",
@@ -1973,7 +3071,8 @@ IteratorType adjacent_find(const std::string& label, const ExecutionSpace& ex,
   return Impl::adjacent_find_impl(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto adjacent_find(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType, Properties...>& v) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
@@ -1991,7 +3090,8 @@ auto adjacent_find(const std::string& label, const ExecutionSpace& ex,
 }
 
 // overload set2
-template <class ExecutionSpace, class IteratorType, class BinaryPredicateType>
+template <class ExecutionSpace, class IteratorType, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType adjacent_find(const ExecutionSpace& ex, IteratorType first,
                            IteratorType last, BinaryPredicateType pred) {
   return Impl::adjacent_find_impl("Kokkos::adjacent_find_iterator_api_default",
@@ -2006,7 +3106,8 @@ IteratorType adjacent_find(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto adjacent_find(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType, Properties...>& v,
                    BinaryPredicateType pred) {
@@ -2026,11 +3127,56 @@ auto adjacent_find(const std::string& label, const ExecutionSpace& ex,
   return Impl::adjacent_find_impl(label, ex, KE::begin(v), KE::end(v), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType adjacent_find(const TeamHandleType& teamHandle,
+                                           IteratorType first,
+                                           IteratorType last) {
+  return Impl::adjacent_find_team_impl(teamHandle, first, last);
+}
+
+template <class TeamHandleType, class IteratorType, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType adjacent_find(const TeamHandleType& teamHandle,
+                                           IteratorType first,
+                                           IteratorType last,
+                                           BinaryPredicateType pred) {
+  return Impl::adjacent_find_team_impl(teamHandle, first, last, pred);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto adjacent_find(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::adjacent_find_team_impl(teamHandle, KE::begin(view),
+                                       KE::end(view));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto adjacent_find(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    BinaryPredicateType pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::adjacent_find_team_impl(teamHandle, KE::begin(view),
+                                       KE::end(view), pred);
+}
+
 // ----------------------------------
 // search
 // ----------------------------------
 // overload set 1: no binary predicate passed
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 search(const ExecutionSpace& ex, IteratorType1 first,
                      IteratorType1 last, IteratorType2 s_first,
                      IteratorType2 s_last) {
@@ -2046,7 +3192,8 @@ IteratorType1 search(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto search(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType1, Properties1...>& view,
             const ::Kokkos::View<DataType2, Properties2...>& s_view) {
@@ -2074,7 +3221,8 @@ auto search(const std::string& label, const ExecutionSpace& ex,
 
 // overload set 2: binary predicate passed
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 search(const ExecutionSpace& ex, IteratorType1 first,
                      IteratorType1 last, IteratorType2 s_first,
                      IteratorType2 s_last, const BinaryPredicateType& pred) {
@@ -2092,7 +3240,8 @@ IteratorType1 search(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicateType>
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto search(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType1, Properties1...>& view,
             const ::Kokkos::View<DataType2, Properties2...>& s_view,
@@ -2120,11 +3269,64 @@ auto search(const std::string& label, const ExecutionSpace& ex,
                            KE::begin(s_view), KE::end(s_view), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 search(const TeamHandleType& teamHandle,
+                                     IteratorType1 first, IteratorType1 last,
+                                     IteratorType2 s_first,
+                                     IteratorType2 s_last) {
+  return Impl::search_team_impl(teamHandle, first, last, s_first, s_last);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 search(const TeamHandleType& teamHandle,
+                                     IteratorType1 first, IteratorType1 last,
+                                     IteratorType2 s_first,
+                                     IteratorType2 s_last,
+                                     const BinaryPredicateType& pred) {
+  return Impl::search_team_impl(teamHandle, first, last, s_first, s_last, pred);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto search(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::search_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                KE::begin(s_view), KE::end(s_view));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto search(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view,
+    const BinaryPredicateType& pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::search_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                KE::begin(s_view), KE::end(s_view), pred);
+}
+
 // ----------------------------------
 // find_first_of
 // ----------------------------------
 // overload set 1: no binary predicate passed
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 find_first_of(const ExecutionSpace& ex, IteratorType1 first,
                             IteratorType1 last, IteratorType2 s_first,
                             IteratorType2 s_last) {
@@ -2140,7 +3342,8 @@ IteratorType1 find_first_of(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_first_of(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType1, Properties1...>& view,
                    const ::Kokkos::View<DataType2, Properties2...>& s_view) {
@@ -2168,7 +3371,8 @@ auto find_first_of(const std::string& label, const ExecutionSpace& ex,
 
 // overload set 2: binary predicate passed
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 find_first_of(const ExecutionSpace& ex, IteratorType1 first,
                             IteratorType1 last, IteratorType2 s_first,
                             IteratorType2 s_last,
@@ -2188,7 +3392,8 @@ IteratorType1 find_first_of(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicateType>
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_first_of(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType1, Properties1...>& view,
                    const ::Kokkos::View<DataType2, Properties2...>& s_view,
@@ -2216,12 +3421,70 @@ auto find_first_of(const std::string& label, const ExecutionSpace& ex,
                                   KE::begin(s_view), KE::end(s_view), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 find_first_of(const TeamHandleType& teamHandle,
+                                            IteratorType1 first,
+                                            IteratorType1 last,
+                                            IteratorType2 s_first,
+                                            IteratorType2 s_last) {
+  return Impl::find_first_of_team_impl(teamHandle, first, last, s_first,
+                                       s_last);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 find_first_of(const TeamHandleType& teamHandle,
+                                            IteratorType1 first,
+                                            IteratorType1 last,
+                                            IteratorType2 s_first,
+                                            IteratorType2 s_last,
+                                            const BinaryPredicateType& pred) {
+  return Impl::find_first_of_team_impl(teamHandle, first, last, s_first, s_last,
+                                       pred);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_first_of(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_first_of_team_impl(teamHandle, KE::begin(view),
+                                       KE::end(view), KE::begin(s_view),
+                                       KE::end(s_view));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_first_of(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view,
+    const BinaryPredicateType& pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_first_of_team_impl(teamHandle, KE::begin(view),
+                                       KE::end(view), KE::begin(s_view),
+                                       KE::end(s_view), pred);
+}
+
 // ----------------------------------
 // search_n
 // ----------------------------------
 // overload set 1: no binary predicate passed
 template <class ExecutionSpace, class IteratorType, class SizeType,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType search_n(const ExecutionSpace& ex, IteratorType first,
                       IteratorType last, SizeType count,
                       const ValueType& value) {
@@ -2238,7 +3501,8 @@ IteratorType search_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class SizeType, class ValueType>
+          class SizeType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto search_n(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType, Properties...>& view,
               SizeType count, const ValueType& value) {
@@ -2263,7 +3527,8 @@ auto search_n(const std::string& label, const ExecutionSpace& ex,
 
 // overload set 2: binary predicate passed
 template <class ExecutionSpace, class IteratorType, class SizeType,
-          class ValueType, class BinaryPredicateType>
+          class ValueType, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType search_n(const ExecutionSpace& ex, IteratorType first,
                       IteratorType last, SizeType count, const ValueType& value,
                       const BinaryPredicateType& pred) {
@@ -2280,7 +3545,8 @@ IteratorType search_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class SizeType, class ValueType, class BinaryPredicateType>
+          class SizeType, class ValueType, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto search_n(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType, Properties...>& view,
               SizeType count, const ValueType& value,
@@ -2306,11 +3572,59 @@ auto search_n(const std::string& label, const ExecutionSpace& ex,
                              value, pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType search_n(const TeamHandleType& teamHandle,
+                                      IteratorType first, IteratorType last,
+                                      SizeType count, const ValueType& value) {
+  return Impl::search_n_team_impl(teamHandle, first, last, count, value);
+}
+
+template <class TeamHandleType, class IteratorType, class SizeType,
+          class ValueType, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType search_n(const TeamHandleType& teamHandle,
+                                      IteratorType first, IteratorType last,
+                                      SizeType count, const ValueType& value,
+                                      const BinaryPredicateType& pred) {
+  return Impl::search_n_team_impl(teamHandle, first, last, count, value, pred);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class SizeType, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto search_n(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, SizeType count,
+    const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::search_n_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                  count, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class SizeType, class ValueType, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto search_n(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, SizeType count,
+    const ValueType& value, const BinaryPredicateType& pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::search_n_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                  count, value, pred);
+}
+
 // ----------------------------------
 // find_end
 // ----------------------------------
 // overload set 1: no binary predicate passed
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 find_end(const ExecutionSpace& ex, IteratorType1 first,
                        IteratorType1 last, IteratorType2 s_first,
                        IteratorType2 s_last) {
@@ -2326,7 +3640,8 @@ IteratorType1 find_end(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_end(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType1, Properties1...>& view,
               const ::Kokkos::View<DataType2, Properties2...>& s_view) {
@@ -2354,7 +3669,8 @@ auto find_end(const std::string& label, const ExecutionSpace& ex,
 
 // overload set 2: binary predicate passed
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class BinaryPredicateType>
+          class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType1 find_end(const ExecutionSpace& ex, IteratorType1 first,
                        IteratorType1 last, IteratorType2 s_first,
                        IteratorType2 s_last, const BinaryPredicateType& pred) {
@@ -2372,7 +3688,8 @@ IteratorType1 find_end(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicateType>
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto find_end(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType1, Properties1...>& view,
               const ::Kokkos::View<DataType2, Properties2...>& s_view,
@@ -2400,6 +3717,59 @@ auto find_end(const std::string& label, const ExecutionSpace& ex,
                              KE::begin(s_view), KE::end(s_view), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 find_end(const TeamHandleType& teamHandle,
+                                       IteratorType1 first, IteratorType1 last,
+                                       IteratorType2 s_first,
+                                       IteratorType2 s_last) {
+  return Impl::find_end_team_impl(teamHandle, first, last, s_first, s_last);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType1 find_end(const TeamHandleType& teamHandle,
+                                       IteratorType1 first, IteratorType1 last,
+                                       IteratorType2 s_first,
+                                       IteratorType2 s_last,
+                                       const BinaryPredicateType& pred) {
+  return Impl::find_end_team_impl(teamHandle, first, last, s_first, s_last,
+                                  pred);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_end(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_end_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                  KE::begin(s_view), KE::end(s_view));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicateType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto find_end(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ::Kokkos::View<DataType2, Properties2...>& s_view,
+    const BinaryPredicateType& pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(s_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::find_end_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                  KE::begin(s_view), KE::end(s_view), pred);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
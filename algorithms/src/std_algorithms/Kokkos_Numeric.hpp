@@ -56,4 +56,9 @@
 #include "./numeric/Kokkos_Reduce.hpp"
 #include "./numeric/Kokkos_TransformReduce.hpp"
 
+// contains inclusive_scan_by_key, exclusive_scan_by_key
+#include "./numeric/Kokkos_ScanByKey.hpp"
+
+#include "./numeric/Kokkos_ReduceByKey.hpp"
+
 #endif
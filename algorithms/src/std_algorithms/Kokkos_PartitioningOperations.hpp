@@ -49,6 +49,7 @@
 #include "Kokkos_BeginEnd.hpp"
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_ModifyingOperations.hpp"
+#include "Kokkos_ModifyingSequenceOperations.hpp"
 #include "Kokkos_NonModifyingSequenceOperations.hpp"
 
 namespace Kokkos {
@@ -352,6 +353,70 @@ partition_copy_impl(const std::string& label, const ExecutionSpace& ex,
           to_first_false + counts.false_count_};
 }
 
+// ------------------------------------------
+// stable_partition_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class PredicateType>
+IteratorType stable_partition_impl(const std::string& label,
+                                   const ExecutionSpace& ex,
+                                   IteratorType first, IteratorType last,
+                                   PredicateType pred) {
+  /*
+    step 1: count the elements satisfying the predicate, this is
+    where the second group starts
+
+    step 2: partition_copy the range into a tmp view, with the
+    elements satisfying pred at the front and the others after
+    them, both in their original order since partition_copy is a scan
+
+    step 3: move the tmp view back into [first, last)
+   */
+
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return first;
+  }
+
+  // step 1
+  const auto num_true = count_if_impl(label, ex, first, last, pred);
+
+  // step 2
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  using value_type        = typename IteratorType::value_type;
+  using tmp_view_type     = Kokkos::View<value_type*, ExecutionSpace>;
+  tmp_view_type tmp_view(
+      view_alloc(ex, WithoutInitializing, "stable_partition_impl_tmp_view"),
+      num_elements);
+  partition_copy_impl(label, ex, first, last, begin(tmp_view),
+                      begin(tmp_view) + num_true, std::move(pred));
+
+  // step 3
+  using index_type = typename IteratorType::difference_type;
+  using move_func_type =
+      StdMoveFunctor<index_type, decltype(begin(tmp_view)), IteratorType>;
+  ::Kokkos::parallel_for(label,
+                         RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                         move_func_type(begin(tmp_view), first));
+  ex.fence("Kokkos::stable_partition: fence after operation");
+
+  return first + num_true;
+}
+
+// ------------------------------------------
+// partition_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class PredicateType>
+IteratorType partition_impl(const std::string& label, const ExecutionSpace& ex,
+                            IteratorType first, IteratorType last,
+                            PredicateType pred) {
+  // the scan-based stable partition needs one pass more than an unstable
+  // one would, but it is the one that parallelizes on all backends
+  return stable_partition_impl(label, ex, first, last, std::move(pred));
+}
+
 }  // end namespace Impl
 
 // ----------------------
@@ -485,6 +550,81 @@ auto partition_point(const ExecutionSpace& ex,
                                     ex, begin(v), end(v), std::move(p));
 }
 
+// ----------------------
+// partition
+// ----------------------
+template <class ExecutionSpace, class IteratorType, class UnaryPredicate>
+IteratorType partition(const ExecutionSpace& ex, IteratorType first,
+                       IteratorType last, UnaryPredicate p) {
+  return Impl::partition_impl("Kokkos::partition_iterator_api_default", ex,
+                              first, last, std::move(p));
+}
+
+template <class ExecutionSpace, class IteratorType, class UnaryPredicate>
+IteratorType partition(const std::string& label, const ExecutionSpace& ex,
+                       IteratorType first, IteratorType last,
+                       UnaryPredicate p) {
+  return Impl::partition_impl(label, ex, first, last, std::move(p));
+}
+
+template <class ExecutionSpace, class UnaryPredicate, class DataType,
+          class... Properties>
+auto partition(const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType, Properties...>& v,
+               UnaryPredicate p) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  return Impl::partition_impl("Kokkos::partition_view_api_default", ex,
+                              begin(v), end(v), std::move(p));
+}
+
+template <class ExecutionSpace, class UnaryPredicate, class DataType,
+          class... Properties>
+auto partition(const std::string& label, const ExecutionSpace& ex,
+               const ::Kokkos::View<DataType, Properties...>& v,
+               UnaryPredicate p) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  return Impl::partition_impl(label, ex, begin(v), end(v), std::move(p));
+}
+
+// ----------------------
+// stable_partition
+// ----------------------
+template <class ExecutionSpace, class IteratorType, class UnaryPredicate>
+IteratorType stable_partition(const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, UnaryPredicate p) {
+  return Impl::stable_partition_impl(
+      "Kokkos::stable_partition_iterator_api_default", ex, first, last,
+      std::move(p));
+}
+
+template <class ExecutionSpace, class IteratorType, class UnaryPredicate>
+IteratorType stable_partition(const std::string& label,
+                              const ExecutionSpace& ex, IteratorType first,
+                              IteratorType last, UnaryPredicate p) {
+  return Impl::stable_partition_impl(label, ex, first, last, std::move(p));
+}
+
+template <class ExecutionSpace, class UnaryPredicate, class DataType,
+          class... Properties>
+auto stable_partition(const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType, Properties...>& v,
+                      UnaryPredicate p) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  return Impl::stable_partition_impl(
+      "Kokkos::stable_partition_view_api_default", ex, begin(v), end(v),
+      std::move(p));
+}
+
+template <class ExecutionSpace, class UnaryPredicate, class DataType,
+          class... Properties>
+auto stable_partition(const std::string& label, const ExecutionSpace& ex,
+                      const ::Kokkos::View<DataType, Properties...>& v,
+                      UnaryPredicate p) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(v);
+  return Impl::stable_partition_impl(label, ex, begin(v), end(v),
+                                     std::move(p));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -0,0 +1,438 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_HPP
+#define KOKKOS_STD_ALGORITHMS_RANGE_ADAPTORS_HPP
+
+/// \file Kokkos_RangeAdaptors.hpp
+/// \brief Lazy range adaptors: transform, replace_if_not, zip, iota and
+/// stride
+///
+/// The adaptors compute their elements on access, so passing their
+/// iterators to an algorithm fuses the adaptors into the kernel of the
+/// algorithm without any intermediate view. For example
+///
+///   namespace KE = Kokkos::Experimental;
+///   auto r = KE::views::replace_if_not(KE::views::transform(v, op), pred, 0);
+///   auto sum = KE::reduce(exespace, KE::begin(r), KE::end(r));
+///
+/// runs a single parallel_reduce. Adaptors accept a rank-1 view or another
+/// adaptor, and only stride is writable.
+///
+/// Every adaptor keeps the length of its range, so there is no filter
+/// dropping elements: replace_if_not only fits algorithms for which the
+/// replacement value is neutral, such as a reduction with its identity,
+/// and copy_if or remove_if are the way to drop elements.
+
+#include <Kokkos_Core.hpp>
+#include "Kokkos_BeginEnd.hpp"
+#include "Kokkos_Constraints.hpp"
+#include "Kokkos_RandomAccessIterator.hpp"
+#include <iterator>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// random access iterator over the elements computed by an accessor,
+// i.e. a functor mapping an index of the range to its element
+//
+template <class AccessorType>
+class AdaptorIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ptrdiff_t;
+  using value_type        = typename AccessorType::value_type;
+  using reference         = typename AccessorType::reference;
+  using pointer           = void;
+  using accessor_type     = AccessorType;
+  using iterator_type     = AdaptorIterator<AccessorType>;
+
+  KOKKOS_DEFAULTED_FUNCTION AdaptorIterator() = default;
+
+  explicit KOKKOS_FUNCTION AdaptorIterator(AccessorType accessor,
+                                           ptrdiff_t current_index = 0)
+      : m_accessor(std::move(accessor)), m_current_index(current_index) {}
+
+  KOKKOS_FUNCTION
+  iterator_type& operator++() {
+    ++m_current_index;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator--() {
+    --m_current_index;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator--(int) {
+    auto tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  KOKKOS_FUNCTION
+  reference operator[](difference_type n) const {
+    return m_accessor(m_current_index + n);
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator+=(difference_type n) {
+    m_current_index += n;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type& operator-=(difference_type n) {
+    m_current_index -= n;
+    return *this;
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator+(difference_type n) const {
+    return iterator_type(m_accessor, m_current_index + n);
+  }
+
+  KOKKOS_FUNCTION
+  iterator_type operator-(difference_type n) const {
+    return iterator_type(m_accessor, m_current_index - n);
+  }
+
+  KOKKOS_FUNCTION
+  difference_type operator-(iterator_type it) const {
+    return m_current_index - it.m_current_index;
+  }
+
+  // like for the std iterators, only iterators
+  // of the same range can be compared
+  KOKKOS_FUNCTION
+  bool operator==(iterator_type other) const {
+    return m_current_index == other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator!=(iterator_type other) const {
+    return m_current_index != other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator<(iterator_type other) const {
+    return m_current_index < other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator<=(iterator_type other) const {
+    return m_current_index <= other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator>(iterator_type other) const {
+    return m_current_index > other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  bool operator>=(iterator_type other) const {
+    return m_current_index >= other.m_current_index;
+  }
+
+  KOKKOS_FUNCTION
+  reference operator*() const { return m_accessor(m_current_index); }
+
+ private:
+  AccessorType m_accessor;
+  ptrdiff_t m_current_index = 0;
+};
+
+template <class ExeSpace, class AccessorType>
+struct iterator_is_accessible_from<ExeSpace, AdaptorIterator<AccessorType> > {
+  static constexpr bool value =
+      AccessorType::template is_accessible_from<ExeSpace>::value;
+};
+
+//
+// a pair of iterators
+//
+template <class IteratorType>
+class AdaptedRange {
+ public:
+  using iterator        = IteratorType;
+  using difference_type = typename IteratorType::difference_type;
+  using value_type      = typename IteratorType::value_type;
+
+  KOKKOS_FUNCTION
+  AdaptedRange(IteratorType first, IteratorType last)
+      : m_first(std::move(first)), m_last(std::move(last)) {}
+
+  KOKKOS_FUNCTION
+  iterator begin() const { return m_first; }
+
+  KOKKOS_FUNCTION
+  iterator end() const { return m_last; }
+
+  KOKKOS_FUNCTION
+  difference_type size() const { return m_last - m_first; }
+
+ private:
+  IteratorType m_first;
+  IteratorType m_last;
+};
+
+template <class DataType, class... Properties>
+KOKKOS_INLINE_FUNCTION auto as_range(
+    const ::Kokkos::View<DataType, Properties...>& v) {
+  using it_t = decltype(::Kokkos::Experimental::begin(v));
+  return AdaptedRange<it_t>(::Kokkos::Experimental::begin(v),
+                            ::Kokkos::Experimental::end(v));
+}
+
+template <class IteratorType>
+KOKKOS_INLINE_FUNCTION AdaptedRange<IteratorType> as_range(
+    const AdaptedRange<IteratorType>& r) {
+  return r;
+}
+
+template <class RangeType>
+using adapted_iterator_t =
+    typename decltype(as_range(std::declval<const RangeType&>()))::iterator;
+
+//
+// accessors
+//
+template <class IteratorType, class UnaryOpType>
+struct TransformAccessor {
+  using value_type = std::decay_t<decltype(std::declval<const UnaryOpType&>()(
+      std::declval<IteratorType>()[0]))>;
+  using reference = value_type;
+
+  template <class ExeSpace>
+  using is_accessible_from =
+      iterators_are_accessible_from<ExeSpace, IteratorType>;
+
+  IteratorType m_first;
+  UnaryOpType m_op;
+
+  KOKKOS_FUNCTION
+  reference operator()(const ptrdiff_t i) const { return m_op(m_first[i]); }
+};
+
+// elements not satisfying the predicate read as m_value, which should be
+// the neutral element of the algorithm consuming the range
+template <class IteratorType, class PredicateType>
+struct ReplaceIfNotAccessor {
+  using value_type = typename IteratorType::value_type;
+  using reference  = value_type;
+
+  template <class ExeSpace>
+  using is_accessible_from =
+      iterators_are_accessible_from<ExeSpace, IteratorType>;
+
+  IteratorType m_first;
+  PredicateType m_pred;
+  value_type m_value;
+
+  KOKKOS_FUNCTION
+  reference operator()(const ptrdiff_t i) const {
+    const auto& my_value = m_first[i];
+    return m_pred(my_value) ? value_type(my_value) : m_value;
+  }
+};
+
+template <class IteratorType1, class IteratorType2>
+struct ZipAccessor {
+  using value_type = ::Kokkos::pair<typename IteratorType1::value_type,
+                                    typename IteratorType2::value_type>;
+  using reference  = value_type;
+
+  template <class ExeSpace>
+  using is_accessible_from =
+      iterators_are_accessible_from<ExeSpace, IteratorType1, IteratorType2>;
+
+  IteratorType1 m_first1;
+  IteratorType2 m_first2;
+
+  KOKKOS_FUNCTION
+  reference operator()(const ptrdiff_t i) const {
+    return value_type(m_first1[i], m_first2[i]);
+  }
+};
+
+template <class ValueType>
+struct IotaAccessor {
+  using value_type = ValueType;
+  using reference  = value_type;
+
+  template <class ExeSpace>
+  using is_accessible_from = std::true_type;
+
+  ValueType m_start;
+
+  KOKKOS_FUNCTION
+  reference operator()(const ptrdiff_t i) const {
+    return m_start + static_cast<ValueType>(i);
+  }
+};
+
+template <class IteratorType>
+struct StrideAccessor {
+  using value_type = typename IteratorType::value_type;
+  using reference  = typename IteratorType::reference;
+
+  template <class ExeSpace>
+  using is_accessible_from =
+      iterators_are_accessible_from<ExeSpace, IteratorType>;
+
+  IteratorType m_first;
+  ptrdiff_t m_stride;
+
+  KOKKOS_FUNCTION
+  reference operator()(const ptrdiff_t i) const {
+    return m_first[i * m_stride];
+  }
+};
+
+template <class AccessorType>
+KOKKOS_INLINE_FUNCTION auto make_adapted_range(AccessorType accessor,
+                                               ptrdiff_t size) {
+  using it_t = AdaptorIterator<AccessorType>;
+  return AdaptedRange<it_t>(it_t(accessor, 0), it_t(accessor, size));
+}
+
+}  // namespace Impl
+
+// begin, end for adapted ranges
+template <class IteratorType>
+KOKKOS_INLINE_FUNCTION IteratorType
+begin(const Impl::AdaptedRange<IteratorType>& r) {
+  return r.begin();
+}
+
+template <class IteratorType>
+KOKKOS_INLINE_FUNCTION IteratorType
+end(const Impl::AdaptedRange<IteratorType>& r) {
+  return r.end();
+}
+
+namespace views {
+
+/// the range of the elements of r with op applied to them
+template <class RangeType, class UnaryOpType>
+KOKKOS_INLINE_FUNCTION auto transform(const RangeType& r, UnaryOpType op) {
+  const auto range = Impl::as_range(r);
+  using accessor_t =
+      Impl::TransformAccessor<Impl::adapted_iterator_t<RangeType>,
+                              UnaryOpType>;
+  return Impl::make_adapted_range(accessor_t{range.begin(), std::move(op)},
+                                  range.size());
+}
+
+/// the range of the elements of r, those not satisfying pred being
+/// replaced by value; unlike std::views::filter it keeps all the positions,
+/// so value must be neutral for the algorithm consuming the range
+template <class RangeType, class PredicateType, class ValueType>
+KOKKOS_INLINE_FUNCTION auto replace_if_not(const RangeType& r,
+                                           PredicateType pred,
+                                           const ValueType& value) {
+  const auto range = Impl::as_range(r);
+  using accessor_t =
+      Impl::ReplaceIfNotAccessor<Impl::adapted_iterator_t<RangeType>,
+                                 PredicateType>;
+  using value_type = typename accessor_t::value_type;
+  return Impl::make_adapted_range(
+      accessor_t{range.begin(), std::move(pred), value_type(value)},
+      range.size());
+}
+
+/// the range of the pairs of the elements of r1 and r2 at the same
+/// position, as long as the shortest of the two
+template <class RangeType1, class RangeType2>
+KOKKOS_INLINE_FUNCTION auto zip(const RangeType1& r1, const RangeType2& r2) {
+  const auto range1 = Impl::as_range(r1);
+  const auto range2 = Impl::as_range(r2);
+  using accessor_t  = Impl::ZipAccessor<Impl::adapted_iterator_t<RangeType1>,
+                                       Impl::adapted_iterator_t<RangeType2> >;
+  const auto size =
+      (range1.size() < range2.size()) ? range1.size() : range2.size();
+  return Impl::make_adapted_range(accessor_t{range1.begin(), range2.begin()},
+                                  size);
+}
+
+/// the range of the values start, start + 1, ..., bound - 1
+template <class ValueType>
+KOKKOS_INLINE_FUNCTION auto iota(const ValueType& start,
+                                 const ValueType& bound) {
+  static_assert(std::is_integral<ValueType>::value,
+                "Kokkos::Experimental::views::iota: requires integral values");
+  KOKKOS_EXPECTS(bound >= start);
+  using accessor_t = Impl::IotaAccessor<ValueType>;
+  return Impl::make_adapted_range(accessor_t{start},
+                                  static_cast<ptrdiff_t>(bound - start));
+}
+
+/// the range of every stride-th element of r, starting with the first
+template <class RangeType>
+KOKKOS_INLINE_FUNCTION auto stride(const RangeType& r, ptrdiff_t stride) {
+  KOKKOS_EXPECTS(stride > 0);
+  const auto range = Impl::as_range(r);
+  using accessor_t =
+      Impl::StrideAccessor<Impl::adapted_iterator_t<RangeType> >;
+  return Impl::make_adapted_range(accessor_t{range.begin(), stride},
+                                  (range.size() + stride - 1) / stride);
+}
+
+}  // namespace views
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -85,14 +85,35 @@ struct ReducerWithArbitraryJoinerNoNeutralElement {
       : m_joiner(joiner_), m_value(value_), m_references_scalar_v(false) {}
 
   // Required
+  // a contribution that never saw an element (e.g. a team member with
+  // an empty share of the range) has to be skipped since there is no
+  // neutral element to stand in for it
   KOKKOS_FUNCTION
   void join(value_type& dest, const value_type& src) const {
-    dest.val = m_joiner(dest.val, src.val);
+    if (src.is_initial) {
+      return;
+    }
+
+    if (dest.is_initial) {
+      dest = src;
+    } else {
+      dest.val = m_joiner(dest.val, src.val);
+    }
   }
 
   KOKKOS_FUNCTION
   void join(volatile value_type& dest, const volatile value_type& src) const {
-    dest.val = m_joiner(dest.val, src.val);
+    if (src.is_initial) {
+      return;
+    }
+
+    if (dest.is_initial) {
+      // not every scalar type can be copied from a volatile instance
+      dest.val        = const_cast<const scalar_type&>(src.val);
+      dest.is_initial = false;
+    } else {
+      dest.val = m_joiner(dest.val, src.val);
+    }
   }
 
   KOKKOS_FUNCTION
@@ -48,8 +48,10 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_BeginEnd.hpp"
 #include "Kokkos_Constraints.hpp"
+#include "Kokkos_ModifyingSequenceOperations.hpp"
 #include "Kokkos_NonModifyingSequenceOperations.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include <Kokkos_Sort.hpp>
 #include <string>
 
 namespace Kokkos {
@@ -62,35 +64,170 @@ namespace Impl {
 //
 // ------------------
 
-template <class IteratorType, class IndicatorViewType, class ComparatorType>
+template <class IndexType, class IteratorType, class ReducerType,
+          class ComparatorType>
 struct StdIsSortedUntilFunctor {
-  using index_type = typename IteratorType::difference_type;
+  using red_value_type = typename ReducerType::value_type;
+
   IteratorType m_first;
-  IndicatorViewType m_indicator;
+  ReducerType m_reducer;
   ComparatorType m_comparator;
 
   KOKKOS_FUNCTION
-  void operator()(const index_type i, int& update, const bool final) const {
+  void operator()(const IndexType i, red_value_type& red_value) const {
     const auto& val_i   = m_first[i];
     const auto& val_ip1 = m_first[i + 1];
 
-    if (m_comparator(val_ip1, val_i)) {
-      ++update;
-    }
+    auto rv =
+        m_comparator(val_ip1, val_i)
+            ? red_value_type{i}
+            : red_value_type{::Kokkos::reduction_identity<IndexType>::min()};
 
-    if (final) {
-      m_indicator(i) = update;
-    }
+    m_reducer.join(red_value, rv);
   }
 
   KOKKOS_FUNCTION
-  StdIsSortedUntilFunctor(IteratorType _first1, IndicatorViewType indicator,
+  StdIsSortedUntilFunctor(IteratorType _first1, ReducerType reducer,
                           ComparatorType comparator)
       : m_first(std::move(_first1)),
-        m_indicator(std::move(indicator)),
+        m_reducer(std::move(reducer)),
         m_comparator(std::move(comparator)) {}
 };
 
+template <class IndexType>
+struct StdThreeWayPartitionScalar {
+  IndexType less_count_;
+  IndexType equal_count_;
+  IndexType greater_count_;
+
+  // copy assignment operators implemented explicitly for consistency
+  // with StdPartitionCopyScalar
+  KOKKOS_FUNCTION
+  void operator=(const StdThreeWayPartitionScalar& other) {
+    less_count_    = other.less_count_;
+    equal_count_   = other.equal_count_;
+    greater_count_ = other.greater_count_;
+  }
+
+  KOKKOS_FUNCTION
+  void operator=(const volatile StdThreeWayPartitionScalar& other) volatile {
+    less_count_    = other.less_count_;
+    equal_count_   = other.equal_count_;
+    greater_count_ = other.greater_count_;
+  }
+
+  KOKKOS_FUNCTION
+  void operator=(const IndexType value) {
+    less_count_    = value;
+    equal_count_   = value;
+    greater_count_ = value;
+  }
+};
+
+// Writes the median of the first, middle and last element of the range
+// to the pivot view
+template <class IteratorType, class PivotViewType, class ComparatorType>
+struct StdNthElementPivotFunctor {
+  using index_type = typename IteratorType::difference_type;
+  IteratorType m_first;
+  index_type m_num_elements;
+  PivotViewType m_pivot;
+  ComparatorType m_comparator;
+
+  KOKKOS_FUNCTION
+  void operator()(const index_type /*i*/) const {
+    const auto& a = m_first[0];
+    const auto& b = m_first[m_num_elements / 2];
+    const auto& c = m_first[m_num_elements - 1];
+    if (m_comparator(a, b)) {
+      m_pivot() = m_comparator(b, c) ? b : m_comparator(a, c) ? c : a;
+    } else {
+      m_pivot() = m_comparator(a, c) ? a : m_comparator(b, c) ? c : b;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  StdNthElementPivotFunctor(IteratorType first, index_type num_elements,
+                            PivotViewType pivot, ComparatorType comparator)
+      : m_first(std::move(first)),
+        m_num_elements(num_elements),
+        m_pivot(std::move(pivot)),
+        m_comparator(std::move(comparator)) {}
+};
+
+// Splits the range into the elements less than, equal to and greater than
+// the pivot. Used as a reduction it counts the three groups, used as a scan
+// it also copies every element to its group in the destination, which
+// requires the sizes of the first two groups from the reduction.
+template <class IndexType, class IteratorType, class DestIteratorType,
+          class PivotViewType, class ComparatorType>
+struct StdThreeWayPartitionFunctor {
+  using value_type = StdThreeWayPartitionScalar<IndexType>;
+
+  IteratorType m_first;
+  DestIteratorType m_dest_first;
+  PivotViewType m_pivot;
+  ComparatorType m_comparator;
+  IndexType m_num_less;
+  IndexType m_num_equal;
+
+  KOKKOS_FUNCTION
+  StdThreeWayPartitionFunctor(IteratorType first, DestIteratorType dest_first,
+                              PivotViewType pivot, ComparatorType comparator,
+                              IndexType num_less, IndexType num_equal)
+      : m_first(std::move(first)),
+        m_dest_first(std::move(dest_first)),
+        m_pivot(std::move(pivot)),
+        m_comparator(std::move(comparator)),
+        m_num_less(num_less),
+        m_num_equal(num_equal) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update) const {
+    const auto& myval = m_first[i];
+    if (m_comparator(myval, m_pivot())) {
+      update.less_count_ += 1;
+    } else if (m_comparator(m_pivot(), myval)) {
+      update.greater_count_ += 1;
+    } else {
+      update.equal_count_ += 1;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    const auto& myval = m_first[i];
+    if (m_comparator(myval, m_pivot())) {
+      if (final_pass) m_dest_first[update.less_count_] = myval;
+      update.less_count_ += 1;
+    } else if (m_comparator(m_pivot(), myval)) {
+      if (final_pass) {
+        m_dest_first[m_num_less + m_num_equal + update.greater_count_] = myval;
+      }
+      update.greater_count_ += 1;
+    } else {
+      if (final_pass) m_dest_first[m_num_less + update.equal_count_] = myval;
+      update.equal_count_ += 1;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const {
+    update.less_count_    = 0;
+    update.equal_count_   = 0;
+    update.greater_count_ = 0;
+  }
+
+  KOKKOS_FUNCTION
+  void join(volatile value_type& update,
+            volatile const value_type& input) const {
+    update.less_count_ += input.less_count_;
+    update.equal_count_ += input.equal_count_;
+    update.greater_count_ += input.greater_count_;
+  }
+};
+
 template <class IteratorType, class ComparatorType>
 struct StdIsSortedFunctor {
   using index_type = typename IteratorType::difference_type;
@@ -131,40 +268,29 @@ IteratorType is_sorted_until_impl(const std::string& label,
   }
 
   /*
-    use scan and a helper "indicator" view
-    such that we scan the data and fill the indicator with
-    partial sum that is always 0 unless we find a pair that
-    breaks the sorting, so in that case the indicator will
-    have a 1 starting at the location where the sorting breaks.
-    So finding that 1 means finding the location we want.
+    find the first index i such that the pair (i, i+1) breaks the sorting,
+    scanning the range in chunks so that we stop at the first break
    */
 
   // aliases
-  using indicator_value_type = std::size_t;
-  using indicator_view_type =
-      ::Kokkos::View<indicator_value_type*, ExecutionSpace>;
-  using functor_type =
-      StdIsSortedUntilFunctor<IteratorType, indicator_view_type,
-                              ComparatorType>;
-
-  // do scan
-  // use num_elements-1 because each index handles i and i+1
-  const auto num_elements_minus_one = num_elements - 1;
-  indicator_view_type indicator("is_sorted_until_indicator_helper",
-                                num_elements_minus_one);
-  ::Kokkos::parallel_scan(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements_minus_one),
-      functor_type(first, indicator, std::move(comp)));
+  using index_type           = typename IteratorType::difference_type;
+  using reducer_type         = FirstLoc<index_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+  using functor_type = StdIsSortedUntilFunctor<index_type, IteratorType,
+                                               reducer_type, ComparatorType>;
 
-  // try to find the first sentinel value, which indicates
-  // where the sorting condition breaks
-  namespace KE                                  = ::Kokkos::Experimental;
-  constexpr indicator_value_type sentinel_value = 1;
-  auto r =
-      KE::find(ex, KE::cbegin(indicator), KE::cend(indicator), sentinel_value);
-  const auto shift = r - ::Kokkos::Experimental::cbegin(indicator);
+  // use num_elements-1 because each index handles i and i+1
+  reduction_value_type red_result;
+  reducer_type reducer(red_result);
+  const auto loc = first_loc_chunked_impl(
+      label, ex, num_elements - 1,
+      functor_type(first, reducer, std::move(comp)));
 
-  return first + (shift + 1);
+  if (loc == ::Kokkos::reduction_identity<index_type>::min()) {
+    return last;
+  } else {
+    return first + (loc + 1);
+  }
 }
 
 template <class ExecutionSpace, class IteratorType>
@@ -213,6 +339,162 @@ bool is_sorted_impl(const std::string& label, const ExecutionSpace& ex,
   return is_sorted_impl(label, ex, first, last, pred_t());
 }
 
+// ------------------------------------------
+// sort_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void sort_impl(const std::string& label, const ExecutionSpace& ex,
+               IteratorType first, IteratorType last, ComparatorType comp) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::Impl::merge_sort(label, ex, first, num_elements, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType>
+void sort_impl(const std::string& label, const ExecutionSpace& ex,
+               IteratorType first, IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  sort_impl(label, ex, first, last, pred_t());
+}
+
+// ------------------------------------------
+// nth_element_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void nth_element_impl(const std::string& label, const ExecutionSpace& ex,
+                      IteratorType first, IteratorType nth, IteratorType last,
+                      ComparatorType comp) {
+  /*
+    quickselect where every round is parallel: pick the median of three
+    of the current range as pivot, split the range into the elements
+    less than, equal to and greater than the pivot through a tmp view,
+    and keep going only in the group containing nth. Once the range is
+    small enough it is sorted instead.
+   */
+
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(first, nth);
+
+  if (nth == last) {
+    return;
+  }
+
+  // aliases
+  using index_type        = typename IteratorType::difference_type;
+  using value_type        = typename IteratorType::value_type;
+  using tmp_view_type     = Kokkos::View<value_type*, ExecutionSpace>;
+  using pivot_view_type   = Kokkos::View<value_type, ExecutionSpace>;
+  using tmp_iterator_type = decltype(begin(std::declval<tmp_view_type>()));
+  using pivot_func_type =
+      StdNthElementPivotFunctor<IteratorType, pivot_view_type, ComparatorType>;
+  using partition_func_type =
+      StdThreeWayPartitionFunctor<index_type, IteratorType, tmp_iterator_type,
+                                  pivot_view_type, ComparatorType>;
+  using move_func_type =
+      StdMoveFunctor<index_type, tmp_iterator_type, IteratorType>;
+
+  // below this size the range left is sorted
+  constexpr index_type sort_threshold = 2048;
+
+  const index_type nth_index = Kokkos::Experimental::distance(first, nth);
+  index_type range_begin     = 0;
+  index_type range_end       = Kokkos::Experimental::distance(first, last);
+
+  tmp_view_type tmp_view;
+  pivot_view_type pivot(
+      view_alloc(ex, WithoutInitializing, "nth_element_impl_pivot"));
+
+  while (range_end - range_begin > sort_threshold) {
+    const auto range_first  = first + range_begin;
+    const index_type length = range_end - range_begin;
+    if (tmp_view.extent(0) == 0) {
+      tmp_view = tmp_view_type(
+          view_alloc(ex, WithoutInitializing, "nth_element_impl_tmp_view"),
+          length);
+    }
+
+    ::Kokkos::parallel_for(label, RangePolicy<ExecutionSpace>(ex, 0, 1),
+                           pivot_func_type(range_first, length, pivot, comp));
+
+    typename partition_func_type::value_type counts;
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, length),
+        partition_func_type(range_first, begin(tmp_view), pivot, comp, 0, 0),
+        counts);
+    ::Kokkos::parallel_scan(
+        label, RangePolicy<ExecutionSpace>(ex, 0, length),
+        partition_func_type(range_first, begin(tmp_view), pivot, comp,
+                            counts.less_count_, counts.equal_count_));
+    ::Kokkos::parallel_for(label, RangePolicy<ExecutionSpace>(ex, 0, length),
+                           move_func_type(begin(tmp_view), range_first));
+
+    const index_type equal_begin = range_begin + counts.less_count_;
+    const index_type equal_end   = equal_begin + counts.equal_count_;
+    if (nth_index < equal_begin) {
+      range_end = equal_begin;
+    } else if (nth_index < equal_end) {
+      // nth holds the pivot, which is in its sorted position
+      ex.fence("Kokkos::nth_element: fence after operation");
+      return;
+    } else {
+      range_begin = equal_end;
+    }
+  }
+
+  ::Kokkos::Impl::merge_sort(label, ex, first + range_begin,
+                             range_end - range_begin, std::move(comp));
+  ex.fence("Kokkos::nth_element: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void nth_element_impl(const std::string& label, const ExecutionSpace& ex,
+                      IteratorType first, IteratorType nth,
+                      IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  nth_element_impl(label, ex, first, nth, last, pred_t());
+}
+
+// ------------------------------------------
+// partial_sort_impl
+// ------------------------------------------
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void partial_sort_impl(const std::string& label, const ExecutionSpace& ex,
+                       IteratorType first, IteratorType middle,
+                       IteratorType last, ComparatorType comp) {
+  // select the middle - first smallest elements into [first, middle)
+  // and then sort only those
+
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(first, middle);
+
+  if (first == middle) {
+    return;
+  }
+  nth_element_impl(label, ex, first, middle, last, comp);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, middle);
+  ::Kokkos::Impl::merge_sort(label, ex, first, num_elements, std::move(comp));
+  ex.fence("Kokkos::partial_sort: fence after operation");
+}
+
+template <class ExecutionSpace, class IteratorType>
+void partial_sort_impl(const std::string& label, const ExecutionSpace& ex,
+                       IteratorType first, IteratorType middle,
+                       IteratorType last) {
+  using value_type = typename IteratorType::value_type;
+  using pred_t     = Impl::StdAlgoLessThanBinaryPredicate<value_type>;
+  partial_sort_impl(label, ex, first, middle, last, pred_t());
+}
+
 }  // namespace Impl
 
 // ----------------------------------
@@ -372,6 +654,246 @@ bool is_sorted(const std::string& label, const ExecutionSpace& ex,
                               std::move(comp));
 }
 
+// ----------------------------------
+// sort public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType>
+void sort(const ExecutionSpace& ex, IteratorType first, IteratorType last) {
+  Impl::sort_impl("Kokkos::sort_iterator_api_default", ex, first, last);
+}
+
+template <class ExecutionSpace, class IteratorType>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          IteratorType first, IteratorType last) {
+  Impl::sort_impl(label, ex, first, last);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void sort(const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::sort_impl("Kokkos::sort_view_api_default", ex, KE::begin(view),
+                  KE::end(view));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::sort_impl(label, ex, KE::begin(view), KE::end(view));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void sort(const ExecutionSpace& ex, IteratorType first, IteratorType last,
+          ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::sort_impl("Kokkos::sort_iterator_api_default", ex, first, last,
+                  std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          IteratorType first, IteratorType last, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::sort_impl(label, ex, first, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void sort(const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view,
+          ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::sort_impl("Kokkos::sort_view_api_default", ex, KE::begin(view),
+                  KE::end(view), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void sort(const std::string& label, const ExecutionSpace& ex,
+          const ::Kokkos::View<DataType, Properties...>& view,
+          ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::sort_impl(label, ex, KE::begin(view), KE::end(view), std::move(comp));
+}
+
+// ----------------------------------
+// nth_element public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType>
+void nth_element(const ExecutionSpace& ex, IteratorType first,
+                 IteratorType nth, IteratorType last) {
+  Impl::nth_element_impl("Kokkos::nth_element_iterator_api_default", ex,
+                         first, nth, last);
+}
+
+template <class ExecutionSpace, class IteratorType>
+void nth_element(const std::string& label, const ExecutionSpace& ex,
+                 IteratorType first, IteratorType nth, IteratorType last) {
+  Impl::nth_element_impl(label, ex, first, nth, last);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void nth_element(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 std::size_t nth_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::nth_element_impl("Kokkos::nth_element_view_api_default", ex,
+                         KE::begin(view), KE::begin(view) + nth_location,
+                         KE::end(view));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void nth_element(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 std::size_t nth_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::nth_element_impl(label, ex, KE::begin(view),
+                         KE::begin(view) + nth_location, KE::end(view));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void nth_element(const ExecutionSpace& ex, IteratorType first,
+                 IteratorType nth, IteratorType last, ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::nth_element_impl("Kokkos::nth_element_iterator_api_default", ex,
+                         first, nth, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void nth_element(const std::string& label, const ExecutionSpace& ex,
+                 IteratorType first, IteratorType nth, IteratorType last,
+                 ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::nth_element_impl(label, ex, first, nth, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void nth_element(const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 std::size_t nth_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::nth_element_impl("Kokkos::nth_element_view_api_default", ex,
+                         KE::begin(view), KE::begin(view) + nth_location,
+                         KE::end(view), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void nth_element(const std::string& label, const ExecutionSpace& ex,
+                 const ::Kokkos::View<DataType, Properties...>& view,
+                 std::size_t nth_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::nth_element_impl(label, ex, KE::begin(view),
+                         KE::begin(view) + nth_location, KE::end(view),
+                         std::move(comp));
+}
+
+// ----------------------------------
+// partial_sort public API
+// ----------------------------------
+template <class ExecutionSpace, class IteratorType>
+void partial_sort(const ExecutionSpace& ex, IteratorType first,
+                  IteratorType middle, IteratorType last) {
+  Impl::partial_sort_impl("Kokkos::partial_sort_iterator_api_default", ex,
+                          first, middle, last);
+}
+
+template <class ExecutionSpace, class IteratorType>
+void partial_sort(const std::string& label, const ExecutionSpace& ex,
+                  IteratorType first, IteratorType middle, IteratorType last) {
+  Impl::partial_sort_impl(label, ex, first, middle, last);
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void partial_sort(const ExecutionSpace& ex,
+                  const ::Kokkos::View<DataType, Properties...>& view,
+                  std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::partial_sort_impl("Kokkos::partial_sort_view_api_default", ex,
+                          KE::begin(view), KE::begin(view) + middle_location,
+                          KE::end(view));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties>
+void partial_sort(const std::string& label, const ExecutionSpace& ex,
+                  const ::Kokkos::View<DataType, Properties...>& view,
+                  std::size_t middle_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::partial_sort_impl(label, ex, KE::begin(view),
+                          KE::begin(view) + middle_location, KE::end(view));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void partial_sort(const ExecutionSpace& ex, IteratorType first,
+                  IteratorType middle, IteratorType last,
+                  ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::partial_sort_impl("Kokkos::partial_sort_iterator_api_default", ex,
+                          first, middle, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class IteratorType, class ComparatorType>
+void partial_sort(const std::string& label, const ExecutionSpace& ex,
+                  IteratorType first, IteratorType middle, IteratorType last,
+                  ComparatorType comp) {
+  Impl::static_assert_is_not_openmptarget(ex);
+  Impl::partial_sort_impl(label, ex, first, middle, last, std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void partial_sort(const ExecutionSpace& ex,
+                  const ::Kokkos::View<DataType, Properties...>& view,
+                  std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::partial_sort_impl("Kokkos::partial_sort_view_api_default", ex,
+                          KE::begin(view), KE::begin(view) + middle_location,
+                          KE::end(view), std::move(comp));
+}
+
+template <class ExecutionSpace, class DataType, class... Properties,
+          class ComparatorType>
+void partial_sort(const std::string& label, const ExecutionSpace& ex,
+                  const ::Kokkos::View<DataType, Properties...>& view,
+                  std::size_t middle_location, ComparatorType comp) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+  Impl::static_assert_is_not_openmptarget(ex);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::partial_sort_impl(label, ex, KE::begin(view),
+                          KE::begin(view) + middle_location, KE::end(view),
+                          std::move(comp));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -315,6 +315,30 @@ OutputIterator copy_impl(const std::string& label, const ExecutionSpace& ex,
   return d_first + num_elements;
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator>
+KOKKOS_FUNCTION OutputIterator copy_team_impl(const TeamHandleType& teamHandle,
+                                              InputIterator first,
+                                              InputIterator last,
+                                              OutputIterator d_first) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using index_type = typename InputIterator::difference_type;
+  using func_t     = StdCopyFunctor<index_type, InputIterator, OutputIterator>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first, d_first));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements;
+}
+
 // ------------------------------------------
 // copy_n_impl
 // ------------------------------------------
@@ -335,6 +359,25 @@ OutputIterator copy_n_impl(const std::string& label, const ExecutionSpace& ex,
   }
 }
 
+template <class TeamHandleType, class InputIterator, class Size,
+          class OutputIterator>
+KOKKOS_FUNCTION OutputIterator copy_n_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first_from, Size count,
+    OutputIterator first_dest) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+
+  if (count > 0) {
+    return copy_team_impl(teamHandle, first_from, first_from + count,
+                          first_dest);
+  } else {
+    return first_dest;
+  }
+}
+
 // ------------------------------------------
 // copy_backward_impl
 // ------------------------------------------
@@ -363,6 +406,30 @@ IteratorType2 copy_backward_impl(const std::string& label,
   return d_last - num_elements;
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType2 copy_backward_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 d_last) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_last);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_last);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t =
+      StdCopyBackwardFunctor<index_type, IteratorType1, IteratorType2>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(last, d_last));
+  teamHandle.team_barrier();
+
+  // return
+  return d_last - num_elements;
+}
+
 // ------------------------------------------
 // copy_if_impl
 // ------------------------------------------
@@ -418,6 +485,37 @@ OutputIterator copy_if_impl(const std::string& label, const ExecutionSpace& ex,
   }
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class PredicateType>
+KOKKOS_FUNCTION OutputIterator copy_if_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first, InputIterator last,
+    OutputIterator d_first, PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return d_first;
+  } else {
+    // aliases
+    using index_type = typename InputIterator::difference_type;
+    using func_type  = StdCopyIfFunctor<index_type, InputIterator,
+                                       OutputIterator, PredicateType>;
+
+    // the nested scan does not return the total, so count first
+    const index_type count = count_if_team_impl(teamHandle, first, last, pred);
+
+    // run
+    const auto num_elements = Kokkos::Experimental::distance(first, last);
+    ::Kokkos::parallel_scan(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_type(first, d_first, pred));
+    teamHandle.team_barrier();
+
+    return d_first + count;
+  }
+}
+
 // ------------------------------------------
 // fill_impl
 // ------------------------------------------
@@ -451,6 +549,37 @@ IteratorType fill_n_impl(const std::string& label, const ExecutionSpace& ex,
   return last;
 }
 
+template <class TeamHandleType, class IteratorType, class T>
+KOKKOS_FUNCTION void fill_team_impl(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last,
+                                    const T& value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         StdFillFunctor<IteratorType, T>(first, value));
+  teamHandle.team_barrier();
+}
+
+template <class TeamHandleType, class IteratorType, class SizeType, class T>
+KOKKOS_FUNCTION IteratorType fill_n_team_impl(const TeamHandleType& teamHandle,
+                                              IteratorType first, SizeType n,
+                                              const T& value) {
+  auto last = first + n;
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  if (n <= 0) {
+    return first;
+  }
+
+  fill_team_impl(teamHandle, first, last, value);
+  return last;
+}
+
 // ------------------------------------------
 // transform_impl
 // ------------------------------------------
@@ -509,6 +638,59 @@ OutputIterator transform_impl(const std::string& label,
   return d_first + num_elements;
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class UnaryOperation>
+KOKKOS_FUNCTION OutputIterator transform_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first1,
+    InputIterator last1, OutputIterator d_first, UnaryOperation unary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, d_first);
+  Impl::expect_valid_range(first1, last1);
+
+  // aliases
+  using index_type = typename InputIterator::difference_type;
+  using func_t = StdTransformFunctor<index_type, InputIterator, OutputIterator,
+                                     UnaryOperation>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first1, d_first, unary_op));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements;
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class BinaryOperation>
+KOKKOS_FUNCTION OutputIterator transform_team_impl(
+    const TeamHandleType& teamHandle, InputIterator1 first1,
+    InputIterator1 last1, InputIterator2 first2, OutputIterator d_first,
+    BinaryOperation binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2,
+                                                   d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2,
+                                                              d_first);
+  Impl::expect_valid_range(first1, last1);
+
+  // aliases
+  using index_type = typename InputIterator1::difference_type;
+  using func_t =
+      StdTransformBinaryFunctor<index_type, InputIterator1, InputIterator2,
+                                OutputIterator, BinaryOperation>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first1, first2, d_first, binary_op));
+  teamHandle.team_barrier();
+  return d_first + num_elements;
+}
+
 // ------------------------------------------
 // generate_impl
 // ------------------------------------------
@@ -541,6 +723,37 @@ IteratorType generate_n_impl(const std::string& label, const ExecutionSpace& ex,
   return first + count;
 }
 
+template <class TeamHandleType, class IteratorType, class Generator>
+KOKKOS_FUNCTION void generate_team_impl(const TeamHandleType& teamHandle,
+                                        IteratorType first, IteratorType last,
+                                        Generator g) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using func_t = StdGenerateFunctor<IteratorType, Generator>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first, g));
+  teamHandle.team_barrier();
+}
+
+template <class TeamHandleType, class IteratorType, class Size,
+          class Generator>
+KOKKOS_FUNCTION IteratorType generate_n_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, Size count,
+    Generator g) {
+  if (count <= 0) {
+    return first;
+  }
+
+  generate_team_impl(teamHandle, first, first + count, g);
+  return first + count;
+}
+
 // ------------------------------------------
 // replace_if_impl
 // ------------------------------------------
@@ -564,6 +777,26 @@ void replace_if_impl(const std::string& label, const ExecutionSpace& ex,
   ex.fence("Kokkos::replace_if: fence after operation");
 }
 
+template <class TeamHandleType, class IteratorType, class PredicateType,
+          class ValueType>
+KOKKOS_FUNCTION void replace_if_team_impl(const TeamHandleType& teamHandle,
+                                          IteratorType first, IteratorType last,
+                                          PredicateType pred,
+                                          const ValueType& new_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using func_t = StdReplaceIfFunctor<IteratorType, PredicateType, ValueType>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first, std::move(pred), new_value));
+  teamHandle.team_barrier();
+}
+
 // ------------------------------------------
 // replace_impl
 // ------------------------------------------
@@ -586,6 +819,25 @@ void replace_impl(const std::string& label, const ExecutionSpace& ex,
   ex.fence("Kokkos::replace: fence after operation");
 }
 
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION void replace_team_impl(const TeamHandleType& teamHandle,
+                                       IteratorType first, IteratorType last,
+                                       const ValueType& old_value,
+                                       const ValueType& new_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using func_t = StdReplaceFunctor<IteratorType, ValueType>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first, old_value, new_value));
+  teamHandle.team_barrier();
+}
+
 // ------------------------------------------
 // replace_copy_impl
 // ------------------------------------------
@@ -620,6 +872,34 @@ OutputIteratorType replace_copy_impl(const std::string& label,
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType>
+KOKKOS_FUNCTION OutputIteratorType replace_copy_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    const ValueType& old_value, const ValueType& new_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using func_t =
+      StdReplaceCopyFunctor<InputIteratorType, OutputIteratorType, ValueType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first_from, first_dest, old_value, new_value));
+  teamHandle.team_barrier();
+
+  // return
+  return first_dest + num_elements;
+}
+
 // ------------------------------------------
 // replace_copy_if_impl
 // ------------------------------------------
@@ -656,13 +936,44 @@ OutputIteratorType replace_copy_if_impl(const std::string& label,
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class PredicateType, class ValueType>
+KOKKOS_FUNCTION OutputIteratorType replace_copy_if_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    PredicateType pred, const ValueType& new_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using index_type = typename InputIteratorType::difference_type;
+  using func_t =
+      StdReplaceIfCopyFunctor<index_type, InputIteratorType, OutputIteratorType,
+                              PredicateType, ValueType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  ::Kokkos::parallel_for(
+      TeamThreadRange(teamHandle, 0, num_elements),
+      func_t(first_from, first_dest, std::move(pred), new_value));
+  teamHandle.team_barrier();
+
+  // return
+  return first_dest + num_elements;
+}
+
 }  // namespace Impl
 
 // -------------------
 // replace copy
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator replace_copy(const ExecutionSpace& ex, InputIterator first_from,
                             InputIterator last_from, OutputIterator first_dest,
                             const ValueType& old_value,
@@ -684,7 +995,8 @@ OutputIterator replace_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class ValueType>
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto replace_copy(const ExecutionSpace& ex,
                   const ::Kokkos::View<DataType1, Properties1...>& view_from,
                   const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -711,11 +1023,42 @@ auto replace_copy(const std::string& label, const ExecutionSpace& ex,
                                  old_value, new_value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator replace_copy(const TeamHandleType& teamHandle,
+                                            InputIterator first_from,
+                                            InputIterator last_from,
+                                            OutputIterator first_dest,
+                                            const ValueType& old_value,
+                                            const ValueType& new_value) {
+  return Impl::replace_copy_team_impl(teamHandle, first_from, last_from,
+                                      first_dest, old_value, new_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto replace_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    const ValueType& old_value, const ValueType& new_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::replace_copy_team_impl(teamHandle, KE::cbegin(view_from),
+                                      KE::cend(view_from), KE::begin(view_dest),
+                                      old_value, new_value);
+}
+
 // -------------------
 // replace_copy_if
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class PredicateType, class ValueType>
+          class PredicateType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator replace_copy_if(const ExecutionSpace& ex,
                                InputIterator first_from,
                                InputIterator last_from,
@@ -740,7 +1083,7 @@ OutputIterator replace_copy_if(const std::string& label,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class PredicateType,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto replace_copy_if(const ExecutionSpace& ex,
                      const ::Kokkos::View<DataType1, Properties1...>& view_from,
                      const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -768,10 +1111,42 @@ auto replace_copy_if(const std::string& label, const ExecutionSpace& ex,
                                     pred, new_value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class PredicateType, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator replace_copy_if(const TeamHandleType& teamHandle,
+                                               InputIterator first_from,
+                                               InputIterator last_from,
+                                               OutputIterator first_dest,
+                                               PredicateType pred,
+                                               const ValueType& new_value) {
+  return Impl::replace_copy_if_team_impl(teamHandle, first_from, last_from,
+                                         first_dest, pred, new_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class PredicateType,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto replace_copy_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    PredicateType pred, const ValueType& new_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::replace_copy_if_team_impl(teamHandle, KE::cbegin(view_from),
+                                         KE::cend(view_from),
+                                         KE::begin(view_dest), pred, new_value);
+}
+
 // -------------------
 // replace
 // -------------------
-template <class ExecutionSpace, class Iterator, class ValueType>
+template <class ExecutionSpace, class Iterator, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void replace(const ExecutionSpace& ex, Iterator first, Iterator last,
              const ValueType& old_value, const ValueType& new_value) {
   return Impl::replace_impl("Kokkos::replace_iterator_api", ex, first, last,
@@ -786,7 +1161,7 @@ void replace(const std::string& label, const ExecutionSpace& ex, Iterator first,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void replace(const ExecutionSpace& ex,
              const ::Kokkos::View<DataType1, Properties1...>& view,
              const ValueType& old_value, const ValueType& new_value) {
@@ -807,11 +1182,33 @@ void replace(const std::string& label, const ExecutionSpace& ex,
                             old_value, new_value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class Iterator, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void replace(const TeamHandleType& teamHandle, Iterator first,
+                             Iterator last, const ValueType& old_value,
+                             const ValueType& new_value) {
+  Impl::replace_team_impl(teamHandle, first, last, old_value, new_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void replace(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view,
+    const ValueType& old_value, const ValueType& new_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::replace_team_impl(teamHandle, KE::begin(view), KE::end(view), old_value,
+                          new_value);
+}
+
 // -------------------
 // replace_if
 // -------------------
 template <class ExecutionSpace, class InputIterator, class Predicate,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void replace_if(const ExecutionSpace& ex, InputIterator first,
                 InputIterator last, Predicate pred,
                 const ValueType& new_value) {
@@ -828,7 +1225,8 @@ void replace_if(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class Predicate, class ValueType>
+          class Predicate, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void replace_if(const ExecutionSpace& ex,
                 const ::Kokkos::View<DataType1, Properties1...>& view,
                 Predicate pred, const ValueType& new_value) {
@@ -849,10 +1247,34 @@ void replace_if(const std::string& label, const ExecutionSpace& ex,
                                new_value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class Predicate,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void replace_if(const TeamHandleType& teamHandle,
+                                InputIterator first, InputIterator last,
+                                Predicate pred, const ValueType& new_value) {
+  Impl::replace_if_team_impl(teamHandle, first, last, pred, new_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class Predicate, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void replace_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view, Predicate pred,
+    const ValueType& new_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::replace_if_team_impl(teamHandle, KE::begin(view), KE::end(view), pred,
+                             new_value);
+}
+
 // -------------------
 // copy
 // -------------------
-template <class ExecutionSpace, class InputIterator, class OutputIterator>
+template <class ExecutionSpace, class InputIterator, class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator copy(const ExecutionSpace& ex, InputIterator first,
                     InputIterator last, OutputIterator d_first) {
   return Impl::copy_impl("Kokkos::copy_iterator_api_default", ex, first, last,
@@ -867,7 +1289,8 @@ OutputIterator copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto copy(const ExecutionSpace& ex,
           const ::Kokkos::View<DataType1, Properties1...>& source,
           ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -892,11 +1315,36 @@ auto copy(const std::string& label, const ExecutionSpace& ex,
                          KE::begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator copy(const TeamHandleType& teamHandle,
+                                    InputIterator first, InputIterator last,
+                                    OutputIterator d_first) {
+  return Impl::copy_team_impl(teamHandle, first, last, d_first);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::copy_team_impl(teamHandle, KE::cbegin(source), KE::cend(source),
+                              KE::begin(dest));
+}
+
 // -------------------
 // copy_n
 // -------------------
 template <class ExecutionSpace, class InputIterator, class Size,
-          class OutputIterator>
+          class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator copy_n(const ExecutionSpace& ex, InputIterator first, Size count,
                       OutputIterator result) {
   return Impl::copy_n_impl("Kokkos::copy_n_iterator_api_default", ex, first,
@@ -911,7 +1359,8 @@ OutputIterator copy_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class Size, class DataType2, class... Properties2>
+          class Size, class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto copy_n(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType1, Properties1...>& source, Size count,
             ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -936,10 +1385,35 @@ auto copy_n(const std::string& label, const ExecutionSpace& ex,
                            KE::begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class Size,
+          class OutputIterator, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator copy_n(const TeamHandleType& teamHandle,
+                                      InputIterator first, Size count,
+                                      OutputIterator result) {
+  return Impl::copy_n_team_impl(teamHandle, first, count, result);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class Size, class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto copy_n(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source, Size count,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::copy_n_team_impl(teamHandle, KE::cbegin(source), count,
+                                KE::begin(dest));
+}
+
 // -------------------
 // copy_backward
 // -------------------
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType2 copy_backward(const ExecutionSpace& ex, IteratorType1 first,
                             IteratorType1 last, IteratorType2 d_last) {
   return Impl::copy_backward_impl("Kokkos::copy_backward_iterator_api_default",
@@ -954,7 +1428,8 @@ IteratorType2 copy_backward(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto copy_backward(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType1, Properties1...>& source,
                    ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -977,11 +1452,36 @@ auto copy_backward(const std::string& label, const ExecutionSpace& ex,
                                   end(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType2 copy_backward(const TeamHandleType& teamHandle,
+                                            IteratorType1 first,
+                                            IteratorType1 last,
+                                            IteratorType2 d_last) {
+  return Impl::copy_backward_team_impl(teamHandle, first, last, d_last);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto copy_backward(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::copy_backward_team_impl(teamHandle, KE::cbegin(source),
+                                       KE::cend(source), KE::end(dest));
+}
+
 // -------------------
 // copy_if
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class Predicate>
+          class Predicate, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator copy_if(const ExecutionSpace& ex, InputIterator first,
                        InputIterator last, OutputIterator d_first,
                        Predicate pred) {
@@ -998,7 +1498,8 @@ OutputIterator copy_if(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class Predicate>
+          class DataType2, class... Properties2, class Predicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto copy_if(const ExecutionSpace& ex,
              const ::Kokkos::View<DataType1, Properties1...>& source,
              ::Kokkos::View<DataType2, Properties2...>& dest, Predicate pred) {
@@ -1022,10 +1523,37 @@ auto copy_if(const std::string& label, const ExecutionSpace& ex,
                             begin(dest), std::move(pred));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class Predicate, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator copy_if(const TeamHandleType& teamHandle,
+                                       InputIterator first, InputIterator last,
+                                       OutputIterator d_first, Predicate pred) {
+  return Impl::copy_if_team_impl(teamHandle, first, last, d_first,
+                                 std::move(pred));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class Predicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto copy_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest, Predicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::copy_if_team_impl(teamHandle, KE::cbegin(source),
+                                 KE::cend(source), KE::begin(dest),
+                                 std::move(pred));
+}
+
 // -------------------
 // fill
 // -------------------
-template <class ExecutionSpace, class IteratorType, class T>
+template <class ExecutionSpace, class IteratorType, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void fill(const ExecutionSpace& ex, IteratorType first, IteratorType last,
           const T& value) {
   Impl::fill_impl("Kokkos::fill_iterator_api_default", ex, first, last, value);
@@ -1037,7 +1565,8 @@ void fill(const std::string& label, const ExecutionSpace& ex,
   Impl::fill_impl(label, ex, first, last, value);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties, class T>
+template <class ExecutionSpace, class DataType, class... Properties, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void fill(const ExecutionSpace& ex,
           const ::Kokkos::View<DataType, Properties...>& view, const T& value) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
@@ -1054,10 +1583,30 @@ void fill(const std::string& label, const ExecutionSpace& ex,
   Impl::fill_impl(label, ex, begin(view), end(view), value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void fill(const TeamHandleType& teamHandle, IteratorType first,
+                          IteratorType last, const T& value) {
+  Impl::fill_team_impl(teamHandle, first, last, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void fill(const TeamHandleType& teamHandle,
+                          const ::Kokkos::View<DataType, Properties...>& view,
+                          const T& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::fill_team_impl(teamHandle, KE::begin(view), KE::end(view), value);
+}
+
 // -------------------
 // fill_n
 // -------------------
-template <class ExecutionSpace, class IteratorType, class SizeType, class T>
+template <class ExecutionSpace, class IteratorType, class SizeType, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType fill_n(const ExecutionSpace& ex, IteratorType first, SizeType n,
                     const T& value) {
   return Impl::fill_n_impl("Kokkos::fill_n_iterator_api_default", ex, first, n,
@@ -1071,7 +1620,8 @@ IteratorType fill_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class SizeType, class T>
+          class SizeType, class T,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto fill_n(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view, SizeType n,
             const T& value) {
@@ -1091,11 +1641,33 @@ auto fill_n(const std::string& label, const ExecutionSpace& ex,
   return Impl::fill_n_impl(label, ex, begin(view), n, value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class SizeType, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType fill_n(const TeamHandleType& teamHandle,
+                                    IteratorType first, SizeType n,
+                                    const T& value) {
+  return Impl::fill_n_team_impl(teamHandle, first, n, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class SizeType, class T,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto fill_n(const TeamHandleType& teamHandle,
+                            const ::Kokkos::View<DataType, Properties...>& view,
+                            SizeType n, const T& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::fill_n_team_impl(teamHandle, KE::begin(view), n, value);
+}
+
 // -------------------
 // transform
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class UnaryOperation>
+          class UnaryOperation,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIterator, OutputIterator>::value,
                   OutputIterator>
@@ -1118,7 +1690,8 @@ transform(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class UnaryOperation>
+          class DataType2, class... Properties2, class UnaryOperation,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto transform(const ExecutionSpace& ex,
                const ::Kokkos::View<DataType1, Properties1...>& source,
                ::Kokkos::View<DataType2, Properties2...>& dest,
@@ -1145,7 +1718,8 @@ auto transform(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class InputIterator1, class InputIterator2,
-          class OutputIterator, class BinaryOperation>
+          class OutputIterator, class BinaryOperation,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIterator1, InputIterator2, OutputIterator>::value,
                   OutputIterator>
@@ -1171,7 +1745,8 @@ transform(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class DataType3,
-          class... Properties3, class BinaryOperation>
+          class... Properties3, class BinaryOperation,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto transform(const ExecutionSpace& ex,
                const ::Kokkos::View<DataType1, Properties1...>& source1,
                const ::Kokkos::View<DataType2, Properties2...>& source2,
@@ -1203,10 +1778,76 @@ auto transform(const std::string& label, const ExecutionSpace& ex,
                               std::move(binary_op));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class UnaryOperation, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIterator, OutputIterator>::value,
+                  OutputIterator>
+transform(const TeamHandleType& teamHandle, InputIterator first1,
+          InputIterator last1, OutputIterator d_first,
+          UnaryOperation unary_op) {
+  return Impl::transform_team_impl(teamHandle, first1, last1, d_first,
+                                   std::move(unary_op));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class UnaryOperation,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto transform(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest,
+    UnaryOperation unary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_team_impl(teamHandle, KE::cbegin(source),
+                                   KE::cend(source), KE::begin(dest),
+                                   std::move(unary_op));
+}
+
+template <class TeamHandleType, class InputIterator1, class InputIterator2,
+          class OutputIterator, class BinaryOperation,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIterator1, InputIterator2, OutputIterator>::value,
+                  OutputIterator>
+transform(const TeamHandleType& teamHandle, InputIterator1 first1,
+          InputIterator1 last1, InputIterator2 first2, OutputIterator d_first,
+          BinaryOperation binary_op) {
+  return Impl::transform_team_impl(teamHandle, first1, last1, first2, d_first,
+                                   std::move(binary_op));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class BinaryOperation,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto transform(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source1,
+    const ::Kokkos::View<DataType2, Properties2...>& source2,
+    const ::Kokkos::View<DataType3, Properties3...>& dest,
+    BinaryOperation binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source1);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source2);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_team_impl(teamHandle, KE::cbegin(source1),
+                                   KE::cend(source1), KE::cbegin(source2),
+                                   KE::begin(dest), std::move(binary_op));
+}
+
 // -------------------
 // generate
 // -------------------
-template <class ExecutionSpace, class IteratorType, class Generator>
+template <class ExecutionSpace, class IteratorType, class Generator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void generate(const ExecutionSpace& ex, IteratorType first, IteratorType last,
               Generator g) {
   Impl::generate_impl("Kokkos::generate_iterator_api_default", ex, first, last,
@@ -1220,7 +1861,7 @@ void generate(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class Generator>
+          class Generator, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void generate(const ExecutionSpace& ex,
               const ::Kokkos::View<DataType, Properties...>& view,
               Generator g) {
@@ -1240,10 +1881,32 @@ void generate(const std::string& label, const ExecutionSpace& ex,
   Impl::generate_impl(label, ex, begin(view), end(view), std::move(g));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Generator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void generate(const TeamHandleType& teamHandle,
+                              IteratorType first, IteratorType last,
+                              Generator g) {
+  Impl::generate_team_impl(teamHandle, first, last, std::move(g));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class Generator, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void generate(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, Generator g) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::generate_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                           std::move(g));
+}
+
 // -------------------
 // generate_n
 // -------------------
-template <class ExecutionSpace, class IteratorType, class Size, class Generator>
+template <class ExecutionSpace, class IteratorType, class Size, class Generator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType generate_n(const ExecutionSpace& ex, IteratorType first,
                         Size count, Generator g) {
   Impl::generate_n_impl("Kokkos::generate_n_iterator_api_default", ex, first,
@@ -1259,7 +1922,7 @@ IteratorType generate_n(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties, class Size,
-          class Generator>
+          class Generator, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto generate_n(const ExecutionSpace& ex,
                 const ::Kokkos::View<DataType, Properties...>& view, Size count,
                 Generator g) {
@@ -1279,6 +1942,28 @@ auto generate_n(const std::string& label, const ExecutionSpace& ex,
   return Impl::generate_n_impl(label, ex, begin(view), count, std::move(g));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType, class Size, class Generator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType generate_n(const TeamHandleType& teamHandle,
+                                        IteratorType first, Size count,
+                                        Generator g) {
+  return Impl::generate_n_team_impl(teamHandle, first, count, std::move(g));
+}
+
+template <class TeamHandleType, class DataType, class... Properties, class Size,
+          class Generator, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto generate_n(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view, Size count,
+    Generator g) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::generate_n_team_impl(teamHandle, KE::begin(view), count,
+                                    std::move(g));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -80,16 +80,16 @@ struct StdUniqueCopyFunctor {
   KOKKOS_FUNCTION
   void operator()(const IndexType i, IndexType& update,
                   const bool final_pass) const {
-    const auto& val_i   = m_first_from[i];
-    const auto& val_ip1 = m_first_from[i + 1];
-
-    if (final_pass) {
-      if (!m_pred(val_i, val_ip1)) {
+    // the last element is always copied, any other one only if it
+    // is not equivalent to the element following it
+    const auto& val_i = m_first_from[i];
+    const bool keep   = (i == (m_last_from - m_first_from) - 1) ||
+                      !m_pred(val_i, m_first_from[i + 1]);
+
+    if (keep) {
+      if (final_pass) {
         m_first_dest[update] = val_i;
       }
-    }
-
-    if (!m_pred(val_i, val_ip1)) {
       update += 1;
     }
   }
@@ -118,6 +118,7 @@ struct StdReverseFunctor {
 #endif
   }
 
+  KOKKOS_FUNCTION
   StdReverseFunctor(InputIterator first, InputIterator last)
       : m_first(std::move(first)), m_last(std::move(last)) {}
 };
@@ -133,6 +134,7 @@ struct StdReverseCopyFunctor {
   KOKKOS_FUNCTION
   void operator()(IndexType i) const { m_dest_first[i] = m_last[-1 - i]; }
 
+  KOKKOS_FUNCTION
   StdReverseCopyFunctor(InputIterator _last, OutputIterator _dest_first)
       : m_last(std::move(_last)), m_dest_first(std::move(_dest_first)) {}
 };
@@ -147,6 +149,7 @@ struct StdMoveFunctor {
     m_dest_first[i] = std::move(m_first[i]);
   }
 
+  KOKKOS_FUNCTION
   StdMoveFunctor(InputIterator _first, OutputIterator _dest_first)
       : m_first(std::move(_first)), m_dest_first(std::move(_dest_first)) {}
 };
@@ -164,6 +167,7 @@ struct StdMoveBackwardFunctor {
     m_dest_last[-i] = std::move(m_last[-i]);
   }
 
+  KOKKOS_FUNCTION
   StdMoveBackwardFunctor(IteratorType1 _last, IteratorType2 _dest_last)
       : m_last(std::move(_last)), m_dest_last(std::move(_dest_last)) {}
 };
@@ -192,37 +196,24 @@ struct StdSwapRangesFunctor {
       : m_first1(std::move(_first1)), m_first2(std::move(_first2)) {}
 };
 
-template <class IndexType, class InputIt, class OutputIt,
-          class BinaryPredicateType>
-struct StdUniqueFunctor {
-  InputIt m_first_from;
-  InputIt m_last_from;
-  OutputIt m_first_dest;
+// keeps element i unless it is equivalent to the element following it,
+// the last element of the range is always kept
+template <class IndexType, class IteratorType, class BinaryPredicateType>
+struct StdUniqueKeepFunctor {
+  IteratorType m_first;
+  IndexType m_num_elements;
   BinaryPredicateType m_pred;
 
   KOKKOS_FUNCTION
-  StdUniqueFunctor(InputIt first_from, InputIt last_from, OutputIt first_dest,
-                   BinaryPredicateType pred)
-      : m_first_from(std::move(first_from)),
-        m_last_from(std::move(last_from)),
-        m_first_dest(std::move(first_dest)),
+  StdUniqueKeepFunctor(IteratorType first, IndexType num_elements,
+                       BinaryPredicateType pred)
+      : m_first(std::move(first)),
+        m_num_elements(num_elements),
         m_pred(std::move(pred)) {}
 
   KOKKOS_FUNCTION
-  void operator()(const IndexType i, IndexType& update,
-                  const bool final_pass) const {
-    auto& val_i         = m_first_from[i];
-    const auto& val_ip1 = m_first_from[i + 1];
-
-    if (final_pass) {
-      if (!m_pred(val_i, val_ip1)) {
-        m_first_dest[update] = std::move(val_i);
-      }
-    }
-
-    if (!m_pred(val_i, val_ip1)) {
-      update += 1;
-    }
+  bool operator()(const IndexType i) const {
+    return (i == m_num_elements - 1) || !m_pred(m_first[i], m_first[i + 1]);
   }
 };
 
@@ -244,6 +235,7 @@ struct StdRotateCopyFunctor {
     }
   }
 
+  KOKKOS_FUNCTION
   StdRotateCopyFunctor(InputIterator first, InputIterator last,
                        InputIterator first_n, OutputIterator dest_first)
       : m_first(std::move(first)),
@@ -252,50 +244,65 @@ struct StdRotateCopyFunctor {
         m_dest_first(std::move(dest_first)) {}
 };
 
-template <class IndexType, class FirstFrom, class FirstDest, class PredType>
-struct StdRemoveIfStage1Functor {
+// keeps element i unless it satisfies the predicate
+template <class IndexType, class IteratorType, class PredicateType>
+struct StdRemoveIfKeepFunctor {
+  IteratorType m_first;
+  PredicateType m_must_remove;
+
+  KOKKOS_FUNCTION
+  StdRemoveIfKeepFunctor(IteratorType first, PredicateType pred)
+      : m_first(std::move(first)), m_must_remove(std::move(pred)) {}
+
+  KOKKOS_FUNCTION
+  bool operator()(const IndexType i) const {
+    return !m_must_remove(m_first[i]);
+  }
+};
+
+// moves the elements for which keep(i) is true to consecutive
+// locations of the destination
+template <class IndexType, class FirstFrom, class FirstDest,
+          class KeepFunctorType>
+struct StdCompactFunctor {
   FirstFrom m_first_from;
   FirstDest m_first_dest;
-  PredType m_must_remove;
+  KeepFunctorType m_keep;
 
   KOKKOS_FUNCTION
-  StdRemoveIfStage1Functor(FirstFrom first_from, FirstDest first_dest,
-                           PredType pred)
+  StdCompactFunctor(FirstFrom first_from, FirstDest first_dest,
+                    KeepFunctorType keep)
       : m_first_from(std::move(first_from)),
         m_first_dest(std::move(first_dest)),
-        m_must_remove(std::move(pred)) {}
+        m_keep(std::move(keep)) {}
 
   KOKKOS_FUNCTION
   void operator()(const IndexType i, IndexType& update,
                   const bool final_pass) const {
-    auto& myval = m_first_from[i];
-    if (final_pass) {
-      if (!m_must_remove(myval)) {
+    if (m_keep(i)) {
+      if (final_pass) {
         // calling move here is ok because we are inside final pass
         // we are calling move assign as specified by the std
-        m_first_dest[update] = std::move(myval);
+        m_first_dest[update] = std::move(m_first_from[i]);
       }
-    }
-
-    if (!m_must_remove(myval)) {
       update += 1;
     }
   }
 };
 
-template <class IndexType, class InputIteratorType, class OutputIteratorType>
-struct StdRemoveIfStage2Functor {
-  InputIteratorType m_first_from;
-  OutputIteratorType m_first_to;
+// counts the elements for which keep(i) is true
+template <class IndexType, class KeepFunctorType>
+struct StdCountKeptFunctor {
+  KeepFunctorType m_keep;
 
   KOKKOS_FUNCTION
-  StdRemoveIfStage2Functor(InputIteratorType first_from,
-                           OutputIteratorType first_to)
-      : m_first_from(std::move(first_from)), m_first_to(std::move(first_to)) {}
+  StdCountKeptFunctor(KeepFunctorType keep) : m_keep(std::move(keep)) {}
 
   KOKKOS_FUNCTION
-  void operator()(const IndexType i) const {
-    m_first_to[i] = std::move(m_first_from[i]);
+  void operator()(const IndexType i, IndexType& count) const {
+    if (m_keep(i)) {
+      count += 1;
+    }
   }
 };
 
@@ -313,31 +320,24 @@ OutputIterator unique_copy_impl(const std::string& label,
   Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
   Impl::expect_valid_range(first, last);
 
-  // branch for trivial vs non trivial case
   const auto num_elements = Kokkos::Experimental::distance(first, last);
   if (num_elements == 0) {
     return d_first;
-  } else if (num_elements == 1) {
-    return Impl::copy_impl("Kokkos::copy_from_unique_copy", ex, first, last,
-                           d_first);
   } else {
     // aliases
     using index_type = typename InputIterator::difference_type;
     using func_type  = StdUniqueCopyFunctor<index_type, InputIterator,
                                            OutputIterator, PredicateType>;
 
-    // note here that we run scan for num_elements - 1
-    // because of the way we implement this, the last element is always needed.
-    // We avoid performing checks inside functor that we are within limits
-    // and run a "safe" scan and then copy the last element.
-    const auto scan_size = num_elements - 1;
-    index_type count     = 0;
+    // a single scan: each element is compared with the next one,
+    // except for the last element which is always copied
+    index_type count = 0;
     ::Kokkos::parallel_scan(label,
-                            RangePolicy<ExecutionSpace>(ex, 0, scan_size),
+                            RangePolicy<ExecutionSpace>(ex, 0, num_elements),
                             func_type(first, last, d_first, pred), count);
 
-    return Impl::copy_impl("Kokkos::copy_from_unique_copy", ex,
-                           first + scan_size, last, d_first + count);
+    // fence not needed because of the scan accumulating into count
+    return d_first + count;
   }
 }
 
@@ -361,6 +361,59 @@ OutputIterator unique_copy_impl(const std::string& label,
   return unique_copy_impl(label, ex, first, last, d_first, binary_pred_t());
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class PredicateType>
+KOKKOS_FUNCTION OutputIterator unique_copy_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first, InputIterator last,
+    OutputIterator d_first, PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if (num_elements == 0) {
+    return d_first;
+  } else {
+    // aliases
+    using index_type = typename InputIterator::difference_type;
+    using func_type  = StdUniqueCopyFunctor<index_type, InputIterator,
+                                           OutputIterator, PredicateType>;
+    using keep_func_t =
+        StdUniqueKeepFunctor<index_type, InputIterator, PredicateType>;
+    using count_func_t = StdCountKeptFunctor<index_type, keep_func_t>;
+
+    // the nested scan does not return the total, so count first
+    index_type count = 0;
+    ::Kokkos::parallel_reduce(
+        TeamThreadRange(teamHandle, 0, num_elements),
+        count_func_t(keep_func_t(first, num_elements, pred)), count);
+
+    // run
+    ::Kokkos::parallel_scan(TeamThreadRange(teamHandle, 0, num_elements),
+                            func_type(first, last, d_first, pred));
+    teamHandle.team_barrier();
+
+    return d_first + count;
+  }
+}
+
+template <class TeamHandleType, class InputIterator, class OutputIterator>
+KOKKOS_FUNCTION OutputIterator unique_copy_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first, InputIterator last,
+    OutputIterator d_first) {
+  // aliases
+  using value_type1 = typename InputIterator::value_type;
+  using value_type2 = typename OutputIterator::value_type;
+
+  // default binary predicate uses ==
+  using binary_pred_t = StdAlgoEqualBinaryPredicate<value_type1, value_type2>;
+
+  // run
+  return unique_copy_team_impl(teamHandle, first, last, d_first,
+                               binary_pred_t());
+}
+
 // ------------------------------------------
 // reverse_impl
 // ------------------------------------------
@@ -385,6 +438,27 @@ void reverse_impl(const std::string& label, const ExecutionSpace& ex,
   }
 }
 
+template <class TeamHandleType, class InputIterator>
+KOKKOS_FUNCTION void reverse_team_impl(const TeamHandleType& teamHandle,
+                                       InputIterator first,
+                                       InputIterator last) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using func_t = StdReverseFunctor<InputIterator>;
+
+  // run
+  if (last >= first + 2) {
+    // only need half
+    const auto num_elements = Kokkos::Experimental::distance(first, last) / 2;
+    ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                           func_t(first, last));
+    teamHandle.team_barrier();
+  }
+}
+
 // ------------------------------------------
 // reverse_copy_impl
 // ------------------------------------------
@@ -413,6 +487,30 @@ OutputIterator reverse_copy_impl(const std::string& label,
   return d_first + num_elements;
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator>
+KOKKOS_FUNCTION OutputIterator reverse_copy_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first, InputIterator last,
+    OutputIterator d_first) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using index_type = typename InputIterator::difference_type;
+  using func_t =
+      StdReverseCopyFunctor<index_type, InputIterator, OutputIterator>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(last, d_first));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements;
+}
+
 // ------------------------------------------
 // move_impl
 // ------------------------------------------
@@ -440,6 +538,30 @@ OutputIterator move_impl(const std::string& label, const ExecutionSpace& ex,
   return d_first + num_elements;
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator>
+KOKKOS_FUNCTION OutputIterator move_team_impl(const TeamHandleType& teamHandle,
+                                              InputIterator first,
+                                              InputIterator last,
+                                              OutputIterator d_first) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using index_type = typename InputIterator::difference_type;
+  using func_t     = StdMoveFunctor<index_type, InputIterator, OutputIterator>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(first, d_first));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements;
+}
+
 // ------------------------------------------
 // move_backward_impl
 // ------------------------------------------
@@ -468,6 +590,30 @@ IteratorType2 move_backward_impl(const std::string& label,
   return d_last - num_elements;
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType2 move_backward_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first, IteratorType1 last,
+    IteratorType2 d_last) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_last);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_last);
+  Impl::expect_valid_range(first, last);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t =
+      StdMoveBackwardFunctor<index_type, IteratorType1, IteratorType2>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_t(last, d_last));
+  teamHandle.team_barrier();
+
+  // return
+  return d_last - num_elements;
+}
+
 // ------------------------------------------
 // swap_ranges_impl
 // ------------------------------------------
@@ -496,6 +642,177 @@ IteratorType2 swap_ranges_impl(const std::string& label,
   return first2 + num_elements_to_swap;
 }
 
+template <class TeamHandleType, class IteratorType1, class IteratorType2>
+KOKKOS_FUNCTION IteratorType2 swap_ranges_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using func_t = StdSwapRangesFunctor<index_type, IteratorType1, IteratorType2>;
+
+  // run
+  const auto num_elements_to_swap =
+      Kokkos::Experimental::distance(first1, last1);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements_to_swap),
+                         func_t(first1, first2));
+  teamHandle.team_barrier();
+
+  // return
+  return first2 + num_elements_to_swap;
+}
+
+// The window, and so the buffer, holds 1/32 of the elements to explore,
+// but not less than a fixed minimum so that small ranges are not split
+// into tiny kernels. It does not depend on the execution space: its
+// concurrency would make the buffer as large as the range on devices.
+template <class IndexType>
+IndexType compact_window_size(const IndexType num_to_explore) {
+  constexpr IndexType min_window_size = 2048;
+  IndexType window_size               = (num_to_explore + 31) / 32;
+  window_size = (window_size < min_window_size) ? min_window_size : window_size;
+  return (window_size < num_to_explore) ? window_size : num_to_explore;
+}
+
+// ------------------------------------------
+// compact_impl
+// ------------------------------------------
+// Moves the elements at indices [begin_index, num_indices) of the range
+// starting at first for which keep(i) is true, preserving their order,
+// to the locations starting at first + begin_index, and returns the index
+// one past the last element kept.
+//
+// A single scan cannot do this in place because an element may be
+// overwritten before the thread in charge of it has read it. So we go
+// through the range in consecutive windows: all the locations between the
+// destination and the current window hold elements already moved, so when
+// this gap is at least as large as the window the kept elements are moved
+// there directly, otherwise they are moved to a small buffer and back.
+// The gap grows with every element removed, so do the windows moved
+// directly, and the buffer is only a fraction of the range.
+template <class IndexType, class ExecutionSpace, class IteratorType,
+          class KeepFunctorType>
+IndexType compact_impl(const std::string& label, const ExecutionSpace& ex,
+                       IteratorType first, const IndexType begin_index,
+                       const IndexType num_indices,
+                       const KeepFunctorType& keep) {
+  const IndexType window_size = compact_window_size(num_indices - begin_index);
+
+  // aliases
+  using value_type        = typename IteratorType::value_type;
+  using tmp_view_type     = ::Kokkos::View<value_type*, ExecutionSpace>;
+  using tmp_iterator_type = decltype(begin(std::declval<tmp_view_type&>()));
+  using direct_func_t =
+      StdCompactFunctor<IndexType, IteratorType, IteratorType, KeepFunctorType>;
+  using buffered_func_t = StdCompactFunctor<IndexType, IteratorType,
+                                            tmp_iterator_type, KeepFunctorType>;
+  using move_back_func_t =
+      StdMoveFunctor<IndexType, tmp_iterator_type, IteratorType>;
+
+  tmp_view_type tmp_view;
+  IndexType dest_index   = begin_index;
+  IndexType window_begin = begin_index;
+  while (window_begin < num_indices) {
+    const IndexType gap = window_begin - dest_index;
+    IndexType count     = 0;
+    if (gap >= window_size) {
+      const IndexType window_end = (num_indices - window_begin <= gap)
+                                       ? num_indices
+                                       : window_begin + gap;
+      ::Kokkos::parallel_scan(
+          label, RangePolicy<ExecutionSpace>(ex, window_begin, window_end),
+          direct_func_t(first, first + dest_index, keep), count);
+      window_begin = window_end;
+    } else {
+      if (tmp_view.extent(0) == 0) {
+        tmp_view = tmp_view_type(
+            view_alloc(ex, WithoutInitializing, "std_compact_tmp_view"),
+            window_size);
+      }
+
+      const IndexType window_end = (num_indices - window_begin <= window_size)
+                                       ? num_indices
+                                       : window_begin + window_size;
+      ::Kokkos::parallel_scan(
+          label, RangePolicy<ExecutionSpace>(ex, window_begin, window_end),
+          buffered_func_t(first, begin(tmp_view), keep), count);
+      ::Kokkos::parallel_for("Kokkos::compact_move_back",
+                             RangePolicy<ExecutionSpace>(ex, 0, count),
+                             move_back_func_t(begin(tmp_view),
+                                              first + dest_index));
+      window_begin = window_end;
+    }
+    dest_index += count;
+  }
+
+  ex.fence("Kokkos::compact: fence after operation");
+  return dest_index;
+}
+
+// Same as compact_impl for a team, which cannot allocate the buffer:
+// when the gap is smaller than the team, the window has one element per
+// thread, every thread holds its element to keep while the team computes
+// where it goes, and then all of them are moved at once.
+template <class IndexType, class TeamHandleType, class IteratorType,
+          class KeepFunctorType>
+KOKKOS_FUNCTION IndexType compact_team_impl(const TeamHandleType& teamHandle,
+                                            IteratorType first,
+                                            const IndexType begin_index,
+                                            const IndexType num_indices,
+                                            const KeepFunctorType& keep) {
+  // aliases
+  using value_type = typename IteratorType::value_type;
+  using direct_func_t =
+      StdCompactFunctor<IndexType, IteratorType, IteratorType, KeepFunctorType>;
+  using count_func_t = StdCountKeptFunctor<IndexType, KeepFunctorType>;
+
+  const IndexType team_size = teamHandle.team_size();
+  IndexType dest_index      = begin_index;
+  IndexType window_begin    = begin_index;
+  while (window_begin < num_indices) {
+    const IndexType gap = window_begin - dest_index;
+    IndexType window_end;
+    IndexType count = 0;
+    if (gap >= team_size) {
+      window_end = (num_indices - window_begin <= gap) ? num_indices
+                                                       : window_begin + gap;
+      ::Kokkos::parallel_reduce(
+          TeamThreadRange(teamHandle, window_begin, window_end),
+          count_func_t(keep), count);
+      ::Kokkos::parallel_scan(
+          TeamThreadRange(teamHandle, window_begin, window_end),
+          direct_func_t(first, first + dest_index, keep));
+    } else {
+      window_end = (num_indices - window_begin <= team_size)
+                       ? num_indices
+                       : window_begin + team_size;
+      const IndexType i = window_begin + teamHandle.team_rank();
+      const bool keep_i = (i < window_end) && keep(i);
+      value_type value_i;
+      if (keep_i) {
+        value_i = std::move(first[i]);
+      }
+
+      // every element of the window has been read once the scan is done
+      const IndexType offset = teamHandle.team_scan(IndexType(keep_i));
+      count                  = offset + IndexType(keep_i);
+      teamHandle.team_broadcast(count, team_size - 1);
+      if (keep_i) {
+        first[dest_index + offset] = std::move(value_i);
+      }
+    }
+    teamHandle.team_barrier();
+    window_begin = window_end;
+    dest_index += count;
+  }
+
+  return dest_index;
+}
+
 // ------------------------------------------
 // unique_impl
 // ------------------------------------------
@@ -513,10 +830,8 @@ IteratorType unique_impl(const std::string& label, const ExecutionSpace& ex,
   } else if (num_elements == 1) {
     return last;
   } else {
-    // ----------
-    // step 1:
-    // find first location of adjacent equal elements
-    // ----------
+    // find first location of adjacent equal elements:
+    // everything before it is unique and stays where it is
     auto it_found =
         ::Kokkos::Experimental::adjacent_find(ex, first, last, pred);
 
@@ -524,64 +839,15 @@ IteratorType unique_impl(const std::string& label, const ExecutionSpace& ex,
     if (it_found == last) {
       return last;
     } else {
-      // if here, we found some equal adjacent elements,
-      // so count all preceeding unique elements
-      const auto num_unique_found_in_step_one = it_found - first;
-
-      // ----------
-      // step 2:
-      // ----------
-      // since we found some unique elements, we don't need to explore
-      // the full range [first, last), but only need to focus on the
-      // remaining range [it_found, last)
-      const auto num_elements_to_explore = last - it_found;
-
-      // create a tmp view to use to *move* all unique elements
-      // using the same algorithm used for unique_copy but we now move things
-      using value_type    = typename IteratorType::value_type;
-      using tmp_view_type = Kokkos::View<value_type*, ExecutionSpace>;
-      tmp_view_type tmp_view("std_unique_tmp_view", num_elements_to_explore);
-
-      // scan extent is: num_elements_to_explore - 1
-      // for same reason as the one explained in unique_copy
-      const auto scan_size = num_elements_to_explore - 1;
-      auto tmp_first       = ::Kokkos::Experimental::begin(tmp_view);
-      using output_it      = decltype(tmp_first);
-
+      // compact [it_found, last) in place, keeping every element
+      // that differs from the following one plus the last one
       using index_type = typename IteratorType::difference_type;
-      using func_type =
-          StdUniqueFunctor<index_type, IteratorType, output_it, PredicateType>;
-      index_type count = 0;
-      ::Kokkos::parallel_scan(
-          label, RangePolicy<ExecutionSpace>(ex, 0, scan_size),
-          func_type(it_found, last, tmp_first, pred), count);
-
-      // move last element too, for the same reason as the unique_copy
-      auto unused_r =
-          Impl::move_impl("Kokkos::move_from_unique", ex, it_found + scan_size,
-                          last, tmp_first + count);
-      (void)unused_r;  // r1 not used
-
-      // ----------
-      // step 3
-      // ----------
-      // move back from tmp to original range,
-      // ensuring we start overwriting after the original unique found
-      using tmp_readwrite_iterator_type = decltype(begin(tmp_view));
-      using step3_func_t =
-          StdMoveFunctor<index_type, tmp_readwrite_iterator_type, IteratorType>;
-
-      ::Kokkos::parallel_for(
-          "unique_step3_parfor",
-          RangePolicy<ExecutionSpace>(ex, 0, tmp_view.extent(0)),
-          step3_func_t(begin(tmp_view),
-                       (first + num_unique_found_in_step_one)));
-
-      ex.fence("Kokkos::unique: fence after operation");
-
-      // return iterator to one passed the last written
-      // (the +1 is needed to account for the last element, see above)
-      return (first + num_unique_found_in_step_one + count + 1);
+      using keep_func_t =
+          StdUniqueKeepFunctor<index_type, IteratorType, PredicateType>;
+      const auto new_end =
+          compact_impl(label, ex, first, it_found - first, num_elements,
+                       keep_func_t(first, num_elements, pred));
+      return first + new_end;
     }
   }
 }
@@ -594,6 +860,51 @@ IteratorType unique_impl(const std::string& label, const ExecutionSpace& ex,
   return unique_impl(label, ex, first, last, binary_pred_t());
 }
 
+template <class TeamHandleType, class IteratorType, class PredicateType>
+KOKKOS_FUNCTION IteratorType unique_team_impl(const TeamHandleType& teamHandle,
+                                              IteratorType first,
+                                              IteratorType last,
+                                              PredicateType pred) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if (num_elements == 0) {
+    return first;
+  } else if (num_elements == 1) {
+    return last;
+  } else {
+    // find first location of adjacent equal elements:
+    // everything before it is unique and stays where it is
+    auto it_found = adjacent_find_team_impl(teamHandle, first, last, pred);
+
+    // if none, all elements are unique, so nothing to do
+    if (it_found == last) {
+      return last;
+    } else {
+      // compact [it_found, last) in place, keeping every element
+      // that differs from the following one plus the last one
+      using index_type = typename IteratorType::difference_type;
+      using keep_func_t =
+          StdUniqueKeepFunctor<index_type, IteratorType, PredicateType>;
+      const auto new_end =
+          compact_team_impl(teamHandle, first, it_found - first, num_elements,
+                            keep_func_t(first, num_elements, pred));
+      return first + new_end;
+    }
+  }
+}
+
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION IteratorType unique_team_impl(const TeamHandleType& teamHandle,
+                                              IteratorType first,
+                                              IteratorType last) {
+  using value_type    = typename IteratorType::value_type;
+  using binary_pred_t = StdAlgoEqualBinaryPredicate<value_type>;
+  return unique_team_impl(teamHandle, first, last, binary_pred_t());
+}
+
 // ------------------------------------------
 // rotate_copy_impl
 // ------------------------------------------
@@ -658,6 +969,36 @@ OutputIterator rotate_copy_impl(const std::string& label,
   return d_first + num_elements;
 }
 
+template <class TeamHandleType, class InputIterator, class OutputIterator>
+KOKKOS_FUNCTION OutputIterator rotate_copy_team_impl(
+    const TeamHandleType& teamHandle, InputIterator first,
+    InputIterator n_first, InputIterator last, OutputIterator d_first) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first, d_first);
+  Impl::static_assert_iterators_have_matching_difference_type(first, d_first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(first, n_first);
+  Impl::expect_valid_range(n_first, last);
+
+  if (first == last) {
+    return d_first;
+  }
+
+  // aliases
+  using index_type = typename InputIterator::difference_type;
+  using func_type =
+      StdRotateCopyFunctor<index_type, InputIterator, OutputIterator>;
+
+  // run
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         func_type(first, last, n_first, d_first));
+  teamHandle.team_barrier();
+
+  // return
+  return d_first + num_elements;
+}
+
 // ------------------------------------------
 // rotate_impl
 // ------------------------------------------
@@ -817,6 +1158,34 @@ IteratorType rotate_impl(const std::string& label, const ExecutionSpace& ex,
   }
 }
 
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION IteratorType rotate_team_impl(const TeamHandleType& teamHandle,
+                                              IteratorType first,
+                                              IteratorType n_first,
+                                              IteratorType last) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+  Impl::expect_valid_range(first, n_first);
+  Impl::expect_valid_range(n_first, last);
+
+  if (first == n_first) {
+    return last;
+  }
+
+  if (n_first == last) {
+    return first;
+  }
+
+  // a team cannot allocate the temporary used by rotate_impl,
+  // so reverse the two parts and then the whole range
+  reverse_team_impl(teamHandle, first, n_first);
+  reverse_team_impl(teamHandle, n_first, last);
+  reverse_team_impl(teamHandle, first, last);
+
+  return first + (last - n_first);
+}
+
 // ------------------------------------------
 // remove_if_impl
 // ------------------------------------------
@@ -830,56 +1199,51 @@ IteratorType remove_if_impl(const std::string& label, const ExecutionSpace& ex,
   if (first == last) {
     return last;
   } else {
-    // create tmp buffer to use to *move* all elements that we need to keep.
-    // note that the tmp buffer is just large enought to store
-    // all elements to keep, because ideally we do not need/want one
-    // as large as the original range.
-    // To allocate the right tmp view, we need a call to count_if.
-    // We could just do a "safe" allocation of a buffer as
-    // large as (last-first), but I think a call to count_if is more afforable.
-
-    // count how many elements we need to keep
-    // note that the elements to remove are those that meet the predicate
-    const auto remove_count =
-        ::Kokkos::Experimental::count_if(ex, first, last, pred);
-    const auto keep_count =
-        Kokkos::Experimental::distance(first, last) - remove_count;
-
-    // create helper tmp view
-    using value_type    = typename IteratorType::value_type;
-    using tmp_view_type = Kokkos::View<value_type*, ExecutionSpace>;
-    tmp_view_type tmp_view("std_remove_if_tmp_view", keep_count);
-    using tmp_readwrite_iterator_type = decltype(begin(tmp_view));
-
-    // in stage 1, *move* all elements to keep from original range to tmp
-    // we use similar impl as copy_if except that we *move* rather than copy
+    // the elements before the first one to remove stay where they are
+    auto it_found = ::Kokkos::Experimental::find_if(ex, first, last, pred);
+    if (it_found == last) {
+      return last;
+    }
+
+    // compact [it_found, last) in place, *moving* the elements to keep
+    // as specified by the std
+    using index_type = typename IteratorType::difference_type;
+    using keep_func_t =
+        StdRemoveIfKeepFunctor<index_type, IteratorType, UnaryPredicateType>;
+    const auto num_elements = Kokkos::Experimental::distance(first, last);
+    const auto new_end = compact_impl(label, ex, first, it_found - first,
+                                      num_elements, keep_func_t(first, pred));
+    return first + new_end;
+  }
+}
+
+template <class TeamHandleType, class IteratorType, class UnaryPredicateType>
+KOKKOS_FUNCTION IteratorType remove_if_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    UnaryPredicateType pred) {
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    return last;
+  } else {
+    // the elements before the first one to remove stay where they are
+    auto it_found =
+        find_if_or_not_team_impl<true>(teamHandle, first, last, pred);
+    if (it_found == last) {
+      return last;
+    }
+
+    // compact [it_found, last) in place, *moving* the elements to keep
+    // as specified by the std
     using index_type = typename IteratorType::difference_type;
-    using func1_type = StdRemoveIfStage1Functor<index_type, IteratorType,
-                                                tmp_readwrite_iterator_type,
-                                                UnaryPredicateType>;
-
-    const auto scan_num_elements = Kokkos::Experimental::distance(first, last);
-    index_type scan_count        = 0;
-    ::Kokkos::parallel_scan(
-        label, RangePolicy<ExecutionSpace>(ex, 0, scan_num_elements),
-        func1_type(first, begin(tmp_view), pred), scan_count);
-
-    // scan_count should be equal to keep_count
-    assert(scan_count == keep_count);
-    (void)scan_count;  // to avoid unused complaints
-
-    // stage 2, we do parfor to move from tmp to original range
-    using func2_type =
-        StdRemoveIfStage2Functor<index_type, tmp_readwrite_iterator_type,
-                                 IteratorType>;
-    ::Kokkos::parallel_for(
-        "remove_if_stage2_parfor",
-        RangePolicy<ExecutionSpace>(ex, 0, tmp_view.extent(0)),
-        func2_type(begin(tmp_view), first));
-    ex.fence("Kokkos::remove_if: fence after stage2");
-
-    // return
-    return first + keep_count;
+    using keep_func_t =
+        StdRemoveIfKeepFunctor<index_type, IteratorType, UnaryPredicateType>;
+    const auto num_elements = Kokkos::Experimental::distance(first, last);
+    const auto new_end =
+        compact_team_impl(teamHandle, first, it_found - first, num_elements,
+                          keep_func_t(first, pred));
+    return first + new_end;
   }
 }
 
@@ -894,6 +1258,14 @@ auto remove_impl(const std::string& label, const ExecutionSpace& ex,
   return remove_if_impl(label, ex, first, last, predicate_type(value));
 }
 
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION auto remove_team_impl(const TeamHandleType& teamHandle,
+                                      IteratorType first, IteratorType last,
+                                      const ValueType& value) {
+  using predicate_type = StdAlgoEqualsValUnaryPredicate<ValueType>;
+  return remove_if_team_impl(teamHandle, first, last, predicate_type(value));
+}
+
 // ------------------------------------------
 // remove_copy_impl
 // ------------------------------------------
@@ -910,6 +1282,18 @@ auto remove_copy_impl(const std::string& label, const ExecutionSpace& ex,
                                          first_dest, predicate_type(value));
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType>
+KOKKOS_FUNCTION auto remove_copy_team_impl(const TeamHandleType& teamHandle,
+                                           InputIteratorType first_from,
+                                           InputIteratorType last_from,
+                                           OutputIteratorType first_dest,
+                                           const ValueType& value) {
+  using predicate_type = StdAlgoNotEqualsValUnaryPredicate<ValueType>;
+  return ::Kokkos::Experimental::copy_if(teamHandle, first_from, last_from,
+                                         first_dest, predicate_type(value));
+}
+
 template <class ExecutionSpace, class InputIteratorType,
           class OutputIteratorType, class UnaryPredicate>
 auto remove_copy_if_impl(const std::string& label, const ExecutionSpace& ex,
@@ -927,6 +1311,20 @@ auto remove_copy_if_impl(const std::string& label, const ExecutionSpace& ex,
                                          first_dest, pred_wrapper_type(pred));
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class UnaryPredicate>
+KOKKOS_FUNCTION auto remove_copy_if_team_impl(const TeamHandleType& teamHandle,
+                                              InputIteratorType first_from,
+                                              InputIteratorType last_from,
+                                              OutputIteratorType first_dest,
+                                              const UnaryPredicate& pred) {
+  using value_type = typename InputIteratorType::value_type;
+  using pred_wrapper_type =
+      StdAlgoNegateUnaryPredicateWrapper<value_type, UnaryPredicate>;
+  return ::Kokkos::Experimental::copy_if(teamHandle, first_from, last_from,
+                                         first_dest, pred_wrapper_type(pred));
+}
+
 template <class ExecutionSpace, class IteratorType>
 IteratorType shift_left_impl(const std::string& label, const ExecutionSpace& ex,
                              IteratorType first, IteratorType last,
@@ -1003,6 +1401,31 @@ IteratorType shift_left_impl(const std::string& label, const ExecutionSpace& ex,
   return last - n;
 }
 
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION IteratorType shift_left_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    typename IteratorType::difference_type n) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+  KOKKOS_EXPECTS(n >= 0);
+
+  // handle trivial cases
+  if (n == 0) {
+    return last;
+  }
+
+  if (n >= Kokkos::Experimental::distance(first, last)) {
+    return first;
+  }
+
+  // a team cannot allocate the temporary view used by shift_left_impl,
+  // so rotate in place: the first n elements end up in the moved-from part
+  rotate_team_impl(teamHandle, first, first + n, last);
+
+  return last - n;
+}
+
 template <class ExecutionSpace, class IteratorType>
 IteratorType shift_right_impl(const std::string& label,
                               const ExecutionSpace& ex, IteratorType first,
@@ -1079,12 +1502,38 @@ IteratorType shift_right_impl(const std::string& label,
   return first + n;
 }
 
+template <class TeamHandleType, class IteratorType>
+KOKKOS_FUNCTION IteratorType shift_right_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    typename IteratorType::difference_type n) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::expect_valid_range(first, last);
+  KOKKOS_EXPECTS(n >= 0);
+
+  // handle trivial cases
+  if (n == 0) {
+    return first;
+  }
+
+  if (n >= Kokkos::Experimental::distance(first, last)) {
+    return last;
+  }
+
+  // a team cannot allocate the temporary view used by shift_right_impl,
+  // so rotate in place: the last n elements end up in the moved-from part
+  rotate_team_impl(teamHandle, first, last - n, last);
+
+  return first + n;
+}
+
 }  // namespace Impl
 
 // -------------------
 // reverse_copy
 // -------------------
-template <class ExecutionSpace, class InputIterator, class OutputIterator>
+template <class ExecutionSpace, class InputIterator, class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator reverse_copy(const ExecutionSpace& ex, InputIterator first,
                             InputIterator last, OutputIterator d_first) {
   return Impl::reverse_copy_impl("Kokkos::reverse_copy_iterator_api_default",
@@ -1099,7 +1548,8 @@ OutputIterator reverse_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto reverse_copy(const ExecutionSpace& ex,
                   const ::Kokkos::View<DataType1, Properties1...>& source,
                   ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -1122,10 +1572,36 @@ auto reverse_copy(const std::string& label, const ExecutionSpace& ex,
                                  begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator reverse_copy(const TeamHandleType& teamHandle,
+                                            InputIterator first,
+                                            InputIterator last,
+                                            OutputIterator d_first) {
+  return Impl::reverse_copy_team_impl(teamHandle, first, last, d_first);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto reverse_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reverse_copy_team_impl(teamHandle, KE::cbegin(source),
+                                      KE::cend(source), KE::begin(dest));
+}
+
 // -------------------
 // reverse
 // -------------------
-template <class ExecutionSpace, class InputIterator>
+template <class ExecutionSpace, class InputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void reverse(const ExecutionSpace& ex, InputIterator first,
              InputIterator last) {
   return Impl::reverse_impl("Kokkos::reverse_iterator_api_default", ex, first,
@@ -1138,7 +1614,8 @@ void reverse(const std::string& label, const ExecutionSpace& ex,
   return Impl::reverse_impl(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 void reverse(const ExecutionSpace& ex,
              const ::Kokkos::View<DataType, Properties...>& view) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
@@ -1155,10 +1632,30 @@ void reverse(const std::string& label, const ExecutionSpace& ex,
   return Impl::reverse_impl(label, ex, KE::begin(view), KE::end(view));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void reverse(const TeamHandleType& teamHandle,
+                             InputIterator first, InputIterator last) {
+  Impl::reverse_team_impl(teamHandle, first, last);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION void reverse(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  Impl::reverse_team_impl(teamHandle, KE::begin(view), KE::end(view));
+}
+
 // ----------------------
 // move
 // ----------------------
-template <class ExecutionSpace, class InputIterator, class OutputIterator>
+template <class ExecutionSpace, class InputIterator, class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator move(const ExecutionSpace& ex, InputIterator first,
                     InputIterator last, OutputIterator d_first) {
   return Impl::move_impl("Kokkos::move_iterator_api_default", ex, first, last,
@@ -1173,7 +1670,8 @@ OutputIterator move(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto move(const ExecutionSpace& ex,
           const ::Kokkos::View<DataType1, Properties1...>& source,
           ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -1195,10 +1693,35 @@ auto move(const std::string& label, const ExecutionSpace& ex,
   return Impl::move_impl(label, ex, begin(source), end(source), begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator move(const TeamHandleType& teamHandle,
+                                    InputIterator first, InputIterator last,
+                                    OutputIterator d_first) {
+  return Impl::move_team_impl(teamHandle, first, last, d_first);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto move(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::move_team_impl(teamHandle, KE::begin(source), KE::end(source),
+                              KE::begin(dest));
+}
+
 // -------------------
 // move_backward
 // -------------------
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType2 move_backward(const ExecutionSpace& ex, IteratorType1 first,
                             IteratorType1 last, IteratorType2 d_last) {
   return Impl::move_backward_impl("Kokkos::move_backward_iterator_api_default",
@@ -1206,7 +1729,8 @@ IteratorType2 move_backward(const ExecutionSpace& ex, IteratorType1 first,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto move_backward(const ExecutionSpace& ex,
                    const ::Kokkos::View<DataType1, Properties1...>& source,
                    ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -1236,10 +1760,36 @@ auto move_backward(const std::string& label, const ExecutionSpace& ex,
                                   end(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType2 move_backward(const TeamHandleType& teamHandle,
+                                            IteratorType1 first,
+                                            IteratorType1 last,
+                                            IteratorType2 d_last) {
+  return Impl::move_backward_team_impl(teamHandle, first, last, d_last);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto move_backward(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::move_backward_team_impl(teamHandle, KE::begin(source),
+                                       KE::end(source), KE::end(dest));
+}
+
 // ----------------------
 // swap_ranges
 // ----------------------
-template <class ExecutionSpace, class IteratorType1, class IteratorType2>
+template <class ExecutionSpace, class IteratorType1, class IteratorType2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType2 swap_ranges(const ExecutionSpace& ex, IteratorType1 first1,
                           IteratorType1 last1, IteratorType2 first2) {
   return Impl::swap_ranges_impl("Kokkos::swap_ranges_iterator_api_default", ex,
@@ -1247,7 +1797,8 @@ IteratorType2 swap_ranges(const ExecutionSpace& ex, IteratorType1 first1,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto swap_ranges(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType1, Properties1...>& source,
                  ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -1279,6 +1830,33 @@ auto swap_ranges(const std::string& label, const ExecutionSpace& ex,
                                 begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType2 swap_ranges(const TeamHandleType& teamHandle,
+                                          IteratorType1 first1,
+                                          IteratorType1 last1,
+                                          IteratorType2 first2) {
+  return Impl::swap_ranges_team_impl(teamHandle, first1, last1, first2);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto swap_ranges(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  assert(source.extent(0) == dest.extent(0));
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::swap_ranges_team_impl(teamHandle, KE::begin(source),
+                                     KE::end(source), KE::begin(dest));
+}
+
 // -------------------
 // unique
 // -------------------
@@ -1286,7 +1864,8 @@ auto swap_ranges(const std::string& label, const ExecutionSpace& ex,
 // for example in the unit test when using a variadic function
 
 // overload set1
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t<!::Kokkos::is_view<IteratorType>::value, IteratorType> unique(
     const ExecutionSpace& ex, IteratorType first, IteratorType last) {
   return Impl::unique_impl("Kokkos::unique_iterator_api_default", ex, first,
@@ -1300,7 +1879,8 @@ std::enable_if_t<!::Kokkos::is_view<IteratorType>::value, IteratorType> unique(
   return Impl::unique_impl(label, ex, first, last);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto unique(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view) {
   Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
@@ -1316,7 +1896,8 @@ auto unique(const std::string& label, const ExecutionSpace& ex,
 }
 
 // overload set2
-template <class ExecutionSpace, class IteratorType, class BinaryPredicate>
+template <class ExecutionSpace, class IteratorType, class BinaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType unique(const ExecutionSpace& ex, IteratorType first,
                     IteratorType last, BinaryPredicate pred) {
   return Impl::unique_impl("Kokkos::unique_iterator_api_default", ex, first,
@@ -1331,7 +1912,8 @@ IteratorType unique(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class BinaryPredicate>
+          class BinaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto unique(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view,
             BinaryPredicate pred) {
@@ -1349,6 +1931,47 @@ auto unique(const std::string& label, const ExecutionSpace& ex,
   return Impl::unique_impl(label, ex, begin(view), end(view), std::move(pred));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType unique(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last) {
+  return Impl::unique_team_impl(teamHandle, first, last);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto unique(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::unique_team_impl(teamHandle, KE::begin(view), KE::end(view));
+}
+
+template <class TeamHandleType, class IteratorType, class BinaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType unique(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType last,
+                                    BinaryPredicate pred) {
+  return Impl::unique_team_impl(teamHandle, first, last, pred);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class BinaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto unique(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    BinaryPredicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::unique_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                std::move(pred));
+}
+
 // -------------------
 // unique_copy
 // -------------------
@@ -1356,7 +1979,8 @@ auto unique(const std::string& label, const ExecutionSpace& ex,
 // for example in the unit test when using a variadic function
 
 // overload set1
-template <class ExecutionSpace, class InputIterator, class OutputIterator>
+template <class ExecutionSpace, class InputIterator, class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t<!::Kokkos::is_view<InputIterator>::value, OutputIterator>
 unique_copy(const ExecutionSpace& ex, InputIterator first, InputIterator last,
             OutputIterator d_first) {
@@ -1372,7 +1996,8 @@ unique_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto unique_copy(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType1, Properties1...>& source,
                  const ::Kokkos::View<DataType2, Properties2...>& dest) {
@@ -1398,7 +2023,8 @@ auto unique_copy(const std::string& label, const ExecutionSpace& ex,
 
 // overload set2
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class BinaryPredicate>
+          class BinaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator unique_copy(const ExecutionSpace& ex, InputIterator first,
                            InputIterator last, OutputIterator d_first,
                            BinaryPredicate pred) {
@@ -1415,7 +2041,8 @@ OutputIterator unique_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryPredicate>
+          class DataType2, class... Properties2, class BinaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto unique_copy(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType1, Properties1...>& source,
                  const ::Kokkos::View<DataType2, Properties2...>& dest,
@@ -1441,11 +2068,65 @@ auto unique_copy(const std::string& label, const ExecutionSpace& ex,
                                 begin(dest), std::move(pred));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator unique_copy(const TeamHandleType& teamHandle,
+                                           InputIterator first,
+                                           InputIterator last,
+                                           OutputIterator d_first) {
+  return Impl::unique_copy_team_impl(teamHandle, first, last, d_first);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto unique_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::unique_copy_team_impl(teamHandle, KE::cbegin(source),
+                                     KE::cend(source), KE::begin(dest));
+}
+
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class BinaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator unique_copy(const TeamHandleType& teamHandle,
+                                           InputIterator first,
+                                           InputIterator last,
+                                           OutputIterator d_first,
+                                           BinaryPredicate pred) {
+  return Impl::unique_copy_team_impl(teamHandle, first, last, d_first, pred);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto unique_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    const ::Kokkos::View<DataType2, Properties2...>& dest,
+    BinaryPredicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::unique_copy_team_impl(teamHandle, KE::cbegin(source),
+                                     KE::cend(source), KE::begin(dest),
+                                     std::move(pred));
+}
+
 // -------------------
 // rotate
 // -------------------
 
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType rotate(const ExecutionSpace& ex, IteratorType first,
                     IteratorType n_first, IteratorType last) {
   return Impl::rotate_impl("Kokkos::rotate_iterator_api_default", ex, first,
@@ -1459,7 +2140,8 @@ IteratorType rotate(const std::string& label, const ExecutionSpace& ex,
   return Impl::rotate_impl(label, ex, first, n_first, last);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto rotate(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view,
             std::size_t n_location) {
@@ -1477,11 +2159,33 @@ auto rotate(const std::string& label, const ExecutionSpace& ex,
                            end(view));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType rotate(const TeamHandleType& teamHandle,
+                                    IteratorType first, IteratorType n_first,
+                                    IteratorType last) {
+  return Impl::rotate_team_impl(teamHandle, first, n_first, last);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto rotate(const TeamHandleType& teamHandle,
+                            const ::Kokkos::View<DataType, Properties...>& view,
+                            std::size_t n_location) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::rotate_team_impl(teamHandle, KE::begin(view),
+                                KE::begin(view) + n_location, KE::end(view));
+}
+
 // -------------------
 // rotate_copy
 // -------------------
 
-template <class ExecutionSpace, class InputIterator, class OutputIterator>
+template <class ExecutionSpace, class InputIterator, class OutputIterator,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator rotate_copy(const ExecutionSpace& ex, InputIterator first,
                            InputIterator n_first, InputIterator last,
                            OutputIterator d_first) {
@@ -1497,7 +2201,8 @@ OutputIterator rotate_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto rotate_copy(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType1, Properties1...>& source,
                  std::size_t n_location,
@@ -1524,10 +2229,40 @@ auto rotate_copy(const std::string& label, const ExecutionSpace& ex,
                                 begin(dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator rotate_copy(const TeamHandleType& teamHandle,
+                                           InputIterator first,
+                                           InputIterator n_first,
+                                           InputIterator last,
+                                           OutputIterator d_first) {
+  return Impl::rotate_copy_team_impl(teamHandle, first, n_first, last,
+                                     d_first);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto rotate_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& source,
+    std::size_t n_location,
+    const ::Kokkos::View<DataType2, Properties2...>& dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(source);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::rotate_copy_team_impl(
+      teamHandle, KE::cbegin(source), KE::cbegin(source) + n_location,
+      KE::cend(source), KE::begin(dest));
+}
+
 // -------------------
 // remove_if
 // -------------------
-template <class ExecutionSpace, class Iterator, class UnaryPredicate>
+template <class ExecutionSpace, class Iterator, class UnaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 Iterator remove_if(const ExecutionSpace& ex, Iterator first, Iterator last,
                    UnaryPredicate pred) {
   return Impl::remove_if_impl("Kokkos::remove_if_iterator_api_default", ex,
@@ -1541,7 +2276,8 @@ Iterator remove_if(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class UnaryPredicate>
+          class UnaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto remove_if(const ExecutionSpace& ex,
                const ::Kokkos::View<DataType, Properties...>& view,
                UnaryPredicate pred) {
@@ -1562,10 +2298,34 @@ auto remove_if(const std::string& label, const ExecutionSpace& ex,
                               ::Kokkos::Experimental::end(view), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class Iterator, class UnaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION Iterator remove_if(const TeamHandleType& teamHandle,
+                                   Iterator first, Iterator last,
+                                   UnaryPredicate pred) {
+  return Impl::remove_if_team_impl(teamHandle, first, last, pred);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class UnaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto remove_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    UnaryPredicate pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::remove_if_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                   pred);
+}
+
 // -------------------
 // remove
 // -------------------
-template <class ExecutionSpace, class Iterator, class ValueType>
+template <class ExecutionSpace, class Iterator, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 Iterator remove(const ExecutionSpace& ex, Iterator first, Iterator last,
                 const ValueType& value) {
   return Impl::remove_impl("Kokkos::remove_iterator_api_default", ex, first,
@@ -1579,7 +2339,7 @@ Iterator remove(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto remove(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view,
             const ValueType& value) {
@@ -1599,11 +2359,32 @@ auto remove(const std::string& label, const ExecutionSpace& ex,
                            ::Kokkos::Experimental::end(view), value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class Iterator, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION Iterator remove(const TeamHandleType& teamHandle,
+                                Iterator first, Iterator last,
+                                const ValueType& value) {
+  return Impl::remove_team_impl(teamHandle, first, last, value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto remove(const TeamHandleType& teamHandle,
+                            const ::Kokkos::View<DataType, Properties...>& view,
+                            const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::remove_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                value);
+}
+
 // -------------------
 // remove_copy
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator remove_copy(const ExecutionSpace& ex, InputIterator first_from,
                            InputIterator last_from, OutputIterator first_dest,
                            const ValueType& value) {
@@ -1621,7 +2402,8 @@ OutputIterator remove_copy(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class ValueType>
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto remove_copy(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType1, Properties1...>& view_from,
                  const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -1651,11 +2433,41 @@ auto remove_copy(const std::string& label, const ExecutionSpace& ex,
       ::Kokkos::Experimental::begin(view_dest), value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator remove_copy(const TeamHandleType& teamHandle,
+                                           InputIterator first_from,
+                                           InputIterator last_from,
+                                           OutputIterator first_dest,
+                                           const ValueType& value) {
+  return Impl::remove_copy_team_impl(teamHandle, first_from, last_from,
+                                     first_dest, value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto remove_copy(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    const ValueType& value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::remove_copy_team_impl(teamHandle, KE::cbegin(view_from),
+                                     KE::cend(view_from),
+                                     KE::begin(view_dest), value);
+}
+
 // -------------------
 // remove_copy_if
 // -------------------
 template <class ExecutionSpace, class InputIterator, class OutputIterator,
-          class UnaryPredicate>
+          class UnaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 OutputIterator remove_copy_if(const ExecutionSpace& ex,
                               InputIterator first_from, InputIterator last_from,
                               OutputIterator first_dest,
@@ -1677,7 +2489,8 @@ OutputIterator remove_copy_if(const std::string& label,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class UnaryPredicate>
+          class DataType2, class... Properties2, class UnaryPredicate,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto remove_copy_if(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType1, Properties1...>& view_from,
                     const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -1707,10 +2520,41 @@ auto remove_copy_if(const std::string& label, const ExecutionSpace& ex,
       ::Kokkos::Experimental::begin(view_dest), pred);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIterator, class OutputIterator,
+          class UnaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION OutputIterator remove_copy_if(const TeamHandleType& teamHandle,
+                                              InputIterator first_from,
+                                              InputIterator last_from,
+                                              OutputIterator first_dest,
+                                              const UnaryPredicate& pred) {
+  return Impl::remove_copy_if_team_impl(teamHandle, first_from, last_from,
+                                        first_dest, pred);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class UnaryPredicate,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto remove_copy_if(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    const UnaryPredicate& pred) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::remove_copy_if_team_impl(teamHandle, KE::cbegin(view_from),
+                                        KE::cend(view_from),
+                                        KE::begin(view_dest), pred);
+}
+
 // -------------------
 // shift_left
 // -------------------
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType shift_left(const ExecutionSpace& ex, IteratorType first,
                         IteratorType last,
                         typename IteratorType::difference_type n) {
@@ -1725,7 +2569,8 @@ IteratorType shift_left(const std::string& label, const ExecutionSpace& ex,
   return Impl::shift_left_impl(label, ex, first, last, n);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto shift_left(const ExecutionSpace& ex,
                 const ::Kokkos::View<DataType, Properties...>& view,
                 typename decltype(begin(view))::difference_type n) {
@@ -1742,10 +2587,33 @@ auto shift_left(const std::string& label, const ExecutionSpace& ex,
   return Impl::shift_left_impl(label, ex, begin(view), end(view), n);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType
+shift_left(const TeamHandleType& teamHandle, IteratorType first,
+           IteratorType last, typename IteratorType::difference_type n) {
+  return Impl::shift_left_team_impl(teamHandle, first, last, n);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto shift_left(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    typename decltype(begin(view))::difference_type n) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::shift_left_team_impl(teamHandle, KE::begin(view), KE::end(view),
+                                    n);
+}
+
 // -------------------
 // shift_right
 // -------------------
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 IteratorType shift_right(const ExecutionSpace& ex, IteratorType first,
                          IteratorType last,
                          typename IteratorType::difference_type n) {
@@ -1760,7 +2628,8 @@ IteratorType shift_right(const std::string& label, const ExecutionSpace& ex,
   return Impl::shift_right_impl(label, ex, first, last, n);
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto shift_right(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& view,
                  typename decltype(begin(view))::difference_type n) {
@@ -1777,6 +2646,28 @@ auto shift_right(const std::string& label, const ExecutionSpace& ex,
   return Impl::shift_right_impl(label, ex, begin(view), end(view), n);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION IteratorType
+shift_right(const TeamHandleType& teamHandle, IteratorType first,
+            IteratorType last, typename IteratorType::difference_type n) {
+  return Impl::shift_right_team_impl(teamHandle, first, last, n);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto shift_right(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    typename decltype(begin(view))::difference_type n) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::shift_right_team_impl(teamHandle, KE::begin(view),
+                                     KE::end(view), n);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
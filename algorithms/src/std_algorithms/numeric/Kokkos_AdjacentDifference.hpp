@@ -135,6 +135,38 @@ OutputIteratorType adjacent_difference_impl(const std::string& label,
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOp>
+KOKKOS_FUNCTION OutputIteratorType adjacent_difference_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    BinaryOp bin_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  if (first_from == last_from) {
+    return first_dest;
+  }
+
+  // aliases
+  using functor_t =
+      StdAdjacentDiffFunctor<InputIteratorType, OutputIteratorType, BinaryOp>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  ::Kokkos::parallel_for(TeamThreadRange(teamHandle, 0, num_elements),
+                         functor_t(first_from, first_dest, bin_op));
+  teamHandle.team_barrier();
+
+  // return
+  return first_dest + num_elements;
+}
+
 }  // end namespace Impl
 
 // ------------------------
@@ -143,7 +175,8 @@ OutputIteratorType adjacent_difference_impl(const std::string& label,
 //
 // ------------------------
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType>
+          class OutputIteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t<!::Kokkos::is_view<InputIteratorType>::value,
                  OutputIteratorType>
 adjacent_difference(const ExecutionSpace& ex, InputIteratorType first_from,
@@ -160,7 +193,8 @@ adjacent_difference(const ExecutionSpace& ex, InputIteratorType first_from,
 }
 
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class BinaryOp>
+          class OutputIteratorType, class BinaryOp,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t<!::Kokkos::is_view<InputIteratorType>::value,
                  OutputIteratorType>
 adjacent_difference(const ExecutionSpace& ex, InputIteratorType first_from,
@@ -199,7 +233,8 @@ adjacent_difference(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto adjacent_difference(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -221,7 +256,8 @@ auto adjacent_difference(
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryOp>
+          class DataType2, class... Properties2, class BinaryOp,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto adjacent_difference(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -273,6 +309,79 @@ auto adjacent_difference(
                                         KE::begin(view_dest), bin_op);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t<!::Kokkos::is_view<InputIteratorType>::value,
+                 OutputIteratorType>
+adjacent_difference(const TeamHandleType& teamHandle,
+                    InputIteratorType first_from, InputIteratorType last_from,
+                    OutputIteratorType first_dest) {
+  using value_type1 = typename InputIteratorType::value_type;
+  using value_type2 = typename OutputIteratorType::value_type;
+  using binary_op =
+      Impl::StdAdjacentDifferenceDefaultBinaryOpFunctor<value_type1,
+                                                        value_type2>;
+  return Impl::adjacent_difference_team_impl(teamHandle, first_from, last_from,
+                                             first_dest, binary_op());
+}
+
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOp,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t<!::Kokkos::is_view<InputIteratorType>::value,
+                 OutputIteratorType>
+adjacent_difference(const TeamHandleType& teamHandle,
+                    InputIteratorType first_from, InputIteratorType last_from,
+                    OutputIteratorType first_dest, BinaryOp bin_op) {
+  return Impl::adjacent_difference_team_impl(teamHandle, first_from, last_from,
+                                             first_dest, bin_op);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto adjacent_difference(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  using view_type1  = ::Kokkos::View<DataType1, Properties1...>;
+  using view_type2  = ::Kokkos::View<DataType2, Properties2...>;
+  using value_type1 = typename view_type1::value_type;
+  using value_type2 = typename view_type2::value_type;
+  using binary_op =
+      Impl::StdAdjacentDifferenceDefaultBinaryOpFunctor<value_type1,
+                                                        value_type2>;
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::adjacent_difference_team_impl(teamHandle, KE::cbegin(view_from),
+                                             KE::cend(view_from),
+                                             KE::begin(view_dest), binary_op());
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryOp,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto adjacent_difference(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    BinaryOp bin_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::adjacent_difference_team_impl(teamHandle, KE::cbegin(view_from),
+                                             KE::cend(view_from),
+                                             KE::begin(view_dest), bin_op);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
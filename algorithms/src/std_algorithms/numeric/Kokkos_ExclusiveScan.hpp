@@ -52,6 +52,7 @@
 #include "../Kokkos_ModifyingOperations.hpp"
 #include "../Kokkos_ValueWrapperForNoNeutralElement.hpp"
 #include "Kokkos_IdentityReferenceUnaryFunctor.hpp"
+#include "Kokkos_TeamScanWithJoin.hpp"
 
 namespace Kokkos {
 namespace Experimental {
@@ -134,6 +135,8 @@ struct TransformExclusiveScanFunctor {
   KOKKOS_FUNCTION
   void operator()(const IndexType i, value_type& update,
                   const bool final_pass) const {
+    // read before writing so that the scan can be done in place
+    const auto tmp = value_type{m_unary_op(m_first_from[i]), false};
     if (final_pass) {
       if (i == 0) {
         // for both ExclusiveScan and TransformExclusiveScan,
@@ -144,7 +147,6 @@ struct TransformExclusiveScanFunctor {
       }
     }
 
-    const auto tmp = value_type{m_unary_op(m_first_from[i]), false};
     this->join(update, tmp);
   }
 
@@ -166,6 +168,34 @@ struct TransformExclusiveScanFunctor {
   }
 };
 
+// team-level scans only support summation (the accumulator
+// is zero-initialized by the team parallel_scan), so the team
+// functors work with the plain value type instead of the wrapper
+template <class IndexType, class ValueType, class FirstFrom, class FirstDest>
+struct ExclusiveScanDefaultTeamFunctor {
+  ValueType m_init_value;
+  FirstFrom m_first_from;
+  FirstDest m_first_dest;
+
+  KOKKOS_FUNCTION
+  ExclusiveScanDefaultTeamFunctor(ValueType init, FirstFrom first_from,
+                                  FirstDest first_dest)
+      : m_init_value(std::move(init)),
+        m_first_from(std::move(first_from)),
+        m_first_dest(std::move(first_dest)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, ValueType& update,
+                  const bool final_pass) const {
+    // read before writing so that the scan can be done in place
+    const ValueType tmp = m_first_from[i];
+    if (final_pass) {
+      m_first_dest[i] = update + m_init_value;
+    }
+    update += tmp;
+  }
+};
+
 // --------------------------------------------------
 // exclusive_scan_custom_op_impl
 // --------------------------------------------------
@@ -201,6 +231,39 @@ OutputIteratorType exclusive_scan_custom_op_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType, class BinaryOpType>
+KOKKOS_FUNCTION OutputIteratorType exclusive_scan_custom_op_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    ValueType init_value, BinaryOpType bop) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space     = typename TeamHandleType::execution_space;
+  using index_type    = typename InputIteratorType::difference_type;
+  using unary_op_type = StdNumericScanIdentityReferenceUnaryFunctor<ValueType>;
+  using func_type =
+      TransformExclusiveScanFunctor<exe_space, index_type, ValueType,
+                                    InputIteratorType, OutputIteratorType,
+                                    BinaryOpType, unary_op_type>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(
+      teamHandle, num_elements,
+      func_type(init_value, first_from, first_dest, bop, unary_op_type()));
+
+  // return
+  return first_dest + num_elements;
+}
+
 // --------------------------------------------------
 // transform_exclusive_scan_impl
 // --------------------------------------------------
@@ -237,6 +300,38 @@ OutputIteratorType transform_exclusive_scan_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType, class BinaryOpType,
+          class UnaryOpType>
+KOKKOS_FUNCTION OutputIteratorType transform_exclusive_scan_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    ValueType init_value, BinaryOpType bop, UnaryOpType uop) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space  = typename TeamHandleType::execution_space;
+  using index_type = typename InputIteratorType::difference_type;
+  using func_type =
+      TransformExclusiveScanFunctor<exe_space, index_type, ValueType,
+                                    InputIteratorType, OutputIteratorType,
+                                    BinaryOpType, UnaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(teamHandle, num_elements,
+                      func_type(init_value, first_from, first_dest, bop, uop));
+
+  // return
+  return first_dest + num_elements;
+}
+
 // --------------------------------------------------
 // exclusive_scan_default_op_impl
 // --------------------------------------------------
@@ -290,6 +385,35 @@ OutputIteratorType exclusive_scan_default_op_impl(const std::string& label,
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType>
+KOKKOS_FUNCTION OutputIteratorType exclusive_scan_default_op_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    ValueType init_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using index_type = typename InputIteratorType::difference_type;
+  using func_type =
+      ExclusiveScanDefaultTeamFunctor<index_type, ValueType, InputIteratorType,
+                                      OutputIteratorType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  ::Kokkos::parallel_scan(TeamThreadRange(teamHandle, 0, num_elements),
+                          func_type(init_value, first_from, first_dest));
+  teamHandle.team_barrier();
+
+  return first_dest + num_elements;
+}
+
 }  // end namespace Impl
 
 ///////////////////////////////
@@ -300,7 +424,8 @@ OutputIteratorType exclusive_scan_default_op_impl(const std::string& label,
 
 // overload set 1
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class ValueType>
+          class OutputIteratorType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -329,7 +454,8 @@ exclusive_scan(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class ValueType>
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto exclusive_scan(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType1, Properties1...>& view_from,
                     const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -361,9 +487,48 @@ auto exclusive_scan(const std::string& label, const ExecutionSpace& ex,
                                               KE::begin(view_dest), init_value);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan(const TeamHandleType& teamHandle, InputIteratorType first,
+               InputIteratorType last, OutputIteratorType first_dest,
+               ValueType init_value) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  return Impl::exclusive_scan_default_op_team_impl(teamHandle, first, last,
+                                                   first_dest, init_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto exclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    ValueType init_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_default_op_team_impl(teamHandle,
+                                                   KE::cbegin(view_from),
+                                                   KE::cend(view_from),
+                                                   KE::begin(view_dest),
+                                                   init_value);
+}
+
 // overload set 2
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class ValueType, class BinaryOpType>
+          class OutputIteratorType, class ValueType, class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -396,7 +561,8 @@ exclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class ValueType,
-          class BinaryOpType>
+          class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto exclusive_scan(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType1, Properties1...>& view_from,
                     const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -431,6 +597,40 @@ auto exclusive_scan(const std::string& label, const ExecutionSpace& ex,
       KE::begin(view_dest), init_value, bop);
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType, class BinaryOpType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan(const TeamHandleType& teamHandle, InputIteratorType first,
+               InputIteratorType last, OutputIteratorType first_dest,
+               ValueType init_value, BinaryOpType bop) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  return Impl::exclusive_scan_custom_op_team_impl(teamHandle, first, last,
+                                                  first_dest, init_value, bop);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          class BinaryOpType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto exclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    ValueType init_value, BinaryOpType bop) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_custom_op_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), init_value, bop);
+}
+
 //////////////////////////////////////
 //
 // transform_exclusive_scan public API
@@ -439,7 +639,8 @@ auto exclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class InputIteratorType,
           class OutputIteratorType, class ValueType, class BinaryOpType,
-          class UnaryOpType>
+          class UnaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -474,7 +675,8 @@ transform_exclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class ValueType,
-          class BinaryOpType, class UnaryOpType>
+          class BinaryOpType, class UnaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto transform_exclusive_scan(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -511,6 +713,43 @@ auto transform_exclusive_scan(
       KE::begin(view_dest), init_value, binary_op, unary_op);
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class ValueType, class BinaryOpType,
+          class UnaryOpType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+transform_exclusive_scan(const TeamHandleType& teamHandle,
+                         InputIteratorType first, InputIteratorType last,
+                         OutputIteratorType first_dest, ValueType init_value,
+                         BinaryOpType binary_op, UnaryOpType unary_op) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  return Impl::transform_exclusive_scan_team_impl(
+      teamHandle, first, last, first_dest, init_value, binary_op, unary_op);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          class BinaryOpType, class UnaryOpType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto transform_exclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    ValueType init_value, BinaryOpType binary_op, UnaryOpType unary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_exclusive_scan_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), init_value, binary_op, unary_op);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -52,6 +52,7 @@
 #include "../Kokkos_ModifyingOperations.hpp"
 #include "../Kokkos_ValueWrapperForNoNeutralElement.hpp"
 #include "Kokkos_IdentityReferenceUnaryFunctor.hpp"
+#include "Kokkos_TeamScanWithJoin.hpp"
 
 namespace Kokkos {
 namespace Experimental {
@@ -200,6 +201,30 @@ struct TransformInclusiveScanWithInitValueFunctor {
   }
 };
 
+// team-level scans only support summation (the accumulator
+// is zero-initialized by the team parallel_scan), so the team
+// functor works with the plain value type instead of the wrapper
+template <class IndexType, class ValueType, class FirstFrom, class FirstDest>
+struct InclusiveScanDefaultTeamFunctor {
+  FirstFrom m_first_from;
+  FirstDest m_first_dest;
+
+  KOKKOS_FUNCTION
+  InclusiveScanDefaultTeamFunctor(FirstFrom first_from, FirstDest first_dest)
+      : m_first_from(std::move(first_from)),
+        m_first_dest(std::move(first_dest)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, ValueType& update,
+                  const bool final_pass) const {
+    update += m_first_from[i];
+
+    if (final_pass) {
+      m_first_dest[i] = update;
+    }
+  }
+};
+
 // -------------------------------------------------------------
 // inclusive_scan_default_op_impl
 // -------------------------------------------------------------
@@ -235,6 +260,37 @@ OutputIteratorType inclusive_scan_default_op_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_default_op_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using index_type = typename InputIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename InputIteratorType::value_type>;
+  using func_type =
+      InclusiveScanDefaultTeamFunctor<index_type, value_type,
+                                      InputIteratorType, OutputIteratorType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  ::Kokkos::parallel_scan(TeamThreadRange(teamHandle, 0, num_elements),
+                          func_type(first_from, first_dest));
+  teamHandle.team_barrier();
+
+  // return
+  return first_dest + num_elements;
+}
+
 // -------------------------------------------------------------
 // inclusive_scan_custom_binary_op_impl
 // -------------------------------------------------------------
@@ -271,6 +327,40 @@ OutputIteratorType inclusive_scan_custom_binary_op_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_custom_binary_op_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space  = typename TeamHandleType::execution_space;
+  using index_type = typename InputIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename InputIteratorType::value_type>;
+  using unary_op_type = StdNumericScanIdentityReferenceUnaryFunctor<value_type>;
+  using func_type     = TransformInclusiveScanNoInitValueFunctor<
+      exe_space, index_type, value_type, InputIteratorType,
+      OutputIteratorType, BinaryOpType, unary_op_type>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(
+      teamHandle, num_elements,
+      func_type(first_from, first_dest, binary_op, unary_op_type()));
+
+  // return
+  return first_dest + num_elements;
+}
+
 // -------------------------------------------------------------
 // inclusive_scan_custom_binary_op_impl with init_value
 // -------------------------------------------------------------
@@ -307,6 +397,38 @@ OutputIteratorType inclusive_scan_custom_binary_op_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType, class ValueType>
+KOKKOS_FUNCTION OutputIteratorType inclusive_scan_custom_binary_op_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    BinaryOpType binary_op, ValueType init_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space     = typename TeamHandleType::execution_space;
+  using index_type    = typename InputIteratorType::difference_type;
+  using unary_op_type = StdNumericScanIdentityReferenceUnaryFunctor<ValueType>;
+  using func_type     = TransformInclusiveScanWithInitValueFunctor<
+      exe_space, index_type, ValueType, InputIteratorType, OutputIteratorType,
+      BinaryOpType, unary_op_type>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(teamHandle, num_elements,
+                      func_type(first_from, first_dest, binary_op,
+                                unary_op_type(), init_value));
+
+  // return
+  return first_dest + num_elements;
+}
+
 // -------------------------------------------------------------
 // transform_inclusive_scan_impl without init_value
 // -------------------------------------------------------------
@@ -345,6 +467,38 @@ OutputIteratorType transform_inclusive_scan_impl(const std::string& label,
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType, class UnaryOpType>
+KOKKOS_FUNCTION OutputIteratorType transform_inclusive_scan_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    BinaryOpType binary_op, UnaryOpType unary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space  = typename TeamHandleType::execution_space;
+  using index_type = typename InputIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename InputIteratorType::value_type>;
+  using func_type = TransformInclusiveScanNoInitValueFunctor<
+      exe_space, index_type, value_type, InputIteratorType,
+      OutputIteratorType, BinaryOpType, UnaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(teamHandle, num_elements,
+                      func_type(first_from, first_dest, binary_op, unary_op));
+
+  // return
+  return first_dest + num_elements;
+}
+
 // -------------------------------------------------------------
 // transform_inclusive_scan_impl with init_value
 // -------------------------------------------------------------
@@ -380,6 +534,38 @@ OutputIteratorType transform_inclusive_scan_impl(
   return first_dest + num_elements;
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType, class UnaryOpType,
+          class ValueType>
+KOKKOS_FUNCTION OutputIteratorType transform_inclusive_scan_team_impl(
+    const TeamHandleType& teamHandle, InputIteratorType first_from,
+    InputIteratorType last_from, OutputIteratorType first_dest,
+    BinaryOpType binary_op, UnaryOpType unary_op, ValueType init_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first_from,
+                                                   first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(first_from,
+                                                              first_dest);
+  Impl::expect_valid_range(first_from, last_from);
+
+  // aliases
+  using exe_space  = typename TeamHandleType::execution_space;
+  using index_type = typename InputIteratorType::difference_type;
+  using func_type  = TransformInclusiveScanWithInitValueFunctor<
+      exe_space, index_type, ValueType, InputIteratorType, OutputIteratorType,
+      BinaryOpType, UnaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(first_from, last_from);
+  team_scan_with_join(
+      teamHandle, num_elements,
+      func_type(first_from, first_dest, binary_op, unary_op, init_value));
+
+  // return
+  return first_dest + num_elements;
+}
+
 }  // end namespace Impl
 
 ///////////////////////////////
@@ -390,7 +576,8 @@ OutputIteratorType transform_inclusive_scan_impl(
 
 // overload set 1
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType>
+          class OutputIteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -414,7 +601,8 @@ inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2>
+          class DataType2, class... Properties2,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto inclusive_scan(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -441,9 +629,41 @@ auto inclusive_scan(
                                               KE::begin(view_dest));
 }
 
+// overload set accepting a team handle
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan(const TeamHandleType& teamHandle, InputIteratorType first,
+               InputIteratorType last, OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_default_op_team_impl(teamHandle, first, last,
+                                                   first_dest);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto inclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_default_op_team_impl(teamHandle,
+                                                   KE::cbegin(view_from),
+                                                   KE::cend(view_from),
+                                                   KE::begin(view_dest));
+}
+
 // overload set 2 (accepting custom binary op)
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class BinaryOp>
+          class OutputIteratorType, class BinaryOp,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -468,7 +688,8 @@ inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class BinaryOp>
+          class DataType2, class... Properties2, class BinaryOp,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto inclusive_scan(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType1, Properties1...>& view_from,
                     const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -496,9 +717,41 @@ auto inclusive_scan(const std::string& label, const ExecutionSpace& ex,
       KE::begin(view_dest), binary_op);
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOp,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan(const TeamHandleType& teamHandle, InputIteratorType first,
+               InputIteratorType last, OutputIteratorType first_dest,
+               BinaryOp binary_op) {
+  return Impl::inclusive_scan_custom_binary_op_team_impl(teamHandle, first,
+                                                         last, first_dest,
+                                                         binary_op);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryOp,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto inclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    BinaryOp binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_custom_binary_op_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), binary_op);
+}
+
 // overload set 3
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class BinaryOp, class ValueType>
+          class OutputIteratorType, class BinaryOp, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -525,7 +778,7 @@ inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class BinaryOp,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto inclusive_scan(const ExecutionSpace& ex,
                     const ::Kokkos::View<DataType1, Properties1...>& view_from,
                     const ::Kokkos::View<DataType2, Properties2...>& view_dest,
@@ -554,6 +807,36 @@ auto inclusive_scan(const std::string& label, const ExecutionSpace& ex,
       KE::begin(view_dest), binary_op, init_value);
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOp, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan(const TeamHandleType& teamHandle, InputIteratorType first,
+               InputIteratorType last, OutputIteratorType first_dest,
+               BinaryOp binary_op, ValueType init_value) {
+  return Impl::inclusive_scan_custom_binary_op_team_impl(
+      teamHandle, first, last, first_dest, binary_op, init_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryOp,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto inclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    BinaryOp binary_op, ValueType init_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_custom_binary_op_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), binary_op, init_value);
+}
+
 //////////////////////////////////////
 //
 // transform_inclusive_scan public API
@@ -562,7 +845,8 @@ auto inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 // overload set 1 (no init value)
 template <class ExecutionSpace, class InputIteratorType,
-          class OutputIteratorType, class BinaryOpType, class UnaryOpType>
+          class OutputIteratorType, class BinaryOpType, class UnaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -593,7 +877,8 @@ transform_inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class BinaryOpType,
-          class UnaryOpType>
+          class UnaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto transform_inclusive_scan(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -626,10 +911,41 @@ auto transform_inclusive_scan(
       KE::begin(view_dest), binary_op, unary_op);
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType, class UnaryOpType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+transform_inclusive_scan(const TeamHandleType& teamHandle,
+                         InputIteratorType first, InputIteratorType last,
+                         OutputIteratorType first_dest, BinaryOpType binary_op,
+                         UnaryOpType unary_op) {
+  return Impl::transform_inclusive_scan_team_impl(
+      teamHandle, first, last, first_dest, binary_op, unary_op);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryOpType,
+          class UnaryOpType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto transform_inclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    BinaryOpType binary_op, UnaryOpType unary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_inclusive_scan_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), binary_op, unary_op);
+}
+
 // overload set 2 (init value)
 template <class ExecutionSpace, class InputIteratorType,
           class OutputIteratorType, class BinaryOpType, class UnaryOpType,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
                       InputIteratorType, OutputIteratorType>::value,
                   OutputIteratorType>
@@ -660,7 +976,8 @@ transform_inclusive_scan(const std::string& label, const ExecutionSpace& ex,
 
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class BinaryOpType,
-          class UnaryOpType, class ValueType>
+          class UnaryOpType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto transform_inclusive_scan(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& view_from,
@@ -693,6 +1010,38 @@ auto transform_inclusive_scan(
       KE::begin(view_dest), binary_op, unary_op, init_value);
 }
 
+template <class TeamHandleType, class InputIteratorType,
+          class OutputIteratorType, class BinaryOpType, class UnaryOpType,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      InputIteratorType, OutputIteratorType>::value,
+                  OutputIteratorType>
+transform_inclusive_scan(const TeamHandleType& teamHandle,
+                         InputIteratorType first, InputIteratorType last,
+                         OutputIteratorType first_dest, BinaryOpType binary_op,
+                         UnaryOpType unary_op, ValueType init_value) {
+  return Impl::transform_inclusive_scan_team_impl(
+      teamHandle, first, last, first_dest, binary_op, unary_op, init_value);
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class BinaryOpType,
+          class UnaryOpType, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto transform_inclusive_scan(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& view_from,
+    const ::Kokkos::View<DataType2, Properties2...>& view_dest,
+    BinaryOpType binary_op, UnaryOpType unary_op, ValueType init_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_from);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_inclusive_scan_team_impl(
+      teamHandle, KE::cbegin(view_from), KE::cend(view_from),
+      KE::begin(view_dest), binary_op, unary_op, init_value);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
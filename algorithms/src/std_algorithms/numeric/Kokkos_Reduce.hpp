@@ -148,6 +148,53 @@ ValueType reduce_default_functors_impl(const std::string& label,
       label, ex, first, last, std::move(init_reduction_value), joiner_type());
 }
 
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class JoinerType>
+KOKKOS_FUNCTION ValueType reduce_custom_functors_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValueType init_reduction_value, JoinerType joiner) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    // init is returned, unmodified
+    return init_reduction_value;
+  }
+
+  // aliases
+  using reducer_type =
+      ReducerWithArbitraryJoinerNoNeutralElement<ValueType, JoinerType>;
+  using functor_type         = StdReduceFunctor<IteratorType, reducer_type>;
+  using reduction_value_type = typename reducer_type::value_type;
+
+  // run
+  reduction_value_type result;
+  reducer_type reducer(result, joiner);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            functor_type(first, reducer), reducer);
+
+  // no barrier needed because every member gets the reduced value
+  return joiner(result.val, init_reduction_value);
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType>
+KOKKOS_FUNCTION ValueType reduce_default_functors_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValueType init_reduction_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+  Impl::expect_valid_range(first, last);
+
+  using value_type  = Kokkos::Impl::remove_cvref_t<ValueType>;
+  using joiner_type = Impl::StdReduceDefaultJoinFunctor<value_type>;
+  return reduce_custom_functors_team_impl(
+      teamHandle, first, last, std::move(init_reduction_value), joiner_type());
+}
+
 }  // end namespace Impl
 
 ///////////////////////////////
@@ -159,7 +206,8 @@ ValueType reduce_default_functors_impl(const std::string& label,
 //
 // overload set 1
 //
-template <class ExecutionSpace, class IteratorType>
+template <class ExecutionSpace, class IteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 typename IteratorType::value_type reduce(const ExecutionSpace& ex,
                                          IteratorType first,
                                          IteratorType last) {
@@ -177,7 +225,8 @@ typename IteratorType::value_type reduce(const std::string& label,
       label, ex, first, last, typename IteratorType::value_type());
 }
 
-template <class ExecutionSpace, class DataType, class... Properties>
+template <class ExecutionSpace, class DataType, class... Properties,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 auto reduce(const ExecutionSpace& ex,
             const ::Kokkos::View<DataType, Properties...>& view) {
   namespace KE = ::Kokkos::Experimental;
@@ -207,7 +256,8 @@ auto reduce(const std::string& label, const ExecutionSpace& ex,
 //
 // overload set2:
 //
-template <class ExecutionSpace, class IteratorType, class ValueType>
+template <class ExecutionSpace, class IteratorType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType reduce(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last, ValueType init_reduction_value) {
   static_assert(std::is_move_constructible<ValueType>::value,
@@ -230,7 +280,7 @@ ValueType reduce(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType reduce(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& view,
                  ValueType init_reduction_value) {
@@ -264,7 +314,7 @@ ValueType reduce(const std::string& label, const ExecutionSpace& ex,
 // overload set 3
 //
 template <class ExecutionSpace, class IteratorType, class ValueType,
-          class BinaryOp>
+          class BinaryOp, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType reduce(const ExecutionSpace& ex, IteratorType first,
                  IteratorType last, ValueType init_reduction_value,
                  BinaryOp joiner) {
@@ -289,7 +339,8 @@ ValueType reduce(const std::string& label, const ExecutionSpace& ex,
 }
 
 template <class ExecutionSpace, class DataType, class... Properties,
-          class ValueType, class BinaryOp>
+          class ValueType, class BinaryOp,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType reduce(const ExecutionSpace& ex,
                  const ::Kokkos::View<DataType, Properties...>& view,
                  ValueType init_reduction_value, BinaryOp joiner) {
@@ -320,6 +371,91 @@ ValueType reduce(const std::string& label, const ExecutionSpace& ex,
                                            joiner);
 }
 
+//
+// overload set accepting a team handle
+//
+template <class TeamHandleType, class IteratorType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION typename IteratorType::value_type
+reduce(const TeamHandleType& teamHandle, IteratorType first,
+       IteratorType last) {
+  return Impl::reduce_default_functors_team_impl(
+      teamHandle, first, last, typename IteratorType::value_type());
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION auto reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  using view_type  = ::Kokkos::View<DataType, Properties...>;
+  using value_type = typename view_type::value_type;
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_default_functors_team_impl(teamHandle, KE::cbegin(view),
+                                                 KE::cend(view), value_type());
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType reduce(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last,
+                                 ValueType init_reduction_value) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+
+  return Impl::reduce_default_functors_team_impl(teamHandle, first, last,
+                                                 init_reduction_value);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    ValueType init_reduction_value) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_default_functors_team_impl(teamHandle, KE::cbegin(view),
+                                                 KE::cend(view),
+                                                 init_reduction_value);
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class BinaryOp, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType reduce(const TeamHandleType& teamHandle,
+                                 IteratorType first, IteratorType last,
+                                 ValueType init_reduction_value,
+                                 BinaryOp joiner) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+
+  return Impl::reduce_custom_functors_team_impl(teamHandle, first, last,
+                                                init_reduction_value, joiner);
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class ValueType, class BinaryOp,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    ValueType init_reduction_value, BinaryOp joiner) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_custom_functors_team_impl(teamHandle, KE::cbegin(view),
+                                                KE::cend(view),
+                                                init_reduction_value, joiner);
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
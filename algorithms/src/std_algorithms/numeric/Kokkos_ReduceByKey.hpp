@@ -0,0 +1,485 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_NUMERICS_REDUCE_BY_KEY_HPP
+#define KOKKOS_STD_NUMERICS_REDUCE_BY_KEY_HPP
+
+#include <Kokkos_Core.hpp>
+#include "../Kokkos_BeginEnd.hpp"
+#include "../Kokkos_Constraints.hpp"
+#include "../Kokkos_Distance.hpp"
+#include "../Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Reduce.hpp"
+#include "Kokkos_ScanByKey.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class KeysOutputIteratorType, class ValuesOutputIteratorType,
+          class KeyEqualType, class BinaryOpType>
+struct ReduceByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = ValueWrapperForSegmentedScan<ValueType, IndexType>;
+
+  IndexType m_num_elements;
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  KeysOutputIteratorType m_keys_dest;
+  ValuesOutputIteratorType m_values_dest;
+  KeyEqualType m_key_equal;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  ReduceByKeyFunctor(IndexType num_elements, KeysIteratorType keys_first,
+                     ValuesIteratorType values_first,
+                     KeysOutputIteratorType keys_dest,
+                     ValuesOutputIteratorType values_dest,
+                     KeyEqualType key_equal, BinaryOpType binary_op)
+      : m_num_elements(num_elements),
+        m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_keys_dest(std::move(keys_dest)),
+        m_values_dest(std::move(values_dest)),
+        m_key_equal(std::move(key_equal)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    const bool is_start = starts_segment(m_keys_first, i, m_key_equal);
+    value_type tmp;
+    tmp.val                = m_values_first[i];
+    tmp.num_segment_starts = is_start ? 1 : 0;
+    tmp.is_initial         = false;
+    this->join(update, tmp);
+
+    // the output position of a segment is the number of segments started
+    // up to it: the first element writes the key, as keys that compare
+    // equal may differ, and the last one writes the reduced value
+    if (final_pass) {
+      const IndexType k = update.num_segment_starts - 1;
+      if (is_start) {
+        m_keys_dest[k] = m_keys_first[i];
+      }
+      if (i == m_num_elements - 1 ||
+          !m_key_equal(m_keys_first[i], m_keys_first[i + 1])) {
+        m_values_dest[k] = update.val;
+      }
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const {
+    update.val                = {};
+    update.num_segment_starts = 0;
+    update.is_initial         = true;
+  }
+
+  KOKKOS_FUNCTION
+  void join(volatile value_type& update,
+            volatile const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+// -------------------------------------------------------------
+// reduce_by_key_impl
+// -------------------------------------------------------------
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType,
+          class BinaryOpType>
+::Kokkos::pair<KeysOutputIteratorType, ValuesOutputIteratorType>
+reduce_by_key_impl(const std::string& label, const ExecutionSpace& ex,
+                   KeysIteratorType keys_first, KeysIteratorType keys_last,
+                   ValuesIteratorType values_first,
+                   KeysOutputIteratorType keys_dest,
+                   ValuesOutputIteratorType values_dest,
+                   KeyEqualType key_equal, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(
+      ex, keys_first, values_first, keys_dest, values_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, keys_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(keys_first,
+                                                              values_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using func_type =
+      ReduceByKeyFunctor<ExecutionSpace, index_type, value_type,
+                         KeysIteratorType, ValuesIteratorType,
+                         KeysOutputIteratorType, ValuesOutputIteratorType,
+                         KeyEqualType, BinaryOpType>;
+
+  // run: a single scan both reduces the segments and compacts them
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  typename func_type::value_type total;
+  ::Kokkos::parallel_scan(
+      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+      func_type(num_elements, keys_first, values_first, keys_dest,
+                values_dest, key_equal, binary_op),
+      total);
+
+  // return
+  return {keys_dest + total.num_segment_starts,
+          values_dest + total.num_segment_starts};
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType>
+::Kokkos::pair<KeysOutputIteratorType, ValuesOutputIteratorType>
+reduce_by_key_impl(const std::string& label, const ExecutionSpace& ex,
+                   KeysIteratorType keys_first, KeysIteratorType keys_last,
+                   ValuesIteratorType values_first,
+                   KeysOutputIteratorType keys_dest,
+                   ValuesOutputIteratorType values_dest,
+                   KeyEqualType key_equal) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using binary_op_type = StdReduceDefaultJoinFunctor<value_type>;
+  return reduce_by_key_impl(label, ex, keys_first, keys_last, values_first,
+                            keys_dest, values_dest, key_equal,
+                            binary_op_type());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType>
+::Kokkos::pair<KeysOutputIteratorType, ValuesOutputIteratorType>
+reduce_by_key_impl(const std::string& label, const ExecutionSpace& ex,
+                   KeysIteratorType keys_first, KeysIteratorType keys_last,
+                   ValuesIteratorType values_first,
+                   KeysOutputIteratorType keys_dest,
+                   ValuesOutputIteratorType values_dest) {
+  using key_type       = typename KeysIteratorType::value_type;
+  using key_equal_type = StdAlgoEqualBinaryPredicate<key_type>;
+  return reduce_by_key_impl(label, ex, keys_first, keys_last, values_first,
+                            keys_dest, values_dest, key_equal_type());
+}
+
+}  // end namespace Impl
+
+///////////////////////////////
+//
+// reduce by key API
+//
+///////////////////////////////
+
+//
+// reduces each run of consecutive equal keys and writes the first key and
+// the reduced values of the runs to keys_dest and values_dest,
+// returns the pair of iterators past the last written element
+//
+
+// overload set 1
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+              KeysIteratorType keys_last, ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest) {
+  return Impl::reduce_by_key_impl("Kokkos::reduce_by_key_iterator_api_default",
+                                  ex, keys_first, keys_last, values_first,
+                                  keys_dest, values_dest);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const std::string& label, const ExecutionSpace& ex,
+              KeysIteratorType keys_first, KeysIteratorType keys_last,
+              ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest) {
+  return Impl::reduce_by_key_impl(label, ex, keys_first, keys_last,
+                                  values_first, keys_dest, values_dest);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto reduce_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      "Kokkos::reduce_by_key_view_api_default", ex, KE::cbegin(view_keys),
+      KE::cend(view_keys), KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4>
+auto reduce_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest));
+}
+
+// overload set 2 (accepting custom key equality predicate)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+              KeysIteratorType keys_last, ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest, KeyEqualType key_equal) {
+  return Impl::reduce_by_key_impl("Kokkos::reduce_by_key_iterator_api_default",
+                                  ex, keys_first, keys_last, values_first,
+                                  keys_dest, values_dest, key_equal);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const std::string& label, const ExecutionSpace& ex,
+              KeysIteratorType keys_first, KeysIteratorType keys_last,
+              ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest, KeyEqualType key_equal) {
+  return Impl::reduce_by_key_impl(label, ex, keys_first, keys_last,
+                                  values_first, keys_dest, values_dest,
+                                  key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4,
+          class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto reduce_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest,
+    KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      "Kokkos::reduce_by_key_view_api_default", ex, KE::cbegin(view_keys),
+      KE::cend(view_keys), KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest), key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4,
+          class KeyEqualType>
+auto reduce_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest,
+    KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest), key_equal);
+}
+
+// overload set 3 (accepting custom key equality predicate and binary op)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType,
+          class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+              KeysIteratorType keys_last, ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest, KeyEqualType key_equal,
+              BinaryOpType binary_op) {
+  return Impl::reduce_by_key_impl("Kokkos::reduce_by_key_iterator_api_custom",
+                                  ex, keys_first, keys_last, values_first,
+                                  keys_dest, values_dest, key_equal,
+                                  binary_op);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class KeysOutputIteratorType,
+          class ValuesOutputIteratorType, class KeyEqualType,
+          class BinaryOpType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      KeysOutputIteratorType,
+                      ValuesOutputIteratorType>::value,
+                  ::Kokkos::pair<KeysOutputIteratorType,
+                                 ValuesOutputIteratorType> >
+reduce_by_key(const std::string& label, const ExecutionSpace& ex,
+              KeysIteratorType keys_first, KeysIteratorType keys_last,
+              ValuesIteratorType values_first,
+              KeysOutputIteratorType keys_dest,
+              ValuesOutputIteratorType values_dest, KeyEqualType key_equal,
+              BinaryOpType binary_op) {
+  return Impl::reduce_by_key_impl(label, ex, keys_first, keys_last,
+                                  values_first, keys_dest, values_dest,
+                                  key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4,
+          class KeyEqualType, class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto reduce_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest,
+    KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      "Kokkos::reduce_by_key_view_api_custom", ex, KE::cbegin(view_keys),
+      KE::cend(view_keys), KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest), key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class DataType4, class... Properties4,
+          class KeyEqualType, class BinaryOpType>
+auto reduce_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_keys_dest,
+    const ::Kokkos::View<DataType4, Properties4...>& view_values_dest,
+    KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys_dest);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(
+      view_values_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::reduce_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_keys_dest),
+      KE::begin(view_values_dest), key_equal, binary_op);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,815 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_NUMERICS_SCAN_BY_KEY_HPP
+#define KOKKOS_STD_NUMERICS_SCAN_BY_KEY_HPP
+
+#include <Kokkos_Core.hpp>
+#include "../Kokkos_BeginEnd.hpp"
+#include "../Kokkos_Constraints.hpp"
+#include "../Kokkos_Distance.hpp"
+#include "../Kokkos_HelperPredicates.hpp"
+#include "Kokkos_Reduce.hpp"
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+//
+// scalar used by the scans over segments of equal keys: val is the
+// result of the elements since the last segment start, which makes the
+// segmented operation associative, and num_segment_starts counts the
+// segments starting in the partial range
+//
+template <class ValueType, class IndexType>
+struct ValueWrapperForSegmentedScan {
+  ValueType val;
+  IndexType num_segment_starts = 0;
+  bool is_initial              = true;
+
+  KOKKOS_FUNCTION
+  void operator=(const ValueWrapperForSegmentedScan& rhs) {
+    val                = rhs.val;
+    num_segment_starts = rhs.num_segment_starts;
+    is_initial         = rhs.is_initial;
+  }
+
+  KOKKOS_FUNCTION
+  void operator=(const volatile ValueWrapperForSegmentedScan& rhs) volatile {
+    val                = rhs.val;
+    num_segment_starts = rhs.num_segment_starts;
+    is_initial         = rhs.is_initial;
+  }
+};
+
+template <class ValueWrapperType, class BinaryOpType>
+KOKKOS_FUNCTION void segmented_scan_join(volatile ValueWrapperType& update,
+                                         volatile const ValueWrapperType& input,
+                                         const BinaryOpType& binary_op) {
+  if (input.is_initial) {
+    return;
+  }
+
+  if (update.is_initial) {
+    update = input;
+  } else {
+    // a segment starting in the input discards what comes before
+    if (input.num_segment_starts > 0) {
+      update.val = input.val;
+    } else {
+      update.val = binary_op(update.val, input.val);
+    }
+    update.num_segment_starts += input.num_segment_starts;
+  }
+}
+
+template <class IndexType, class KeysIteratorType, class KeyEqualType>
+KOKKOS_FUNCTION bool starts_segment(const KeysIteratorType& keys_first,
+                                    const IndexType i,
+                                    const KeyEqualType& key_equal) {
+  return (i == 0) || !key_equal(keys_first[i - 1], keys_first[i]);
+}
+
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class OutputIteratorType, class KeyEqualType, class BinaryOpType>
+struct InclusiveScanByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = ValueWrapperForSegmentedScan<ValueType, IndexType>;
+
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  OutputIteratorType m_first_dest;
+  KeyEqualType m_key_equal;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  InclusiveScanByKeyFunctor(KeysIteratorType keys_first,
+                            ValuesIteratorType values_first,
+                            OutputIteratorType first_dest,
+                            KeyEqualType key_equal, BinaryOpType binary_op)
+      : m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_first_dest(std::move(first_dest)),
+        m_key_equal(std::move(key_equal)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    const bool is_start = starts_segment(m_keys_first, i, m_key_equal);
+    value_type tmp;
+    tmp.val                = m_values_first[i];
+    tmp.num_segment_starts = is_start ? 1 : 0;
+    tmp.is_initial         = false;
+    this->join(update, tmp);
+
+    if (final_pass) {
+      m_first_dest[i] = update.val;
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const {
+    update.val                = {};
+    update.num_segment_starts = 0;
+    update.is_initial         = true;
+  }
+
+  KOKKOS_FUNCTION
+  void join(volatile value_type& update,
+            volatile const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+template <class ExeSpace, class IndexType, class ValueType,
+          class KeysIteratorType, class ValuesIteratorType,
+          class OutputIteratorType, class KeyEqualType, class BinaryOpType>
+struct ExclusiveScanByKeyFunctor {
+  using execution_space = ExeSpace;
+  using value_type      = ValueWrapperForSegmentedScan<ValueType, IndexType>;
+
+  ValueType m_init_value;
+  KeysIteratorType m_keys_first;
+  ValuesIteratorType m_values_first;
+  OutputIteratorType m_first_dest;
+  KeyEqualType m_key_equal;
+  BinaryOpType m_binary_op;
+
+  KOKKOS_FUNCTION
+  ExclusiveScanByKeyFunctor(ValueType init, KeysIteratorType keys_first,
+                            ValuesIteratorType values_first,
+                            OutputIteratorType first_dest,
+                            KeyEqualType key_equal, BinaryOpType binary_op)
+      : m_init_value(std::move(init)),
+        m_keys_first(std::move(keys_first)),
+        m_values_first(std::move(values_first)),
+        m_first_dest(std::move(first_dest)),
+        m_key_equal(std::move(key_equal)),
+        m_binary_op(std::move(binary_op)) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const IndexType i, value_type& update,
+                  const bool final_pass) const {
+    // read before writing, the destination can be the values
+    const bool is_start = starts_segment(m_keys_first, i, m_key_equal);
+    value_type tmp;
+    tmp.val                = m_values_first[i];
+    tmp.num_segment_starts = is_start ? 1 : 0;
+    tmp.is_initial         = false;
+
+    if (final_pass) {
+      // when i does not start a segment, update holds the
+      // elements of its segment preceding it
+      if (is_start) {
+        m_first_dest[i] = m_init_value;
+      } else {
+        m_first_dest[i] = m_binary_op(m_init_value, update.val);
+      }
+    }
+
+    this->join(update, tmp);
+  }
+
+  KOKKOS_FUNCTION
+  void init(value_type& update) const {
+    update.val                = {};
+    update.num_segment_starts = 0;
+    update.is_initial         = true;
+  }
+
+  KOKKOS_FUNCTION
+  void join(volatile value_type& update,
+            volatile const value_type& input) const {
+    segmented_scan_join(update, input, m_binary_op);
+  }
+};
+
+// -------------------------------------------------------------
+// inclusive_scan_by_key_impl
+// -------------------------------------------------------------
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType, class BinaryOpType>
+OutputIteratorType inclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    KeyEqualType key_equal, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using func_type =
+      InclusiveScanByKeyFunctor<ExecutionSpace, index_type, value_type,
+                                KeysIteratorType, ValuesIteratorType,
+                                OutputIteratorType, KeyEqualType, BinaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  ::Kokkos::parallel_scan(label,
+                          RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                          func_type(keys_first, values_first, first_dest,
+                                    key_equal, binary_op));
+  ex.fence("Kokkos::inclusive_scan_by_key: fence after operation");
+
+  // return
+  return first_dest + num_elements;
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType>
+OutputIteratorType inclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    KeyEqualType key_equal) {
+  using value_type =
+      std::remove_const_t<typename ValuesIteratorType::value_type>;
+  using binary_op_type = StdReduceDefaultJoinFunctor<value_type>;
+  return inclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                    values_first, first_dest, key_equal,
+                                    binary_op_type());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType>
+OutputIteratorType inclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest) {
+  using key_type       = typename KeysIteratorType::value_type;
+  using key_equal_type = StdAlgoEqualBinaryPredicate<key_type>;
+  return inclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                    values_first, first_dest,
+                                    key_equal_type());
+}
+
+// -------------------------------------------------------------
+// exclusive_scan_by_key_impl
+// -------------------------------------------------------------
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType, class BinaryOpType>
+OutputIteratorType exclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value, KeyEqualType key_equal, BinaryOpType binary_op) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(ex, keys_first,
+                                                   values_first, first_dest);
+  Impl::static_assert_iterators_have_matching_difference_type(
+      keys_first, values_first, first_dest);
+  Impl::expect_valid_range(keys_first, keys_last);
+
+  // aliases
+  using index_type = typename KeysIteratorType::difference_type;
+  using func_type =
+      ExclusiveScanByKeyFunctor<ExecutionSpace, index_type, ValueType,
+                                KeysIteratorType, ValuesIteratorType,
+                                OutputIteratorType, KeyEqualType, BinaryOpType>;
+
+  // run
+  const auto num_elements =
+      Kokkos::Experimental::distance(keys_first, keys_last);
+  ::Kokkos::parallel_scan(label,
+                          RangePolicy<ExecutionSpace>(ex, 0, num_elements),
+                          func_type(init_value, keys_first, values_first,
+                                    first_dest, key_equal, binary_op));
+  ex.fence("Kokkos::exclusive_scan_by_key: fence after operation");
+
+  // return
+  return first_dest + num_elements;
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType>
+OutputIteratorType exclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value, KeyEqualType key_equal) {
+  using binary_op_type = StdReduceDefaultJoinFunctor<ValueType>;
+  return exclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                    values_first, first_dest, init_value,
+                                    key_equal, binary_op_type());
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType>
+OutputIteratorType exclusive_scan_by_key_impl(
+    const std::string& label, const ExecutionSpace& ex,
+    KeysIteratorType keys_first, KeysIteratorType keys_last,
+    ValuesIteratorType values_first, OutputIteratorType first_dest,
+    ValueType init_value) {
+  using key_type       = typename KeysIteratorType::value_type;
+  using key_equal_type = StdAlgoEqualBinaryPredicate<key_type>;
+  return exclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                    values_first, first_dest, init_value,
+                                    key_equal_type());
+}
+
+}  // end namespace Impl
+
+///////////////////////////////
+//
+// inclusive scan by key API
+//
+///////////////////////////////
+
+// overload set 1
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest) {
+  return Impl::inclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_default", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest));
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest));
+}
+
+// overload set 2 (accepting custom key equality predicate)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, KeyEqualType key_equal) {
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest, key_equal);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, KeyEqualType key_equal) {
+  return Impl::inclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest, key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_default", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest), key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class KeyEqualType>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest), key_equal);
+}
+
+// overload set 3 (accepting custom key equality predicate and binary op)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType, class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, KeyEqualType key_equal,
+                      BinaryOpType binary_op) {
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_iterator_api_custom", ex, keys_first,
+      keys_last, values_first, first_dest, key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType,
+          class KeyEqualType, class BinaryOpType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+inclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, KeyEqualType key_equal,
+                      BinaryOpType binary_op) {
+  return Impl::inclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest, key_equal,
+                                          binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class KeyEqualType, class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto inclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      "Kokkos::inclusive_scan_by_key_view_api_custom", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest), key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class KeyEqualType, class BinaryOpType>
+auto inclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::inclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest), key_equal, binary_op);
+}
+
+///////////////////////////////
+//
+// exclusive scan by key API
+//
+///////////////////////////////
+
+// overload set 1
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value) {
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest, init_value);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value) {
+  return Impl::exclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest,
+                                          init_value);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto exclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_view_api_default", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest), init_value);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType>
+auto exclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest), init_value);
+}
+
+// overload set 2 (accepting custom key equality predicate)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value,
+                      KeyEqualType key_equal) {
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_iterator_api_default", ex, keys_first,
+      keys_last, values_first, first_dest, init_value, key_equal);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value,
+                      KeyEqualType key_equal) {
+  return Impl::exclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest,
+                                          init_value, key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType, class KeyEqualType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto exclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value, KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_view_api_default", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest), init_value, key_equal);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType, class KeyEqualType>
+auto exclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value, KeyEqualType key_equal) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest), init_value, key_equal);
+}
+
+// overload set 3 (accepting custom key equality predicate and binary op)
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType, class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const ExecutionSpace& ex, KeysIteratorType keys_first,
+                      KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value,
+                      KeyEqualType key_equal, BinaryOpType binary_op) {
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_iterator_api_custom", ex, keys_first,
+      keys_last, values_first, first_dest, init_value, key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class KeysIteratorType,
+          class ValuesIteratorType, class OutputIteratorType, class ValueType,
+          class KeyEqualType, class BinaryOpType>
+std::enable_if_t< ::Kokkos::Experimental::Impl::are_iterators<
+                      KeysIteratorType, ValuesIteratorType,
+                      OutputIteratorType>::value,
+                  OutputIteratorType>
+exclusive_scan_by_key(const std::string& label, const ExecutionSpace& ex,
+                      KeysIteratorType keys_first, KeysIteratorType keys_last,
+                      ValuesIteratorType values_first,
+                      OutputIteratorType first_dest, ValueType init_value,
+                      KeyEqualType key_equal, BinaryOpType binary_op) {
+  return Impl::exclusive_scan_by_key_impl(label, ex, keys_first, keys_last,
+                                          values_first, first_dest,
+                                          init_value, key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType, class KeyEqualType,
+          class BinaryOpType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
+auto exclusive_scan_by_key(
+    const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value, KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      "Kokkos::exclusive_scan_by_key_view_api_custom", ex,
+      KE::cbegin(view_keys), KE::cend(view_keys), KE::cbegin(view_values),
+      KE::begin(view_dest), init_value, key_equal, binary_op);
+}
+
+template <class ExecutionSpace, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class DataType3,
+          class... Properties3, class ValueType, class KeyEqualType,
+          class BinaryOpType>
+auto exclusive_scan_by_key(
+    const std::string& label, const ExecutionSpace& ex,
+    const ::Kokkos::View<DataType1, Properties1...>& view_keys,
+    const ::Kokkos::View<DataType2, Properties2...>& view_values,
+    const ::Kokkos::View<DataType3, Properties3...>& view_dest,
+    ValueType init_value, KeyEqualType key_equal, BinaryOpType binary_op) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_keys);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_values);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view_dest);
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::exclusive_scan_by_key_impl(
+      label, ex, KE::cbegin(view_keys), KE::cend(view_keys),
+      KE::cbegin(view_values), KE::begin(view_dest), init_value, key_equal,
+      binary_op);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
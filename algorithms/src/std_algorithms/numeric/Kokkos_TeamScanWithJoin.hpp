@@ -0,0 +1,104 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_STD_NUMERIC_TEAM_SCAN_WITH_JOIN_HPP
+#define KOKKOS_STD_NUMERIC_TEAM_SCAN_WITH_JOIN_HPP
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// Runs a scan functor providing init and join, as used with
+// parallel_scan over a RangePolicy, on [0, num_elements) within a team.
+// The nested parallel_scan can only sum, so every thread scans a block of
+// consecutive elements, the results of the blocks are broadcast one after
+// the other so that every thread joins those preceding its block, and then
+// every thread scans its block again starting from there.
+template <class TeamHandleType, class IndexType, class FunctorType>
+KOKKOS_FUNCTION void team_scan_with_join(const TeamHandleType& teamHandle,
+                                         const IndexType num_elements,
+                                         const FunctorType& functor) {
+  using value_type = typename FunctorType::value_type;
+
+  const IndexType team_size  = teamHandle.team_size();
+  const IndexType team_rank  = teamHandle.team_rank();
+  const IndexType block_size = (num_elements + team_size - 1) / team_size;
+  const IndexType block_begin =
+      (team_rank * block_size < num_elements) ? team_rank * block_size
+                                              : num_elements;
+  const IndexType block_end = (num_elements - block_begin < block_size)
+                                  ? num_elements
+                                  : block_begin + block_size;
+
+  value_type block_result;
+  functor.init(block_result);
+  for (IndexType i = block_begin; i < block_end; ++i) {
+    functor(i, block_result, false);
+  }
+
+  // the blocks are empty past the end of the range, and nobody needs
+  // the result of the last block that is not
+  value_type update;
+  functor.init(update);
+  for (IndexType rank = 0; (rank + 1) * block_size < num_elements; ++rank) {
+    value_type rank_result = block_result;
+    teamHandle.team_broadcast(rank_result, static_cast<int>(rank));
+    if (rank < team_rank) {
+      functor.join(update, rank_result);
+    }
+  }
+
+  for (IndexType i = block_begin; i < block_end; ++i) {
+    functor(i, update, true);
+  }
+  teamHandle.team_barrier();
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -248,6 +248,103 @@ ValueType transform_reduce_default_functors_impl(
       joiner_type(), transformer_type());
 }
 
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class JoinerType, class UnaryTransformerType>
+KOKKOS_FUNCTION ValueType transform_reduce_custom_functors_team_impl(
+    const TeamHandleType& teamHandle, IteratorType first, IteratorType last,
+    ValueType init_reduction_value, JoinerType joiner,
+    UnaryTransformerType transformer) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+  Impl::expect_valid_range(first, last);
+
+  if (first == last) {
+    // init is returned, unmodified
+    return init_reduction_value;
+  }
+
+  // aliases
+  using reducer_type =
+      ReducerWithArbitraryJoinerNoNeutralElement<ValueType, JoinerType>;
+  using functor_type =
+      StdTransformReduceSingleIntervalFunctor<IteratorType, reducer_type,
+                                              UnaryTransformerType>;
+  using reduction_value_type = typename reducer_type::value_type;
+
+  // run
+  reduction_value_type result;
+  reducer_type reducer(result, joiner);
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  ::Kokkos::parallel_reduce(TeamThreadRange(teamHandle, 0, num_elements),
+                            functor_type(first, reducer, transformer), reducer);
+
+  // no barrier needed because every member gets the reduced value
+
+  // as per standard, transform is not applied to the init value
+  return joiner(result.val, init_reduction_value);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ValueType, class JoinerType, class BinaryTransformerType>
+KOKKOS_FUNCTION ValueType transform_reduce_custom_functors_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, ValueType init_reduction_value,
+    JoinerType joiner, BinaryTransformerType transformer) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+
+  if (first1 == last1) {
+    // init is returned, unmodified
+    return init_reduction_value;
+  }
+
+  // aliases
+  using index_type = typename IteratorType1::difference_type;
+  using reducer_type =
+      ReducerWithArbitraryJoinerNoNeutralElement<ValueType, JoinerType>;
+  using functor_type =
+      StdTransformReduceTwoIntervalsFunctor<index_type, IteratorType1,
+                                            IteratorType2, reducer_type,
+                                            BinaryTransformerType>;
+  using reduction_value_type = typename reducer_type::value_type;
+
+  // run
+  reduction_value_type result;
+  reducer_type reducer(result, joiner);
+  const auto num_elements = Kokkos::Experimental::distance(first1, last1);
+  ::Kokkos::parallel_reduce(
+      TeamThreadRange(teamHandle, 0, num_elements),
+      functor_type(first1, first2, reducer, transformer), reducer);
+
+  // no barrier needed because every member gets the reduced value
+  return joiner(result.val, init_reduction_value);
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ValueType>
+KOKKOS_FUNCTION ValueType transform_reduce_default_functors_team_impl(
+    const TeamHandleType& teamHandle, IteratorType1 first1,
+    IteratorType1 last1, IteratorType2 first2, ValueType init_reduction_value) {
+  // checks
+  Impl::static_assert_random_access_and_accessible(teamHandle, first1, first2);
+  Impl::static_assert_is_not_openmptarget(teamHandle);
+  Impl::static_assert_iterators_have_matching_difference_type(first1, first2);
+  Impl::expect_valid_range(first1, last1);
+
+  // aliases
+  using transformer_type =
+      Impl::StdTranformReduceDefaultBinaryTransformFunctor<ValueType>;
+  using joiner_type = Impl::StdTranformReduceDefaultJoinFunctor<ValueType>;
+
+  return transform_reduce_custom_functors_team_impl(
+      teamHandle, first1, last1, first2, std::move(init_reduction_value),
+      joiner_type(), transformer_type());
+}
+
 }  // end namespace Impl
 
 ///////////////////////////////
@@ -262,7 +359,7 @@ ValueType transform_reduce_default_functors_impl(
 // transform_reduce(first1, last1, first2, init, plus<>(), multiplies<>());
 // ----------------------------
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class ValueType>
+          class ValueType, Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType transform_reduce(const ExecutionSpace& ex, IteratorType1 first1,
                            IteratorType1 last1, IteratorType2 first2,
                            ValueType init_reduction_value) {
@@ -283,7 +380,8 @@ ValueType transform_reduce(const std::string& label, const ExecutionSpace& ex,
 
 // overload1 accepting views
 template <class ExecutionSpace, class DataType1, class... Properties1,
-          class DataType2, class... Properties2, class ValueType>
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType transform_reduce(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& first_view,
@@ -329,7 +427,8 @@ ValueType transform_reduce(
 
 // api accepting iterators
 template <class ExecutionSpace, class IteratorType1, class IteratorType2,
-          class ValueType, class BinaryJoinerType, class BinaryTransform>
+          class ValueType, class BinaryJoinerType, class BinaryTransform,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType transform_reduce(const ExecutionSpace& ex, IteratorType1 first1,
                            IteratorType1 last1, IteratorType2 first2,
                            ValueType init_reduction_value,
@@ -362,7 +461,8 @@ ValueType transform_reduce(const std::string& label, const ExecutionSpace& ex,
 // accepting views
 template <class ExecutionSpace, class DataType1, class... Properties1,
           class DataType2, class... Properties2, class ValueType,
-          class BinaryJoinerType, class BinaryTransform>
+          class BinaryJoinerType, class BinaryTransform,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType transform_reduce(
     const ExecutionSpace& ex,
     const ::Kokkos::View<DataType1, Properties1...>& first_view,
@@ -410,7 +510,8 @@ ValueType transform_reduce(
 //
 // accepting iterators
 template <class ExecutionSpace, class IteratorType, class ValueType,
-          class BinaryJoinerType, class UnaryTransform>
+          class BinaryJoinerType, class UnaryTransform,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 // need this to avoid ambiguous call
 std::enable_if_t<
     ::Kokkos::Experimental::Impl::are_iterators<IteratorType>::value, ValueType>
@@ -445,7 +546,8 @@ transform_reduce(const std::string& label, const ExecutionSpace& ex,
 
 // accepting views
 template <class ExecutionSpace, class DataType, class... Properties,
-          class ValueType, class BinaryJoinerType, class UnaryTransform>
+          class ValueType, class BinaryJoinerType, class UnaryTransform,
+          Impl::enable_if_execution_space<ExecutionSpace> = 0>
 ValueType transform_reduce(const ExecutionSpace& ex,
                            const ::Kokkos::View<DataType, Properties...>& view,
                            ValueType init_reduction_value,
@@ -482,6 +584,113 @@ ValueType transform_reduce(const std::string& label, const ExecutionSpace& ex,
       std::move(transformer));
 }
 
+//
+// overload set accepting a team handle
+//
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ValueType, Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType transform_reduce(const TeamHandleType& teamHandle,
+                                           IteratorType1 first1,
+                                           IteratorType1 last1,
+                                           IteratorType2 first2,
+                                           ValueType init_reduction_value) {
+  return Impl::transform_reduce_default_functors_team_impl(
+      teamHandle, first1, last1, first2, std::move(init_reduction_value));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType transform_reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& first_view,
+    const ::Kokkos::View<DataType2, Properties2...>& second_view,
+    ValueType init_reduction_value) {
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(first_view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(second_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_reduce_default_functors_team_impl(
+      teamHandle, KE::cbegin(first_view), KE::cend(first_view),
+      KE::cbegin(second_view), std::move(init_reduction_value));
+}
+
+template <class TeamHandleType, class IteratorType1, class IteratorType2,
+          class ValueType, class BinaryJoinerType, class BinaryTransform,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType transform_reduce(const TeamHandleType& teamHandle,
+                                           IteratorType1 first1,
+                                           IteratorType1 last1,
+                                           IteratorType2 first2,
+                                           ValueType init_reduction_value,
+                                           BinaryJoinerType joiner,
+                                           BinaryTransform transformer) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+
+  return Impl::transform_reduce_custom_functors_team_impl(
+      teamHandle, first1, last1, first2, std::move(init_reduction_value),
+      std::move(joiner), std::move(transformer));
+}
+
+template <class TeamHandleType, class DataType1, class... Properties1,
+          class DataType2, class... Properties2, class ValueType,
+          class BinaryJoinerType, class BinaryTransform,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType transform_reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType1, Properties1...>& first_view,
+    const ::Kokkos::View<DataType2, Properties2...>& second_view,
+    ValueType init_reduction_value, BinaryJoinerType joiner,
+    BinaryTransform transformer) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(first_view);
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(second_view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_reduce_custom_functors_team_impl(
+      teamHandle, KE::cbegin(first_view), KE::cend(first_view),
+      KE::cbegin(second_view), std::move(init_reduction_value),
+      std::move(joiner), std::move(transformer));
+}
+
+template <class TeamHandleType, class IteratorType, class ValueType,
+          class BinaryJoinerType, class UnaryTransform,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION
+std::enable_if_t<
+    ::Kokkos::Experimental::Impl::are_iterators<IteratorType>::value, ValueType>
+transform_reduce(const TeamHandleType& teamHandle, IteratorType first1,
+                 IteratorType last1, ValueType init_reduction_value,
+                 BinaryJoinerType joiner, UnaryTransform transformer) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+
+  return Impl::transform_reduce_custom_functors_team_impl(
+      teamHandle, first1, last1, std::move(init_reduction_value),
+      std::move(joiner), std::move(transformer));
+}
+
+template <class TeamHandleType, class DataType, class... Properties,
+          class ValueType, class BinaryJoinerType, class UnaryTransform,
+          Impl::enable_if_team_handle<TeamHandleType> = 0>
+KOKKOS_FUNCTION ValueType transform_reduce(
+    const TeamHandleType& teamHandle,
+    const ::Kokkos::View<DataType, Properties...>& view,
+    ValueType init_reduction_value, BinaryJoinerType joiner,
+    UnaryTransform transformer) {
+  static_assert(std::is_move_constructible<ValueType>::value,
+                "ValueType must be move constructible.");
+  Impl::static_assert_is_admissible_to_kokkos_std_algorithms(view);
+
+  namespace KE = ::Kokkos::Experimental;
+  return Impl::transform_reduce_custom_functors_team_impl(
+      teamHandle, KE::cbegin(view), KE::cend(view),
+      std::move(init_reduction_value), std::move(joiner),
+      std::move(transformer));
+}
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
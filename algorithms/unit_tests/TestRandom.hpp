@@ -53,6 +53,9 @@
 #include <Kokkos_Random.hpp>
 #include <cmath>
 #include <chrono>
+#include <vector>
+#include <algorithm>
+#include <utility>
 
 namespace Test {
 
@@ -120,6 +123,22 @@ RandomProperties operator+(const RandomProperties& org,
   return val;
 }
 
+// Counter-based pools hand out the stream of the work item, the other pools
+// any free state
+template <class GeneratorPool>
+KOKKOS_INLINE_FUNCTION typename GeneratorPool::generator_type get_test_state(
+    const GeneratorPool& rand_pool, const int) {
+  return rand_pool.get_state();
+}
+
+template <class DeviceType, class Bijection>
+KOKKOS_INLINE_FUNCTION Kokkos::Random_CounterBased<DeviceType, Bijection>
+get_test_state(
+    const Kokkos::Random_CounterBased_Pool<DeviceType, Bijection>& rand_pool,
+    const int i) {
+  return rand_pool.get_state(i);
+}
+
 template <class GeneratorPool, class Scalar>
 struct test_random_functor {
   using rnd_type = typename GeneratorPool::generator_type;
@@ -151,10 +170,10 @@ struct test_random_functor {
         density_3d(d3d) {}
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(int /*i*/, RandomProperties& prop) const {
+  void operator()(int i, RandomProperties& prop) const {
     using Kokkos::atomic_fetch_add;
 
-    rnd_type rand_gen = rand_pool.get_state();
+    rnd_type rand_gen = get_test_state(rand_pool, i);
     for (int k = 0; k < 1024; ++k) {
       const Scalar tmp = Kokkos::rand<rnd_type, Scalar>::draw(rand_gen);
       prop.count++;
@@ -543,6 +562,334 @@ struct TestDynRankView {
     ASSERT_LE(val.max_val, max);
   }
 };
+
+// Compares fill_random with the streams of its blocks of 4096 values drawn on
+// the host, which also checks that the result does not depend on the threads
+template <class ExecutionSpace, class Pool>
+void test_counter_based_fill_random() {
+  const int n = 10000;
+  Kokkos::View<double*, ExecutionSpace> a("A", n);
+  Kokkos::View<double*, ExecutionSpace> b("B", n);
+  Kokkos::fill_random(a, Pool(31415), 10.0, 100.0);
+  Kokkos::fill_random(b, Pool(31415), 10.0, 100.0);
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  auto h_b = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+
+  using host_pool_type = Kokkos::Random_CounterBased_Pool<
+      Kokkos::DefaultHostExecutionSpace, typename Pool::bijection_type>;
+  host_pool_type host_pool(31415);
+  const int block_size = 4096;
+  std::vector<double> expected(n);
+  for (int block = 0; block * block_size < n; ++block) {
+    auto gen    = host_pool.get_state(block);
+    const int m = std::min(block_size, n - block * block_size);
+    Kokkos::Impl::fill_random_block(gen, expected.data() + block * block_size,
+                                    m, 10.0, 100.0);
+  }
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(h_a(i), expected[i]);
+    ASSERT_EQ(h_b(i), expected[i]);
+  }
+}
+
+template <class ExecutionSpace, class Scalar>
+void test_fill_random_bulk_range(const Scalar begin, const Scalar end) {
+  using pool_type = Kokkos::Random_XorShift64_Pool<ExecutionSpace>;
+  const int n     = 100000;
+  Kokkos::View<Scalar*, ExecutionSpace> a("A", n);
+  Kokkos::fill_random(a, pool_type(4242), begin, end);
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+
+  // All values are in range and both ends of the range are reached
+  Scalar min_val = h_a(0), max_val = h_a(0);
+  double mean = 0;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_GE(h_a(i), begin);
+    ASSERT_LT(h_a(i), end);
+    min_val = std::min(min_val, h_a(i));
+    max_val = std::max(max_val, h_a(i));
+    mean += double(h_a(i)) / n;
+  }
+  const double range = double(end) - double(begin);
+  EXPECT_LT(double(min_val) - double(begin), 0.01 * range);
+  EXPECT_GT(double(max_val) - double(begin), 0.9 * range);
+  const double expected_mean = std::is_integral<Scalar>::value
+                                   ? 0.5 * (double(begin) + double(end) - 1)
+                                   : 0.5 * (double(begin) + double(end));
+  EXPECT_NEAR(mean, expected_mean, 0.01 * range);
+}
+
+// Samples of a distribution, drawn in chunks of 1000
+template <class Pool, class Sampler>
+struct test_distribution_functor {
+  Kokkos::View<double*, typename Pool::device_type> samples;
+  Pool pool;
+  Sampler sampler;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int chunk) const {
+    auto gen    = get_test_state(pool, chunk);
+    const int n = samples.extent(0);
+    for (int i = chunk * 1000; i < n && i < (chunk + 1) * 1000; ++i) {
+      samples(i) = sampler(gen);
+    }
+    pool.free_state(gen);
+  }
+};
+
+template <class ExecutionSpace, class Pool, class Sampler>
+std::vector<double> draw_distribution(const Pool& pool, const Sampler& sampler,
+                                      const int n) {
+  Kokkos::View<double*, typename Pool::device_type> samples("Samples", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, (n + 999) / 1000),
+      test_distribution_functor<Pool, Sampler>{samples, pool, sampler});
+  auto h_samples =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), samples);
+  return std::vector<double>(h_samples.data(), h_samples.data() + n);
+}
+
+// Checks the sample mean within five standard errors and the sample
+// variance within 3%
+inline void check_moments(const std::vector<double>& samples,
+                          const double mean, const double variance) {
+  const double n = samples.size();
+  double sum = 0, sum_sq = 0;
+  for (double x : samples) {
+    ASSERT_TRUE(std::isfinite(x));
+    sum += x;
+    sum_sq += (x - mean) * (x - mean);
+  }
+  EXPECT_NEAR(sum / n, mean, 5 * std::sqrt(variance / n));
+  EXPECT_NEAR(sum_sq / n, variance, 0.03 * variance);
+}
+
+// Checks the frequency of each value within five standard errors of its
+// probability
+template <class Pmf>
+void check_frequencies(const std::vector<double>& samples, const int max_k,
+                       Pmf pmf) {
+  const double n = samples.size();
+  std::vector<double> count(max_k + 1, 0);
+  for (double x : samples) {
+    ASSERT_EQ(x, std::floor(x));
+    ASSERT_GE(x, 0);
+    if (x <= max_k) count[int(x)] += 1;
+  }
+  for (int k = 0; k <= max_k; ++k) {
+    const double p = pmf(k);
+    EXPECT_NEAR(count[k] / n, p, 5 * std::sqrt(p * (1 - p) / n) + 1e-4)
+        << "value " << k;
+  }
+}
+
+struct exponential_sampler {
+  double rate;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_exponential(gen, rate);
+  }
+};
+
+struct gamma_sampler {
+  double shape, scale;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_gamma(gen, shape, scale);
+  }
+};
+
+struct poisson_sampler {
+  double mean;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_poisson(gen, mean);
+  }
+};
+
+struct binomial_sampler {
+  int64_t n;
+  double p;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_binomial(gen, n, p);
+  }
+};
+
+template <class DeviceType>
+struct alias_table_sampler {
+  Kokkos::Random_AliasTable<DeviceType> table;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return table.draw(gen);
+  }
+};
+
+template <class ExecutionSpace, class Pool>
+void test_distributions() {
+  const Pool pool(1234);
+  const int n = 200000;
+
+  for (double rate : {0.5, 4.0}) {
+    check_moments(draw_distribution<ExecutionSpace>(
+                      pool, exponential_sampler{rate}, n),
+                  1 / rate, 1 / (rate * rate));
+  }
+  for (double shape : {0.3, 1.0, 2.5, 50.0}) {
+    const double scale = 2;
+    check_moments(draw_distribution<ExecutionSpace>(
+                      pool, gamma_sampler{shape, scale}, n),
+                  shape * scale, shape * scale * scale);
+  }
+
+  // Small means are drawn by multiplication, large ones by rejection
+  for (double mean : {0.7, 4.0, 30.0, 1000.0}) {
+    const auto samples =
+        draw_distribution<ExecutionSpace>(pool, poisson_sampler{mean}, n);
+    check_moments(samples, mean, mean);
+    check_frequencies(samples, int(2 * mean) + 5, [mean](int k) {
+      return std::exp(-mean + k * std::log(mean) - std::lgamma(k + 1.0));
+    });
+  }
+
+  // Small n * p are drawn by inversion, the others by rejection
+  const std::pair<int64_t, double> binomials[] = {
+      {10, 0.3},    {15, 0.8},   {60, 0.4},
+      {1000, 0.97}, {5000, 0.3}, {100000, 0.5}};
+  for (auto const& b : binomials) {
+    const int64_t trials = b.first;
+    const double p       = b.second;
+    const auto samples   = draw_distribution<ExecutionSpace>(
+        pool, binomial_sampler{trials, p}, n);
+    check_moments(samples, trials * p, trials * p * (1 - p));
+    if (trials <= 5000) {
+      check_frequencies(samples, int(trials), [trials, p](int k) {
+        return std::exp(std::lgamma(trials + 1.0) - std::lgamma(k + 1.0) -
+                        std::lgamma(trials - k + 1.0) + k * std::log(p) +
+                        (trials - k) * std::log(1 - p));
+      });
+    }
+  }
+  EXPECT_EQ(
+      draw_distribution<ExecutionSpace>(pool, binomial_sampler{0, 0.5}, 10)[0],
+      0);
+
+  Kokkos::View<double*, ExecutionSpace> weights("Weights", 6);
+  auto h_weights = Kokkos::create_mirror_view(weights);
+  const double w[6] = {1, 0, 5, 0.5, 2, 1.5};
+  for (int i = 0; i < 6; ++i) h_weights(i) = w[i];
+  Kokkos::deep_copy(weights, h_weights);
+  alias_table_sampler<ExecutionSpace> alias{
+      Kokkos::Random_AliasTable<ExecutionSpace>(weights)};
+  check_frequencies(draw_distribution<ExecutionSpace>(pool, alias, n), 5,
+                    [&w](int k) { return w[k] / 10; });
+}
+
+template <class Pool>
+struct test_pool_draws_functor {
+  Kokkos::View<uint64_t**, typename Pool::device_type> draws;
+  Pool pool;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    auto gen = pool.get_state();
+    for (int j = 0; j < 4; ++j) draws(i, j) = gen.urand64();
+    pool.free_state(gen);
+  }
+};
+
+// Every state is used by one thread at a time, whether the threads own the
+// states of their rank or share fewer states. A state used by two threads at
+// once would repeat its draws.
+template <class ExecutionSpace, class Pool>
+void test_pool_sizes() {
+  const int n           = 50000;
+  const int concurrency = ExecutionSpace().concurrency();
+  for (int num_states : {1, 3, concurrency, concurrency + 5}) {
+    Pool pool;
+    pool.init(3141, num_states);
+    Kokkos::View<uint64_t**, typename Pool::device_type> draws("Draws", n, 4);
+    Kokkos::parallel_for(Kokkos::RangePolicy<ExecutionSpace>(0, n),
+                         test_pool_draws_functor<Pool>{draws, pool});
+    auto h_draws =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), draws);
+    std::vector<uint64_t> values(h_draws.data(), h_draws.data() + 4 * n);
+    std::sort(values.begin(), values.end());
+    EXPECT_TRUE(std::adjacent_find(values.begin(), values.end()) ==
+                values.end())
+        << num_states << " states";
+  }
+}
+
+template <class ExecutionSpace>
+void test_fill_random_bulk() {
+  test_fill_random_bulk_range<ExecutionSpace, int>(-10, 10);
+  test_fill_random_bulk_range<ExecutionSpace, unsigned>(3, 1000);
+  test_fill_random_bulk_range<ExecutionSpace, int64_t>(-5000000000,
+                                                       5000000000);
+  test_fill_random_bulk_range<ExecutionSpace, float>(-1.0f, 3.0f);
+  test_fill_random_bulk_range<ExecutionSpace, double>(10.0, 20.0);
+
+  // Non-contiguous views are filled value by value
+  using pool_type = Kokkos::Random_XorShift64_Pool<ExecutionSpace>;
+  Kokkos::View<int**, ExecutionSpace> b("B", 100, 10);
+  auto b_col = Kokkos::subview(b, Kokkos::ALL(), 3);
+  Kokkos::fill_random(b_col, pool_type(17), 1, 5);
+  auto h_b = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b);
+  for (int i = 0; i < 100; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      if (j == 3) {
+        ASSERT_GE(h_b(i, j), 1);
+        ASSERT_LT(h_b(i, j), 5);
+      } else {
+        ASSERT_EQ(h_b(i, j), 0);
+      }
+    }
+  }
+}
+
+template <class ExecutionSpace, class ViewType>
+void check_fill_random_normal(const ViewType& a, const double mean,
+                              const double std_dev) {
+  auto h_a = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a);
+  const int n0 = h_a.extent(0), n1 = h_a.extent(1);
+  const double n = double(n0) * n1;
+  double sum = 0, sum_sq = 0, tail = 0;
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      const double z = (h_a(i, j) - mean) / std_dev;
+      sum += z;
+      sum_sq += z * z;
+      if (z > 2) tail += 1;
+    }
+  }
+  EXPECT_NEAR(sum / n, 0.0, 0.02);
+  EXPECT_NEAR(sum_sq / n, 1.0, 0.02);
+  // P(Z > 2) = 0.02275
+  EXPECT_NEAR(tail / n, 0.02275, 0.003);
+}
+
+template <class ExecutionSpace>
+void test_fill_random_normal() {
+  using pool_type = Kokkos::Random_XorShift64_Pool<ExecutionSpace>;
+  Kokkos::View<double**, ExecutionSpace> a("A", 400, 250);
+  Kokkos::fill_random_normal(a, pool_type(2718), 5.0, 2.0);
+  check_fill_random_normal<ExecutionSpace>(a, 5.0, 2.0);
+
+  Kokkos::View<float**, ExecutionSpace> b("B", 250, 400);
+  Kokkos::fill_random_normal(b, pool_type(2718));
+  check_fill_random_normal<ExecutionSpace>(b, 0.0, 1.0);
+
+  // A strided view is filled through a contiguous temporary
+  Kokkos::View<double**, ExecutionSpace> c("C", 400, 500);
+  auto c_sub = Kokkos::subview(c, Kokkos::ALL(), Kokkos::make_pair(0, 250));
+  Kokkos::fill_random_normal(c_sub, pool_type(99), -1.0, 0.5);
+  check_fill_random_normal<ExecutionSpace>(c_sub, -1.0, 0.5);
+  auto h_c = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c);
+  for (int i = 0; i < 400; ++i) {
+    for (int j = 250; j < 500; ++j) ASSERT_EQ(h_c(i, j), 0.0);
+  }
+}
 }  // namespace Impl
 
 template <typename ExecutionSpace>
@@ -579,6 +926,80 @@ void test_random_xorshift1024() {
                         Kokkos::Random_XorShift1024_Pool<ExecutionSpace>>(10000)
       .run();
 }
+
+// Known answers from the Random123 test vectors
+inline void test_random_counter_based_known_answers() {
+  {
+    const uint32_t key[2] = {0, 0};
+    uint32_t ctr[4]       = {0, 0, 0, 0};
+    Kokkos::Impl::Random_Philox4x32_Bijection::apply(key, ctr);
+    ASSERT_EQ(ctr[0], 0x6627e8d5U);
+    ASSERT_EQ(ctr[1], 0xe169c58dU);
+    ASSERT_EQ(ctr[2], 0xbc57ac4cU);
+    ASSERT_EQ(ctr[3], 0x9b00dbd8U);
+  }
+  {
+    const uint32_t key[2] = {0xa4093822U, 0x299f31d0U};
+    uint32_t ctr[4] = {0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U};
+    Kokkos::Impl::Random_Philox4x32_Bijection::apply(key, ctr);
+    ASSERT_EQ(ctr[0], 0xd16cfe09U);
+    ASSERT_EQ(ctr[1], 0x94fdccebU);
+    ASSERT_EQ(ctr[2], 0x5001e420U);
+    ASSERT_EQ(ctr[3], 0x24126ea1U);
+  }
+  {
+    const uint64_t key[2] = {0, 0};
+    uint64_t ctr[2]       = {0, 0};
+    Kokkos::Impl::Random_Threefry2x64_Bijection::apply(key, ctr);
+    ASSERT_EQ(ctr[0], 0xc2b6e3a8c2c69865ULL);
+    ASSERT_EQ(ctr[1], 0x6f81ed42f350084dULL);
+  }
+}
+
+template <typename ExecutionSpace>
+void test_random_philox4x32() {
+  const int num_draws = 10240000;
+  Impl::test_random<Kokkos::Random_Philox4x32_Pool<ExecutionSpace>>(num_draws);
+  Impl::TestDynRankView<ExecutionSpace,
+                        Kokkos::Random_Philox4x32_Pool<ExecutionSpace>>(10000)
+      .run();
+  Impl::test_counter_based_fill_random<
+      ExecutionSpace, Kokkos::Random_Philox4x32_Pool<ExecutionSpace>>();
+}
+
+template <typename ExecutionSpace>
+void test_random_threefry2x64() {
+  const int num_draws = 10240000;
+  Impl::test_random<Kokkos::Random_Threefry2x64_Pool<ExecutionSpace>>(
+      num_draws);
+  Impl::TestDynRankView<ExecutionSpace,
+                        Kokkos::Random_Threefry2x64_Pool<ExecutionSpace>>(10000)
+      .run();
+  Impl::test_counter_based_fill_random<
+      ExecutionSpace, Kokkos::Random_Threefry2x64_Pool<ExecutionSpace>>();
+}
+
+template <typename ExecutionSpace>
+void test_random_distributions() {
+  Impl::test_distributions<ExecutionSpace,
+                           Kokkos::Random_XorShift64_Pool<ExecutionSpace>>();
+  Impl::test_distributions<ExecutionSpace,
+                           Kokkos::Random_Philox4x32_Pool<ExecutionSpace>>();
+}
+
+template <typename ExecutionSpace>
+void test_random_pool_sizes() {
+  Impl::test_pool_sizes<ExecutionSpace,
+                        Kokkos::Random_XorShift64_Pool<ExecutionSpace>>();
+  Impl::test_pool_sizes<ExecutionSpace,
+                        Kokkos::Random_XorShift1024_Pool<ExecutionSpace>>();
+}
+
+template <typename ExecutionSpace>
+void test_random_fill_bulk() {
+  Impl::test_fill_random_bulk<ExecutionSpace>();
+  Impl::test_fill_random_normal<ExecutionSpace>();
+}
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_HPP
@@ -55,6 +55,24 @@ TEST(TEST_CATEGORY, Random_XorShift64) {
 TEST(TEST_CATEGORY, Random_XorShift1024_0) {
   test_random_xorshift1024<TEST_EXECSPACE>();
 }
+TEST(TEST_CATEGORY, Random_CounterBasedKnownAnswers) {
+  test_random_counter_based_known_answers();
+}
+TEST(TEST_CATEGORY, Random_Philox4x32) {
+  test_random_philox4x32<TEST_EXECSPACE>();
+}
+TEST(TEST_CATEGORY, Random_Threefry2x64) {
+  test_random_threefry2x64<TEST_EXECSPACE>();
+}
+TEST(TEST_CATEGORY, Random_Distributions) {
+  test_random_distributions<TEST_EXECSPACE>();
+}
+TEST(TEST_CATEGORY, Random_PoolSizes) {
+  test_random_pool_sizes<TEST_EXECSPACE>();
+}
+TEST(TEST_CATEGORY, Random_FillBulk) {
+  test_random_fill_bulk<TEST_EXECSPACE>();
+}
 }  // namespace Test
 
 #endif
@@ -45,10 +45,19 @@
 
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
+#include <Kokkos_CrsFromCoo.hpp>
 #include <Kokkos_DynamicView.hpp>
+#include <Kokkos_Histogram.hpp>
 #include <Kokkos_Random.hpp>
+#include <Kokkos_SegmentedSort.hpp>
 #include <Kokkos_Sort.hpp>
 
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
 namespace Test {
 
 namespace Impl {
@@ -355,6 +364,588 @@ void test_issue_1160_impl() {
 
 //----------------------------------------------------------------------------
 
+template <class KeyType>
+std::enable_if_t<std::is_integral<KeyType>::value, KeyType> random_key(
+    std::mt19937_64& gen) {
+  return KeyType(gen());
+}
+
+template <class KeyType>
+std::enable_if_t<std::is_floating_point<KeyType>::value, KeyType> random_key(
+    std::mt19937_64& gen) {
+  return std::uniform_real_distribution<KeyType>(-1e6, 1e6)(gen);
+}
+
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort_impl(unsigned int n) {
+  using KeyViewType = Kokkos::View<KeyType*, ExecutionSpace>;
+  KeyViewType keys("Keys", n);
+  auto h_keys = Kokkos::create_mirror_view(keys);
+
+  std::mt19937_64 gen(1931);
+  for (unsigned int i = 0; i < n; ++i) h_keys(i) = random_key<KeyType>(gen);
+  h_keys(0)     = Kokkos::Experimental::finite_max<KeyType>::value;
+  h_keys(n / 2) = Kokkos::Experimental::finite_min<KeyType>::value;
+  h_keys(n - 1) = KeyType(0);
+
+  std::vector<KeyType> expected(h_keys.data(), h_keys.data() + n);
+  std::sort(expected.begin(), expected.end());
+
+  ExecutionSpace exec;
+  Kokkos::deep_copy(exec, keys, h_keys);
+  Kokkos::sort(exec, keys);
+  Kokkos::deep_copy(exec, h_keys, keys);
+  exec.fence();
+
+  for (unsigned int i = 0; i < n; ++i) ASSERT_EQ(h_keys(i), expected[i]);
+}
+
+template <class ExecutionSpace, typename KeyType>
+void test_radix_sort() {
+  // Around the size at which Kokkos::sort switches to the radix sort
+  const unsigned int n = Kokkos::Impl::radix_sort_min_size;
+  test_radix_sort_impl<ExecutionSpace, KeyType>(n - 1);
+  test_radix_sort_impl<ExecutionSpace, KeyType>(n);
+  test_radix_sort_impl<ExecutionSpace, KeyType>(7 * n + 13);
+}
+
+//----------------------------------------------------------------------------
+
+template <class KeyType>
+struct GreaterThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const KeyType& a, const KeyType& b) const { return a > b; }
+};
+
+// Orders pairs by their first member only, to check stability
+struct FirstLessThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const Kokkos::pair<int, int>& a,
+                  const Kokkos::pair<int, int>& b) const {
+    return a.first < b.first;
+  }
+};
+
+template <class ExecutionSpace, typename KeyType>
+void test_sort_with_comparator_impl(unsigned int n) {
+  using KeyViewType = Kokkos::View<KeyType*, ExecutionSpace>;
+  KeyViewType keys("Keys", n);
+  auto h_keys = Kokkos::create_mirror_view(keys);
+
+  std::mt19937_64 gen(n);
+  for (unsigned int i = 0; i < n; ++i) h_keys(i) = random_key<KeyType>(gen);
+
+  std::vector<KeyType> expected(h_keys.data(), h_keys.data() + n);
+  std::sort(expected.begin(), expected.end(), GreaterThan<KeyType>());
+
+  ExecutionSpace exec;
+  Kokkos::deep_copy(exec, keys, h_keys);
+  Kokkos::sort(exec, keys, GreaterThan<KeyType>());
+  Kokkos::deep_copy(exec, h_keys, keys);
+  exec.fence();
+
+  for (unsigned int i = 0; i < n; ++i) ASSERT_EQ(h_keys(i), expected[i]);
+}
+
+template <class ExecutionSpace>
+void test_stable_sort_with_comparator_impl(unsigned int n) {
+  using value_type = Kokkos::pair<int, int>;
+  Kokkos::View<value_type*, ExecutionSpace> values("Values", n);
+  auto h_values = Kokkos::create_mirror_view(values);
+
+  // Few distinct keys, the second member records the original position
+  std::mt19937_64 gen(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    h_values(i) = value_type(int(gen() % 37), int(i));
+  }
+
+  std::vector<value_type> expected(h_values.data(), h_values.data() + n);
+  std::stable_sort(expected.begin(), expected.end(), FirstLessThan());
+
+  Kokkos::deep_copy(values, h_values);
+  Kokkos::sort(values, FirstLessThan());
+  Kokkos::deep_copy(h_values, values);
+
+  for (unsigned int i = 0; i < n; ++i) {
+    ASSERT_EQ(h_values(i).first, expected[i].first);
+    ASSERT_EQ(h_values(i).second, expected[i].second);
+  }
+}
+
+template <class ExecutionSpace>
+void test_sort_with_comparator() {
+  for (unsigned int n : {0u, 1u, 15u, 17u, 1000u, 65537u}) {
+    test_sort_with_comparator_impl<ExecutionSpace, int>(n);
+    test_sort_with_comparator_impl<ExecutionSpace, double>(n);
+    test_stable_sort_with_comparator_impl<ExecutionSpace>(n);
+  }
+}
+
+//----------------------------------------------------------------------------
+
+template <class ExecutionSpace, typename KeyType>
+void test_sort_by_key_impl(unsigned int n) {
+  using KeyViewType = Kokkos::View<KeyType*, ExecutionSpace>;
+  KeyViewType keys("Keys", n);
+  Kokkos::View<int*, ExecutionSpace> indices("Indices", n);
+  Kokkos::View<double* [3], ExecutionSpace> coords("Coords", n);
+  Kokkos::View<int*, ExecutionSpace> later("Later", n);
+
+  auto h_keys    = Kokkos::create_mirror_view(keys);
+  auto h_indices = Kokkos::create_mirror_view(indices);
+  auto h_coords  = Kokkos::create_mirror_view(coords);
+
+  // Many equal keys, to check that the order among them is kept
+  std::mt19937_64 gen(n);
+  std::vector<std::pair<KeyType, int>> expected(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    h_keys(i)    = KeyType(int(gen() % 101) - 50);
+    h_indices(i) = i;
+    for (int j = 0; j < 3; ++j) h_coords(i, j) = 3 * i + j;
+    expected[i] = std::make_pair(h_keys(i), int(i));
+  }
+  std::stable_sort(
+      expected.begin(), expected.end(),
+      [](const std::pair<KeyType, int>& a, const std::pair<KeyType, int>& b) {
+        return a.first < b.first;
+      });
+
+  ExecutionSpace exec;
+  Kokkos::deep_copy(exec, keys, h_keys);
+  Kokkos::deep_copy(exec, indices, h_indices);
+  Kokkos::deep_copy(exec, coords, h_coords);
+  Kokkos::deep_copy(exec, later, indices);
+
+  auto permutation = Kokkos::sort_by_key(exec, keys, indices, coords);
+  Kokkos::apply_permutation(exec, permutation, later);
+
+  Kokkos::deep_copy(exec, h_keys, keys);
+  Kokkos::deep_copy(exec, h_indices, indices);
+  Kokkos::deep_copy(exec, h_coords, coords);
+  auto h_later =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), later);
+  auto h_permutation =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), permutation);
+
+  for (unsigned int i = 0; i < n; ++i) {
+    ASSERT_EQ(h_keys(i), expected[i].first);
+    ASSERT_EQ(h_indices(i), expected[i].second);
+    ASSERT_EQ(h_later(i), expected[i].second);
+    ASSERT_EQ(int(h_permutation(i)), expected[i].second);
+    for (int j = 0; j < 3; ++j) {
+      ASSERT_EQ(h_coords(i, j), 3 * expected[i].second + j);
+    }
+  }
+}
+
+template <class ExecutionSpace>
+void test_sort_by_key() {
+  for (unsigned int n : {0u, 1u, 100u, 70001u}) {
+    test_sort_by_key_impl<ExecutionSpace, int>(n);
+    test_sort_by_key_impl<ExecutionSpace, double>(n);
+  }
+
+  Kokkos::View<int*, ExecutionSpace> keys("Keys", 10);
+  Kokkos::View<int*, ExecutionSpace> values("Values", 11);
+  ASSERT_THROW(Kokkos::sort_by_key(keys, values), std::runtime_error);
+}
+
+//----------------------------------------------------------------------------
+
+// Clustered keys end up in few, large bins which are sorted by the heap sort
+// and team merge sort paths of BinSort
+template <class ExecutionSpace>
+void test_sort_within_bins_impl(unsigned int n, int num_bins) {
+  using KeyViewType = Kokkos::View<double*, ExecutionSpace>;
+  KeyViewType keys("Keys", n);
+  auto h_keys = Kokkos::create_mirror_view(keys);
+
+  std::mt19937_64 gen(n + num_bins);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  for (unsigned int i = 0; i < n; ++i) {
+    h_keys(i) = int(gen() % num_bins) + dist(gen);
+  }
+  std::vector<double> expected(h_keys.data(), h_keys.data() + n);
+  std::sort(expected.begin(), expected.end());
+
+  ExecutionSpace exec;
+  Kokkos::deep_copy(exec, keys, h_keys);
+
+  using BinOp = Kokkos::BinOp1D<KeyViewType>;
+  Kokkos::BinSort<KeyViewType, BinOp> bin_sort(
+      exec, keys, BinOp(num_bins, 0.0, double(num_bins)), true);
+  bin_sort.create_permute_vector(exec);
+  bin_sort.sort(exec, keys);
+
+  Kokkos::deep_copy(exec, h_keys, keys);
+  exec.fence();
+
+  for (unsigned int i = 0; i < n; ++i) ASSERT_EQ(h_keys(i), expected[i]);
+}
+
+template <class ExecutionSpace>
+void test_sort_within_bins() {
+  test_sort_within_bins_impl<ExecutionSpace>(20000, 1000);
+  test_sort_within_bins_impl<ExecutionSpace>(100003, 5);
+  test_sort_within_bins_impl<ExecutionSpace>(100003, 1);
+}
+
+//----------------------------------------------------------------------------
+
+// Sorts the first lengths(r) entries of every row r of keys in one launch,
+// with one team per row
+template <class ExecutionSpace, class Comparator>
+struct NestedSortFunctor {
+  using member_type = typename Kokkos::TeamPolicy<ExecutionSpace>::member_type;
+  using scratch_view_type =
+      Kokkos::View<int*, typename ExecutionSpace::scratch_memory_space,
+                   Kokkos::MemoryUnmanaged>;
+
+  Kokkos::View<int**, ExecutionSpace> keys;
+  Kokkos::View<int**, ExecutionSpace> values;
+  Kokkos::View<int*, ExecutionSpace> lengths;
+  Comparator comp;
+  int mode;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type& t) const {
+    namespace KE    = Kokkos::Experimental;
+    const int row   = t.league_rank();
+    const int len   = lengths(row);
+    const auto cols = Kokkos::make_pair(0, len);
+    auto row_keys   = Kokkos::subview(keys, row, cols);
+    auto row_values = Kokkos::subview(values, row, cols);
+
+    if (mode == 0) {
+      // Sort a copy in team scratch
+      scratch_view_type scratch(t.team_scratch(0), len);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(t, len),
+                           [&](const int i) { scratch(i) = row_keys(i); });
+      t.team_barrier();
+      KE::sort_team(t, scratch, comp);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(t, len),
+                           [&](const int i) { row_keys(i) = scratch(i); });
+    } else if (mode == 1) {
+      KE::sort_by_key_team(t, row_keys, row_values, comp);
+    } else if (mode == 2) {
+      Kokkos::single(Kokkos::PerTeam(t),
+                     [&]() { KE::sort_thread(t, row_keys, comp); });
+    } else {
+      Kokkos::single(Kokkos::PerTeam(t), [&]() {
+        KE::sort_by_key_thread(t, row_keys, row_values, comp);
+      });
+    }
+  }
+};
+
+template <class ExecutionSpace, class Comparator>
+void test_nested_sort_impl(const int mode, const Comparator comp) {
+  const int num_rows = 37;
+  const int max_len  = 300;
+  Kokkos::View<int**, ExecutionSpace> keys("Keys", num_rows, max_len);
+  Kokkos::View<int**, ExecutionSpace> values("Values", num_rows, max_len);
+  Kokkos::View<int*, ExecutionSpace> lengths("Lengths", num_rows);
+  auto h_keys    = Kokkos::create_mirror_view(keys);
+  auto h_values  = Kokkos::create_mirror_view(values);
+  auto h_lengths = Kokkos::create_mirror_view(lengths);
+
+  // Rows of varying length, including empty ones and powers of two
+  std::mt19937 gen(mode);
+  for (int r = 0; r < num_rows; ++r) {
+    h_lengths(r) = r < 3 ? (1 << (4 * r)) : (r * 53) % (max_len + 1);
+    for (int i = 0; i < max_len; ++i) {
+      h_keys(r, i)   = int(gen() % 100);
+      h_values(r, i) = i;
+    }
+  }
+  auto h_original = Kokkos::create_mirror(keys);
+  Kokkos::deep_copy(h_original, h_keys);
+  Kokkos::deep_copy(keys, h_keys);
+  Kokkos::deep_copy(values, h_values);
+  Kokkos::deep_copy(lengths, h_lengths);
+
+  using functor_type = NestedSortFunctor<ExecutionSpace, Comparator>;
+  Kokkos::TeamPolicy<ExecutionSpace> policy(num_rows, Kokkos::AUTO);
+  policy.set_scratch_size(
+      0, Kokkos::PerTeam(functor_type::scratch_view_type::shmem_size(max_len)));
+  Kokkos::parallel_for(policy,
+                       functor_type{keys, values, lengths, comp, mode});
+
+  Kokkos::deep_copy(h_keys, keys);
+  Kokkos::deep_copy(h_values, values);
+
+  for (int r = 0; r < num_rows; ++r) {
+    const int len = h_lengths(r);
+    std::vector<int> expected(&h_original(r, 0), &h_original(r, 0) + len);
+    std::sort(expected.begin(), expected.end(), comp);
+    for (int i = 0; i < len; ++i) {
+      ASSERT_EQ(h_keys(r, i), expected[i]);
+      if (mode == 1 || mode == 3) {
+        ASSERT_EQ(h_original(r, h_values(r, i)), h_keys(r, i));
+      }
+    }
+    for (int i = len; i < max_len; ++i) {
+      ASSERT_EQ(h_keys(r, i), h_original(r, i));
+    }
+  }
+}
+
+template <class ExecutionSpace>
+void test_nested_sort() {
+  for (int mode = 0; mode < 4; ++mode) {
+    test_nested_sort_impl<ExecutionSpace>(
+        mode, Kokkos::Experimental::Impl::NestedSortLessThan<int>{});
+    test_nested_sort_impl<ExecutionSpace>(mode, GreaterThan<int>{});
+  }
+}
+
+//----------------------------------------------------------------------------
+
+template <class ExecutionSpace>
+void test_segmented_sort_impl(const bool with_values) {
+  // Row lengths covering the short, medium and long buckets and their limits
+  const std::vector<size_t> lengths = {0,    1,    2,    31,   32,   33,
+                                       100,  1023, 1024, 1025, 3000, 8192,
+                                       8193, 0,    20000, 7,   500,  40000};
+  const size_t num_rows = lengths.size();
+
+  Kokkos::View<size_t*, ExecutionSpace> row_map("RowMap", num_rows + 1);
+  auto h_row_map = Kokkos::create_mirror_view(row_map);
+  h_row_map(0)   = 0;
+  for (size_t r = 0; r < num_rows; ++r) {
+    h_row_map(r + 1) = h_row_map(r) + lengths[r];
+  }
+  const size_t n = h_row_map(num_rows);
+
+  Kokkos::View<int*, ExecutionSpace> entries("Entries", n);
+  Kokkos::View<int*, ExecutionSpace> values("Values", n);
+  auto h_entries = Kokkos::create_mirror_view(entries);
+  auto h_values  = Kokkos::create_mirror_view(values);
+  std::mt19937 gen(with_values);
+  for (size_t i = 0; i < n; ++i) {
+    h_entries(i) = int(gen() % 1000);
+    h_values(i)  = int(i);
+  }
+  auto h_original = Kokkos::create_mirror(entries);
+  Kokkos::deep_copy(h_original, h_entries);
+  Kokkos::deep_copy(row_map, h_row_map);
+  Kokkos::deep_copy(entries, h_entries);
+  Kokkos::deep_copy(values, h_values);
+
+  ExecutionSpace exec;
+  if (with_values) {
+    Kokkos::Experimental::segmented_sort(exec, row_map, entries, values);
+  } else {
+    Kokkos::Experimental::segmented_sort(exec, row_map, entries);
+  }
+  exec.fence();
+
+  Kokkos::deep_copy(h_entries, entries);
+  Kokkos::deep_copy(h_values, values);
+
+  for (size_t r = 0; r < num_rows; ++r) {
+    const size_t begin = h_row_map(r);
+    const size_t end   = h_row_map(r + 1);
+    std::vector<int> expected(&h_original(0) + begin, &h_original(0) + end);
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = begin; i < end; ++i) {
+      ASSERT_EQ(h_entries(i), expected[i - begin]);
+      if (with_values) {
+        ASSERT_GE(size_t(h_values(i)), begin);
+        ASSERT_LT(size_t(h_values(i)), end);
+        ASSERT_EQ(h_original(h_values(i)), h_entries(i));
+      }
+    }
+  }
+}
+
+template <class ExecutionSpace>
+void test_create_sorted_staticcrsgraph() {
+  using graph_type = Kokkos::StaticCrsGraph<int, ExecutionSpace>;
+
+  std::vector<std::vector<int>> input(5);
+  std::mt19937 gen(5);
+  for (size_t r = 0; r < input.size(); ++r) {
+    for (size_t i = 0; i < r * r * 20; ++i) input[r].push_back(int(gen() % 50));
+  }
+
+  auto graph = Kokkos::Experimental::create_sorted_staticcrsgraph<graph_type>(
+      "Graph", input);
+  auto h_graph = Kokkos::create_mirror(graph);
+
+  ASSERT_EQ(h_graph.numRows(), input.size());
+  for (size_t r = 0; r < input.size(); ++r) {
+    std::sort(input[r].begin(), input[r].end());
+    ASSERT_EQ(h_graph.row_map(r + 1) - h_graph.row_map(r), input[r].size());
+    for (size_t i = 0; i < input[r].size(); ++i) {
+      ASSERT_EQ(h_graph.entries(h_graph.row_map(r) + i), input[r][i]);
+    }
+  }
+}
+
+template <class ExecutionSpace>
+void test_segmented_sort() {
+  test_segmented_sort_impl<ExecutionSpace>(false);
+  test_segmented_sort_impl<ExecutionSpace>(true);
+  test_create_sorted_staticcrsgraph<ExecutionSpace>();
+}
+
+template <class ExecutionSpace, class GraphType>
+void test_crs_from_coo_impl(const int64_t num_rows, const bool with_values,
+                            const bool deduplicate) {
+  // Coordinates with many repeats, leaving some rows empty
+  const int n = 20000;
+  Kokkos::View<int*, ExecutionSpace> rows("Rows", n);
+  Kokkos::View<int*, ExecutionSpace> cols("Cols", n);
+  Kokkos::View<double*, ExecutionSpace> vals("Vals", n);
+  auto h_rows = Kokkos::create_mirror_view(rows);
+  auto h_cols = Kokkos::create_mirror_view(cols);
+  auto h_vals = Kokkos::create_mirror_view(vals);
+  std::mt19937 gen(num_rows + 2 * with_values + deduplicate);
+  std::map<std::pair<int, int>, std::pair<int, double>> expected;
+  for (int i = 0; i < n; ++i) {
+    h_rows(i) = int(gen() % 500);
+    if (h_rows(i) % 7 == 3) h_rows(i) = 0;
+    h_cols(i) = int(gen() % 300);
+    h_vals(i) = double(gen() % 100);
+    auto& e   = expected[std::make_pair(h_rows(i), h_cols(i))];
+    e.first += 1;
+    e.second += h_vals(i);
+  }
+  Kokkos::deep_copy(rows, h_rows);
+  Kokkos::deep_copy(cols, h_cols);
+  Kokkos::deep_copy(vals, h_vals);
+
+  ExecutionSpace exec;
+  Kokkos::View<double*, ExecutionSpace> values;
+  GraphType graph;
+  if (num_rows < 0 && with_values) {
+    graph = Kokkos::Experimental::crs_from_coo<GraphType>(
+        exec, rows, cols, vals, values, deduplicate);
+  } else if (num_rows < 0) {
+    graph = Kokkos::Experimental::crs_from_coo<GraphType>(exec, rows, cols,
+                                                          deduplicate);
+  } else if (with_values) {
+    graph = Kokkos::Experimental::crs_from_coo<GraphType>(
+        exec, num_rows, rows, cols, vals, values, deduplicate);
+  } else {
+    graph = Kokkos::Experimental::crs_from_coo<GraphType>(
+        exec, num_rows, rows, cols, deduplicate);
+  }
+  exec.fence();
+
+  auto h_row_map =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), graph.row_map);
+  auto h_entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), graph.entries);
+  auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+
+  // Every row is sorted and holds its coordinates, once each when
+  // deduplicating, with the values of repeated coordinates summed
+  const int64_t expected_rows = num_rows < 0 ? 500 : num_rows;
+  ASSERT_EQ(int64_t(h_row_map.extent(0)), expected_rows + 1);
+  ASSERT_EQ(h_row_map(0), 0u);
+  ASSERT_EQ(h_entries.extent(0), size_t(h_row_map(expected_rows)));
+  if (with_values) {
+    ASSERT_EQ(h_values.extent(0), h_entries.extent(0));
+  }
+  std::map<std::pair<int, int>, std::pair<int, double>> found;
+  for (int64_t r = 0; r < expected_rows; ++r) {
+    for (auto k = h_row_map(r); k < h_row_map(r + 1); ++k) {
+      if (k > h_row_map(r)) {
+        if (deduplicate) {
+          ASSERT_LT(h_entries(k - 1), h_entries(k));
+        } else {
+          ASSERT_LE(h_entries(k - 1), h_entries(k));
+        }
+      }
+      auto& f = found[std::make_pair(int(r), int(h_entries(k)))];
+      f.first += 1;
+      if (with_values) f.second += h_values(k);
+    }
+  }
+  ASSERT_EQ(found.size(), expected.size());
+  for (auto const& e : expected) {
+    const auto f = found.find(e.first);
+    ASSERT_TRUE(f != found.end());
+    ASSERT_EQ(f->second.first, deduplicate ? 1 : e.second.first);
+    if (with_values) {
+      ASSERT_EQ(f->second.second, e.second.second);
+    }
+  }
+}
+
+template <class ExecutionSpace>
+void test_crs_from_coo() {
+  using graph_type = Kokkos::StaticCrsGraph<int, ExecutionSpace>;
+  using crs_type   = Kokkos::Crs<int, ExecutionSpace>;
+  for (int mode = 0; mode < 8; ++mode) {
+    const int64_t num_rows = mode & 1 ? 600 : -1;
+    test_crs_from_coo_impl<ExecutionSpace, graph_type>(num_rows, mode & 2,
+                                                       mode & 4);
+  }
+  test_crs_from_coo_impl<ExecutionSpace, crs_type>(-1, true, true);
+  test_crs_from_coo_impl<ExecutionSpace, crs_type>(700, false, false);
+
+  // No coordinates
+  Kokkos::View<int*, ExecutionSpace> none("None", 0);
+  auto graph = Kokkos::Experimental::crs_from_coo<graph_type>(
+      ExecutionSpace(), 4, none, none, true);
+  ASSERT_EQ(graph.numRows(), 4u);
+  ASSERT_EQ(graph.entries.extent(0), 0u);
+}
+
+template <class ExecutionSpace>
+void test_histogram_impl(const int n, const int num_bins) {
+  using KeyViewType = Kokkos::View<int*, ExecutionSpace>;
+  using BinOp       = Kokkos::BinOp1D<KeyViewType>;
+  using Strategy    = Kokkos::Experimental::HistogramStrategy;
+
+  // Skewed keys, half of them in the first bin
+  KeyViewType keys("Keys", n);
+  auto h_keys = Kokkos::create_mirror_view(keys);
+  std::mt19937 gen(n + num_bins);
+  std::vector<int> expected(num_bins + 1, 0);
+  for (int i = 0; i < n; ++i) {
+    h_keys(i) = gen() % 2 ? 0 : int(gen() % num_bins);
+    ++expected[h_keys(i)];
+  }
+  Kokkos::deep_copy(keys, h_keys);
+
+  ExecutionSpace exec;
+  const BinOp bin_op(num_bins, 0, num_bins);
+  Kokkos::View<int*, ExecutionSpace> bins("Bins", bin_op.max_bins());
+  auto h_bins = Kokkos::create_mirror_view(bins);
+  for (auto strategy : {Strategy::Automatic, Strategy::Atomic,
+                        Strategy::Duplicated, Strategy::Private}) {
+    Kokkos::deep_copy(bins, -1);
+    Kokkos::Experimental::histogram(exec, keys, bins, bin_op, strategy);
+    Kokkos::deep_copy(exec, h_bins, bins);
+    exec.fence();
+    for (int b = 0; b <= num_bins; ++b) ASSERT_EQ(h_bins(b), expected[b]);
+
+    Kokkos::BinSort<KeyViewType, BinOp> bin_sort(exec, keys, bin_op);
+    bin_sort.count_strategy = strategy;
+    bin_sort.create_permute_vector(exec);
+    // Counting again must not accumulate
+    bin_sort.create_permute_vector(exec);
+    Kokkos::deep_copy(exec, h_bins, bin_sort.get_bin_count());
+    exec.fence();
+    for (int b = 0; b <= num_bins; ++b) ASSERT_EQ(h_bins(b), expected[b]);
+  }
+}
+
+template <class ExecutionSpace>
+void test_histogram() {
+  test_histogram_impl<ExecutionSpace>(0, 10);
+  test_histogram_impl<ExecutionSpace>(100003, 4);
+  test_histogram_impl<ExecutionSpace>(100003, 1000);
+  test_histogram_impl<ExecutionSpace>(20000, 100000);
+}
+
+//----------------------------------------------------------------------------
+
 template <class ExecutionSpace, typename KeyType>
 void test_1D_sort(unsigned int N) {
   test_1D_sort_impl<ExecutionSpace, KeyType>(N * N * N, true);
@@ -51,5 +51,35 @@ namespace Test {
 TEST(TEST_CATEGORY, SortUnsigned) {
   Impl::test_sort<TEST_EXECSPACE, unsigned>(171);
 }
+
+TEST(TEST_CATEGORY, SortRadix) {
+  Impl::test_radix_sort<TEST_EXECSPACE, int>();
+  Impl::test_radix_sort<TEST_EXECSPACE, unsigned>();
+  Impl::test_radix_sort<TEST_EXECSPACE, int8_t>();
+  Impl::test_radix_sort<TEST_EXECSPACE, uint16_t>();
+  Impl::test_radix_sort<TEST_EXECSPACE, int64_t>();
+  Impl::test_radix_sort<TEST_EXECSPACE, float>();
+  Impl::test_radix_sort<TEST_EXECSPACE, double>();
+}
+
+TEST(TEST_CATEGORY, SortComparator) {
+  Impl::test_sort_with_comparator<TEST_EXECSPACE>();
+}
+
+TEST(TEST_CATEGORY, SortByKey) { Impl::test_sort_by_key<TEST_EXECSPACE>(); }
+
+TEST(TEST_CATEGORY, SortWithinBins) {
+  Impl::test_sort_within_bins<TEST_EXECSPACE>();
+}
+
+TEST(TEST_CATEGORY, SortNested) { Impl::test_nested_sort<TEST_EXECSPACE>(); }
+
+TEST(TEST_CATEGORY, SortSegmented) {
+  Impl::test_segmented_sort<TEST_EXECSPACE>();
+}
+
+TEST(TEST_CATEGORY, CrsFromCoo) { Impl::test_crs_from_coo<TEST_EXECSPACE>(); }
+
+TEST(TEST_CATEGORY, Histogram) { Impl::test_histogram<TEST_EXECSPACE>(); }
 }  // namespace Test
 #endif
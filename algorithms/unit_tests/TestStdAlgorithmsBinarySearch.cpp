@@ -0,0 +1,221 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_BinarySearchOperations.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+
+namespace Test {
+namespace stdalgos {
+namespace BinarySearch {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct CustomLessThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a < b;
+  }
+};
+
+// sorted, with many duplicates
+template <class ViewType>
+void fill_view_sorted(ViewType dest_view, int max_value) {
+  using value_type = typename ViewType::value_type;
+  using exe_space  = typename ViewType::execution_space;
+
+  const std::size_t ext = dest_view.extent(0);
+  using aux_view_t      = Kokkos::View<value_type*, exe_space>;
+  aux_view_t aux_view("aux_view", ext);
+  auto v_h = create_mirror_view(Kokkos::HostSpace(), aux_view);
+
+  std::mt19937 gen(ext);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  for (std::size_t i = 0; i < ext; ++i) {
+    v_h(i) = static_cast<value_type>(dist(gen));
+  }
+  std::sort(v_h.data(), v_h.data() + ext);
+
+  Kokkos::deep_copy(aux_view, v_h);
+  CopyFunctor<aux_view_t, ViewType> F1(aux_view, dest_view);
+  Kokkos::parallel_for("copy", dest_view.extent(0), F1);
+  Kokkos::fence();
+}
+
+template <class ViewType, class ValueType>
+void test_single_searches(ViewType view, const std::vector<ValueType>& gold,
+                          ValueType value) {
+  using comp_t          = CustomLessThanComparator<ValueType>;
+  const auto gold_lower = std::lower_bound(gold.begin(), gold.end(), value);
+  const auto gold_upper = std::upper_bound(gold.begin(), gold.end(), value);
+  const auto gold_lower_index = gold_lower - gold.begin();
+  const auto gold_upper_index = gold_upper - gold.begin();
+
+  const auto first = KE::cbegin(view);
+  const auto last  = KE::cend(view);
+
+  // lower_bound
+  EXPECT_EQ(gold_lower_index, KE::lower_bound(exespace(), first, last, value) -
+                                  first);
+  EXPECT_EQ(gold_lower_index,
+            KE::lower_bound("label", exespace(), first, last, value) - first);
+  EXPECT_EQ(gold_lower_index, KE::lower_bound(exespace(), view, value) - first);
+  EXPECT_EQ(gold_lower_index,
+            KE::lower_bound("label", exespace(), view, value) - first);
+  EXPECT_EQ(gold_lower_index,
+            KE::lower_bound(exespace(), first, last, value, comp_t()) - first);
+  EXPECT_EQ(gold_lower_index,
+            KE::lower_bound(exespace(), view, value, comp_t()) - first);
+
+  // upper_bound
+  EXPECT_EQ(gold_upper_index, KE::upper_bound(exespace(), first, last, value) -
+                                  first);
+  EXPECT_EQ(gold_upper_index,
+            KE::upper_bound("label", exespace(), first, last, value) - first);
+  EXPECT_EQ(gold_upper_index, KE::upper_bound(exespace(), view, value) - first);
+  EXPECT_EQ(gold_upper_index,
+            KE::upper_bound("label", exespace(), view, value) - first);
+  EXPECT_EQ(gold_upper_index,
+            KE::upper_bound(exespace(), first, last, value, comp_t()) - first);
+  EXPECT_EQ(gold_upper_index,
+            KE::upper_bound(exespace(), view, value, comp_t()) - first);
+
+  // equal_range
+  {
+    auto r = KE::equal_range(exespace(), first, last, value);
+    EXPECT_EQ(gold_lower_index, r.first - first);
+    EXPECT_EQ(gold_upper_index, r.second - first);
+  }
+  {
+    auto r = KE::equal_range("label", exespace(), view, value, comp_t());
+    EXPECT_EQ(gold_lower_index, r.first - first);
+    EXPECT_EQ(gold_upper_index, r.second - first);
+  }
+}
+
+template <class Tag, class ValueType, class InfoType>
+void run_single_scenario(const InfoType& scenario_info) {
+  const std::size_t view_ext = std::get<1>(scenario_info);
+  const int max_value        = int(view_ext / 4) + 1;
+
+  auto view = create_view<ValueType>(Tag{}, view_ext, "binary_search");
+  fill_view_sorted(view, max_value);
+
+  auto view_h = create_host_space_copy(view);
+  std::vector<ValueType> gold(view_ext);
+  for (std::size_t i = 0; i < view_ext; ++i) gold[i] = view_h(i);
+
+  for (ValueType value : {ValueType(-max_value - 1), ValueType(-max_value),
+                          ValueType(0), ValueType(max_value / 2),
+                          ValueType(max_value), ValueType(max_value + 1)}) {
+    test_single_searches(view, gold, value);
+  }
+
+  // batched searches, with needles on both sides of the haystack
+  const std::size_t num_needles = 5000;
+  Kokkos::View<ValueType*> needles("needles", num_needles);
+  Kokkos::View<std::ptrdiff_t*> indices("indices", num_needles);
+  auto needles_h = create_mirror_view(Kokkos::HostSpace(), needles);
+  std::mt19937 gen(num_needles);
+  std::uniform_int_distribution<int> dist(-max_value - 2, max_value + 2);
+  for (std::size_t i = 0; i < num_needles; ++i) {
+    needles_h(i) = static_cast<ValueType>(dist(gen));
+  }
+  Kokkos::deep_copy(needles, needles_h);
+
+  auto verify = [&](bool upper) {
+    auto indices_h = create_host_space_copy(indices);
+    for (std::size_t i = 0; i < num_needles; ++i) {
+      const auto gold_it =
+          upper ? std::upper_bound(gold.begin(), gold.end(), needles_h(i))
+                : std::lower_bound(gold.begin(), gold.end(), needles_h(i));
+      EXPECT_EQ(gold_it - gold.begin(), indices_h(i));
+    }
+  };
+
+  KE::batched_lower_bound(exespace(), view, needles, indices);
+  verify(false);
+  KE::batched_lower_bound("label", exespace(), view, needles, indices,
+                          CustomLessThanComparator<ValueType>());
+  verify(false);
+  KE::batched_lower_bound(exespace(), view, needles, indices,
+                          KE::InterpolationSearch{});
+  verify(false);
+  KE::batched_upper_bound(exespace(), view, needles, indices);
+  verify(true);
+  KE::batched_upper_bound("label", exespace(), view, needles, indices,
+                          CustomLessThanComparator<ValueType>());
+  verify(true);
+  KE::batched_upper_bound(exespace(), view, needles, indices,
+                          KE::InterpolationSearch{});
+  verify(true);
+}
+
+template <class Tag, class ValueType>
+void run_binary_search_all_scenarios() {
+  const std::map<std::string, std::size_t> scenarios = {
+      {"empty", 0},     {"one-element", 1}, {"two-elements", 2},
+      {"small", 13},    {"medium", 1003},   {"large", 101513}};
+
+  std::cout << "binary_search: " << view_tag_to_string(Tag{})
+            << ", all overloads \n";
+
+  for (const auto& it : scenarios) {
+    run_single_scenario<Tag, ValueType>(it);
+  }
+}
+
+TEST(std_algorithms_binary_search_ops, test) {
+  run_binary_search_all_scenarios<DynamicTag, int>();
+  run_binary_search_all_scenarios<StridedTwoTag, int>();
+  run_binary_search_all_scenarios<StridedThreeTag, double>();
+}
+
+}  // namespace BinarySearch
+}  // namespace stdalgos
+}  // namespace Test
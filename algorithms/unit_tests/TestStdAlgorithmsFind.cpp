@@ -186,6 +186,51 @@ TEST(std_algorithms_find_test, test) {
   run_all_scenarios<StridedThreeTag, unsigned>();
 }
 
+template <class ValueType>
+struct IsGreaterOrEqualFunctor {
+  ValueType m_val;
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType val) const { return val >= m_val; }
+};
+
+// find goes through chunks whose size doubles every time, check matches on
+// both sides of the chunk boundaries, in the last chunk, and no match at all
+// in a range spanning several chunks
+template <class Tag, class ValueType>
+void run_chunked_scenarios() {
+  const std::size_t chunk = KE::Impl::first_loc_first_chunk_size;
+  const std::size_t ext   = 20 * chunk + 11;
+
+  auto view = create_view<ValueType>(Tag{}, ext, "find_chunked");
+  Kokkos::View<ValueType*, Kokkos::HostSpace> expected("find_expected", ext);
+  fill_views_inc(view, expected);
+
+  const std::size_t positions[] = {0,         chunk - 1,     chunk,
+                                   3 * chunk, 7 * chunk - 1, 7 * chunk,
+                                   15 * chunk, 15 * chunk + 1, ext - 1};
+  for (const std::size_t pos : positions) {
+    const auto find_value = static_cast<ValueType>(pos);
+    EXPECT_EQ(KE::begin(view) + pos,
+              KE::find(exespace(), KE::begin(view), KE::end(view), find_value));
+    // every element from pos on matches, the first one must be returned
+    EXPECT_EQ(KE::begin(view) + pos,
+              KE::find_if(exespace(), view,
+                          IsGreaterOrEqualFunctor<ValueType>{find_value}));
+  }
+
+  const auto missing_value = static_cast<ValueType>(ext);
+  EXPECT_EQ(KE::end(view), KE::find(exespace(), view, missing_value));
+  EXPECT_EQ(KE::end(view),
+            KE::find_if(exespace(), KE::begin(view), KE::end(view),
+                        IsGreaterOrEqualFunctor<ValueType>{missing_value}));
+}
+
+TEST(std_algorithms_find_test, chunked) {
+  run_chunked_scenarios<DynamicTag, int>();
+  run_chunked_scenarios<StridedThreeTag, unsigned>();
+}
+
 }  // namespace Find
 }  // namespace stdalgos
 }  // namespace Test
@@ -0,0 +1,253 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_MergeAndSetOperations.hpp>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <utility>
+
+namespace Test {
+namespace stdalgos {
+namespace MergeAndSetOps {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct CustomGreaterThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+// fills [0, ext1) and [ext1, ext) of dest_view with two runs sorted
+// according to comp, with many duplicates within and across the runs
+template <class ViewType, class Comparator>
+std::vector<typename ViewType::value_type> fill_view_sorted_runs(
+    ViewType dest_view, std::size_t ext1, unsigned seed, Comparator comp) {
+  using value_type = typename ViewType::value_type;
+  using exe_space  = typename ViewType::execution_space;
+
+  const std::size_t ext = dest_view.extent(0);
+  using aux_view_t      = Kokkos::View<value_type*, exe_space>;
+  aux_view_t aux_view("aux_view", ext);
+  auto v_h = create_mirror_view(Kokkos::HostSpace(), aux_view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, int(ext / 3) + 1);
+  for (std::size_t i = 0; i < ext; ++i) {
+    v_h(i) = static_cast<value_type>(dist(gen));
+  }
+  std::sort(v_h.data(), v_h.data() + ext1, comp);
+  std::sort(v_h.data() + ext1, v_h.data() + ext, comp);
+
+  Kokkos::deep_copy(aux_view, v_h);
+  CopyFunctor<aux_view_t, ViewType> F1(aux_view, dest_view);
+  Kokkos::parallel_for("copy", dest_view.extent(0), F1);
+  Kokkos::fence();
+
+  return std::vector<value_type>(v_h.data(), v_h.data() + ext);
+}
+
+template <class ViewType, class ValueType>
+void verify_data(ViewType view, const std::vector<ValueType>& gold,
+                 std::size_t returned_size) {
+  ASSERT_EQ(gold.size(), returned_size);
+  auto view_h = create_host_space_copy(view);
+  for (std::size_t i = 0; i < gold.size(); ++i) {
+    EXPECT_EQ(gold[i], view_h(i));
+  }
+}
+
+template <class Tag, class ValueType, class Comparator, class StdComparator>
+void run_single_scenario(std::size_t ext1, std::size_t ext2,
+                         Comparator comp, StdComparator std_comp) {
+  auto view1 = create_view<ValueType>(Tag{}, ext1, "merge_view1");
+  auto view2 = create_view<ValueType>(Tag{}, ext2, "merge_view2");
+  auto dest  = create_view<ValueType>(Tag{}, ext1 + ext2, "merge_dest");
+
+  const auto v1 = fill_view_sorted_runs(view1, ext1, ext1 + 1, std_comp);
+  const auto v2 = fill_view_sorted_runs(view2, ext2, ext2 + 7, std_comp);
+  std::vector<ValueType> gold;
+
+  // merge
+  gold.clear();
+  std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
+             std::back_inserter(gold), std_comp);
+  {
+    auto r = KE::merge(exespace(), KE::cbegin(view1), KE::cend(view1),
+                       KE::cbegin(view2), KE::cend(view2), KE::begin(dest),
+                       comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+  {
+    auto r = KE::merge("label", exespace(), view1, view2, dest, comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+
+  // set_union
+  gold.clear();
+  std::set_union(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                 std::back_inserter(gold), std_comp);
+  {
+    auto r = KE::set_union(exespace(), KE::cbegin(view1), KE::cend(view1),
+                           KE::cbegin(view2), KE::cend(view2),
+                           KE::begin(dest), comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+  {
+    auto r = KE::set_union("label", exespace(), view1, view2, dest, comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+
+  // set_intersection
+  gold.clear();
+  std::set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                        std::back_inserter(gold), std_comp);
+  {
+    auto r = KE::set_intersection(exespace(), KE::cbegin(view1),
+                                  KE::cend(view1), KE::cbegin(view2),
+                                  KE::cend(view2), KE::begin(dest), comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+  {
+    auto r =
+        KE::set_intersection("label", exespace(), view1, view2, dest, comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+
+  // set_difference
+  gold.clear();
+  std::set_difference(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                      std::back_inserter(gold), std_comp);
+  {
+    auto r = KE::set_difference(exespace(), KE::cbegin(view1),
+                                KE::cend(view1), KE::cbegin(view2),
+                                KE::cend(view2), KE::begin(dest), comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+  {
+    auto r = KE::set_difference("label", exespace(), view1, view2, dest, comp);
+    verify_data(dest, gold, r - KE::begin(dest));
+  }
+
+  // inplace_merge
+  auto runs = fill_view_sorted_runs(dest, ext1, ext1 + ext2, std_comp);
+  gold      = runs;
+  std::inplace_merge(gold.begin(), gold.begin() + ext1, gold.end(), std_comp);
+  KE::inplace_merge("label", exespace(), dest, ext1, comp);
+  verify_data(dest, gold, gold.size());
+}
+
+template <class Tag, class ValueType>
+void run_merge_and_set_ops_all_scenarios() {
+  const std::vector<std::pair<std::size_t, std::size_t>> scenarios = {
+      {0, 0},   {0, 5},    {5, 0},       {1, 1},        {13, 4},
+      {4, 13},  {1003, 1}, {1003, 1003}, {51513, 50000}};
+
+  std::cout << "merge_and_set_ops: " << view_tag_to_string(Tag{})
+            << ", all overloads \n";
+
+  for (const auto& it : scenarios) {
+    run_single_scenario<Tag, ValueType>(
+        it.first, it.second, CustomGreaterThanComparator<ValueType>(),
+        std::greater<ValueType>());
+  }
+
+  // default comparator
+  for (const auto& it : scenarios) {
+    auto view1 = create_view<ValueType>(Tag{}, it.first, "merge_view1");
+    auto view2 = create_view<ValueType>(Tag{}, it.second, "merge_view2");
+    auto dest  = create_view<ValueType>(Tag{}, it.first + it.second, "dest");
+    const auto v1 =
+        fill_view_sorted_runs(view1, it.first, 3, std::less<ValueType>());
+    const auto v2 =
+        fill_view_sorted_runs(view2, it.second, 5, std::less<ValueType>());
+
+    std::vector<ValueType> gold;
+    std::merge(v1.begin(), v1.end(), v2.begin(), v2.end(),
+               std::back_inserter(gold));
+    auto r = KE::merge(exespace(), view1, view2, dest);
+    verify_data(dest, gold, r - KE::begin(dest));
+
+    gold.clear();
+    std::set_union(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                   std::back_inserter(gold));
+    r = KE::set_union(exespace(), view1, view2, dest);
+    verify_data(dest, gold, r - KE::begin(dest));
+
+    gold.clear();
+    std::set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                          std::back_inserter(gold));
+    r = KE::set_intersection(exespace(), view1, view2, dest);
+    verify_data(dest, gold, r - KE::begin(dest));
+
+    gold.clear();
+    std::set_difference(v1.begin(), v1.end(), v2.begin(), v2.end(),
+                        std::back_inserter(gold));
+    r = KE::set_difference(exespace(), view1, view2, dest);
+    verify_data(dest, gold, r - KE::begin(dest));
+
+    const auto runs = fill_view_sorted_runs(dest, it.first, 11,
+                                            std::less<ValueType>());
+    gold            = runs;
+    std::inplace_merge(gold.begin(), gold.begin() + it.first, gold.end());
+    KE::inplace_merge(exespace(), KE::begin(dest),
+                      KE::begin(dest) + it.first, KE::end(dest));
+    verify_data(dest, gold, gold.size());
+  }
+}
+
+TEST(std_algorithms_merge_and_set_ops, test) {
+  run_merge_and_set_ops_all_scenarios<DynamicTag, int>();
+  run_merge_and_set_ops_all_scenarios<StridedTwoTag, int>();
+  run_merge_and_set_ops_all_scenarios<StridedThreeTag, double>();
+}
+
+}  // namespace MergeAndSetOps
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,223 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_SortingOperations.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+
+namespace Test {
+namespace stdalgos {
+namespace NthElement {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+struct CustomGreaterThanComparator {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType& a, const ValueType& b) const {
+    return a > b;
+  }
+};
+
+// a narrow range of values gives many duplicates of the pivot
+template <class ViewType>
+void fill_view(ViewType dest_view, int max_value) {
+  using value_type = typename ViewType::value_type;
+  using exe_space  = typename ViewType::execution_space;
+
+  const std::size_t ext = dest_view.extent(0);
+  using aux_view_t      = Kokkos::View<value_type*, exe_space>;
+  aux_view_t aux_view("aux_view", ext);
+  auto v_h = create_mirror_view(Kokkos::HostSpace(), aux_view);
+
+  std::mt19937 gen(ext);
+  std::uniform_int_distribution<int> dist(-max_value, max_value);
+  for (std::size_t i = 0; i < ext; ++i) {
+    v_h(i) = static_cast<value_type>(dist(gen));
+  }
+
+  Kokkos::deep_copy(aux_view, v_h);
+  CopyFunctor<aux_view_t, ViewType> F1(aux_view, dest_view);
+  Kokkos::parallel_for("copy", dest_view.extent(0), F1);
+}
+
+template <class ViewType, class ComparatorType>
+void verify_nth_element(ViewType original, ViewType result, std::size_t nth,
+                        ComparatorType comp) {
+  auto original_h       = create_host_space_copy(original);
+  auto result_h         = create_host_space_copy(result);
+  const std::size_t ext = original_h.extent(0);
+  if (nth >= ext) return;
+
+  std::vector<typename ViewType::value_type> gold(ext);
+  for (std::size_t i = 0; i < ext; ++i) gold[i] = original_h(i);
+  std::sort(gold.begin(), gold.end(), comp);
+
+  EXPECT_EQ(gold[nth], result_h(nth));
+  for (std::size_t i = 0; i < nth; ++i) {
+    EXPECT_FALSE(comp(result_h(nth), result_h(i)));
+  }
+  for (std::size_t i = nth + 1; i < ext; ++i) {
+    EXPECT_FALSE(comp(result_h(i), result_h(nth)));
+  }
+
+  // same elements as before
+  std::vector<typename ViewType::value_type> got(ext);
+  for (std::size_t i = 0; i < ext; ++i) got[i] = result_h(i);
+  std::sort(got.begin(), got.end(), comp);
+  EXPECT_TRUE(gold == got);
+}
+
+template <class ViewType, class ComparatorType>
+void verify_partial_sort(ViewType original, ViewType result,
+                         std::size_t middle, ComparatorType comp) {
+  auto original_h       = create_host_space_copy(original);
+  auto result_h         = create_host_space_copy(result);
+  const std::size_t ext = original_h.extent(0);
+
+  std::vector<typename ViewType::value_type> gold(ext);
+  for (std::size_t i = 0; i < ext; ++i) gold[i] = original_h(i);
+  std::sort(gold.begin(), gold.end(), comp);
+
+  for (std::size_t i = 0; i < middle; ++i) {
+    EXPECT_EQ(gold[i], result_h(i));
+  }
+  std::vector<typename ViewType::value_type> rest;
+  for (std::size_t i = middle; i < ext; ++i) rest.push_back(result_h(i));
+  std::sort(rest.begin(), rest.end(), comp);
+  EXPECT_TRUE(std::equal(rest.begin(), rest.end(), gold.begin() + middle));
+}
+
+template <class Tag, class ValueType>
+void run_single_scenario(std::size_t view_ext, int max_value) {
+  auto original =
+      create_view<ValueType>(Tag{}, view_ext, "nth_element_original");
+  fill_view(original, max_value);
+
+  auto view = create_view<ValueType>(Tag{}, view_ext, "nth_element");
+  using less_t = CustomLessThanComparator<ValueType, ValueType>;
+  CopyFunctor<decltype(original), decltype(view)> F1(original, view);
+
+  for (std::size_t nth : {std::size_t(0), view_ext / 3, view_ext / 2,
+                          view_ext > 0 ? view_ext - 1 : 0, view_ext}) {
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::nth_element(exespace(), KE::begin(view), KE::begin(view) + nth,
+                      KE::end(view));
+      verify_nth_element(original, view, nth, less_t());
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::nth_element("label", exespace(), view, nth);
+      verify_nth_element(original, view, nth, less_t());
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::partial_sort(exespace(), KE::begin(view), KE::begin(view) + nth,
+                       KE::end(view));
+      verify_partial_sort(original, view, nth, less_t());
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::partial_sort("label", exespace(), view, nth);
+      verify_partial_sort(original, view, nth, less_t());
+    }
+
+#if not defined KOKKOS_ENABLE_OPENMPTARGET
+    CustomGreaterThanComparator<ValueType> comp;
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::nth_element("label", exespace(), KE::begin(view),
+                      KE::begin(view) + nth, KE::end(view), comp);
+      verify_nth_element(original, view, nth, comp);
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::nth_element(exespace(), view, nth, comp);
+      verify_nth_element(original, view, nth, comp);
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::partial_sort("label", exespace(), KE::begin(view),
+                       KE::begin(view) + nth, KE::end(view), comp);
+      verify_partial_sort(original, view, nth, comp);
+    }
+    {
+      Kokkos::parallel_for("copy", view_ext, F1);
+      KE::partial_sort(exespace(), view, nth, comp);
+      verify_partial_sort(original, view, nth, comp);
+    }
+#endif
+  }
+
+  Kokkos::fence();
+}
+
+template <class Tag, class ValueType>
+void run_nth_element_all_scenarios() {
+  const std::map<std::string, std::size_t> scenarios = {
+      {"empty", 0},     {"one-element", 1}, {"two-elements", 2},
+      {"small", 13},    {"medium", 1003},   {"large", 101513}};
+
+  std::cout << "nth_element, partial_sort: " << view_tag_to_string(Tag{})
+            << ", all overloads \n";
+
+  for (const auto& it : scenarios) {
+    run_single_scenario<Tag, ValueType>(it.second, 500);
+    run_single_scenario<Tag, ValueType>(it.second, 5);
+  }
+}
+
+TEST(std_algorithms_sorting_ops_test, nth_element_and_partial_sort) {
+  run_nth_element_all_scenarios<DynamicTag, double>();
+  run_nth_element_all_scenarios<StridedTwoTag, double>();
+  run_nth_element_all_scenarios<StridedThreeTag, int>();
+}
+
+}  // namespace NthElement
+}  // namespace stdalgos
+}  // namespace Test
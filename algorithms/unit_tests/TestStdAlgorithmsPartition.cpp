@@ -0,0 +1,177 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_PartitioningOperations.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+
+namespace Test {
+namespace stdalgos {
+namespace Partition {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ViewType>
+void fill_view(ViewType dest_view) {
+  using value_type = typename ViewType::value_type;
+  using exe_space  = typename ViewType::execution_space;
+
+  const std::size_t ext = dest_view.extent(0);
+  using aux_view_t      = Kokkos::View<value_type*, exe_space>;
+  aux_view_t aux_view("aux_view", ext);
+  auto v_h = create_mirror_view(Kokkos::HostSpace(), aux_view);
+
+  std::mt19937 gen(ext);
+  std::uniform_int_distribution<int> dist(-500, 500);
+  for (std::size_t i = 0; i < ext; ++i) {
+    v_h(i) = static_cast<value_type>(dist(gen));
+  }
+
+  Kokkos::deep_copy(aux_view, v_h);
+  CopyFunctor<aux_view_t, ViewType> F1(aux_view, dest_view);
+  Kokkos::parallel_for("copy", dest_view.extent(0), F1);
+}
+
+// both partition and stable_partition must keep the relative order
+// since they share the scan-based implementation
+template <class ViewType, class PredicateType>
+void verify_data(ViewType original, ViewType partitioned,
+                 std::size_t returned_index, PredicateType pred) {
+  auto original_h    = create_host_space_copy(original);
+  auto partitioned_h = create_host_space_copy(partitioned);
+
+  std::vector<typename ViewType::value_type> gold(original_h.extent(0));
+  for (std::size_t i = 0; i < gold.size(); ++i) gold[i] = original_h(i);
+  const auto gold_point = std::stable_partition(gold.begin(), gold.end(), pred);
+
+  EXPECT_EQ(std::size_t(gold_point - gold.begin()), returned_index);
+  for (std::size_t i = 0; i < gold.size(); ++i) {
+    EXPECT_EQ(gold[i], partitioned_h(i));
+  }
+}
+
+template <class Tag, class ValueType, class InfoType>
+void run_single_scenario(const InfoType& scenario_info) {
+  const std::size_t view_ext = std::get<1>(scenario_info);
+
+  auto original = create_view<ValueType>(Tag{}, view_ext, "partition_original");
+  fill_view(original);
+
+  auto view = create_view<ValueType>(Tag{}, view_ext, "partition");
+  IsEvenFunctor<ValueType> pred;
+  CopyFunctor<decltype(original), decltype(view)> F1(original, view);
+
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::partition(exespace(), KE::begin(view), KE::end(view), pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::partition("label", exespace(), KE::begin(view),
+                           KE::end(view), pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::partition(exespace(), view, pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::partition("label", exespace(), view, pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::stable_partition(exespace(), KE::begin(view), KE::end(view),
+                                  pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::stable_partition("label", exespace(), KE::begin(view),
+                                  KE::end(view), pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::stable_partition(exespace(), view, pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+  {
+    Kokkos::parallel_for("copy", view_ext, F1);
+    auto r = KE::stable_partition("label", exespace(), view, pred);
+    verify_data(original, view, r - KE::begin(view), pred);
+  }
+
+  Kokkos::fence();
+}
+
+template <class Tag, class ValueType>
+void run_partition_all_scenarios() {
+  const std::map<std::string, std::size_t> scenarios = {
+      {"empty", 0},     {"one-element", 1}, {"two-elements", 2},
+      {"small", 13},    {"medium", 1003},   {"large", 101513}};
+
+  std::cout << "partition: " << view_tag_to_string(Tag{})
+            << ", all overloads \n";
+
+  for (const auto& it : scenarios) {
+    run_single_scenario<Tag, ValueType>(it);
+  }
+}
+
+TEST(std_algorithms_partitioning_ops, partition) {
+  run_partition_all_scenarios<DynamicTag, int>();
+  run_partition_all_scenarios<StridedTwoTag, int>();
+  run_partition_all_scenarios<StridedThreeTag, int>();
+}
+
+}  // namespace Partition
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,216 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_RangeAdaptors.hpp>
+#include <std_algorithms/Kokkos_ModifyingSequenceOperations.hpp>
+#include <std_algorithms/Kokkos_NonModifyingSequenceOperations.hpp>
+#include <std_algorithms/Kokkos_Numeric.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace RangeAdaptors {
+
+namespace KE = Kokkos::Experimental;
+
+using data_view_t = Kokkos::View<int*, exespace>;
+
+struct IsPositive {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int v) const { return v > 0; }
+};
+
+struct IsEven {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int v) const { return v % 2 == 0; }
+};
+
+struct TimesTwoMinusOne {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int v) const { return 2 * v - 1; }
+};
+
+struct Multiply {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const Kokkos::pair<int, int>& p) const {
+    return p.first * p.second;
+  }
+};
+
+data_view_t create_random_data(std::size_t num_elements, unsigned seed) {
+  data_view_t view("data", num_elements);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-50, 50);
+  for (std::size_t i = 0; i < num_elements; ++i) {
+    view_h(i) = dist(gen);
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+std::vector<int> to_vector(const data_view_t& view) {
+  auto view_h = create_host_space_copy(view);
+  std::vector<int> result(view_h.extent(0));
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = view_h(i);
+  }
+  return result;
+}
+
+const std::vector<std::size_t> sizes = {0, 1, 2, 13, 1103, 101513};
+
+TEST(std_algorithms_range_adaptors, transform_replace_if_not_reduce) {
+  for (const auto num_elements : sizes) {
+    auto view            = create_random_data(num_elements, 1234);
+    const auto gold_data = to_vector(view);
+
+    int gold = 0;
+    for (const auto v : gold_data) {
+      const int tv = TimesTwoMinusOne()(v);
+      gold += IsPositive()(tv) ? tv : 0;
+    }
+
+    auto r = KE::views::replace_if_not(
+        KE::views::transform(view, TimesTwoMinusOne()), IsPositive(), 0);
+    EXPECT_EQ(r.size(), static_cast<std::ptrdiff_t>(num_elements));
+    EXPECT_EQ(KE::reduce(exespace(), KE::begin(r), KE::end(r)), gold);
+  }
+}
+
+TEST(std_algorithms_range_adaptors, transform_copy_if) {
+  for (const auto num_elements : sizes) {
+    auto view            = create_random_data(num_elements, 5678);
+    const auto gold_data = to_vector(view);
+
+    std::vector<int> gold;
+    for (const auto v : gold_data) {
+      const int tv = TimesTwoMinusOne()(v);
+      if (IsPositive()(tv)) {
+        gold.push_back(tv);
+      }
+    }
+
+    data_view_t dest("dest", num_elements);
+    auto r       = KE::views::transform(view, TimesTwoMinusOne());
+    auto dest_it = KE::copy_if(exespace(), KE::begin(r), KE::end(r),
+                               KE::begin(dest), IsPositive());
+    ASSERT_EQ(dest_it - KE::begin(dest),
+              static_cast<std::ptrdiff_t>(gold.size()));
+
+    const auto result = to_vector(dest);
+    for (std::size_t i = 0; i < gold.size(); ++i) {
+      EXPECT_EQ(result[i], gold[i]);
+    }
+  }
+}
+
+TEST(std_algorithms_range_adaptors, zip_dot_product) {
+  for (const auto num_elements : sizes) {
+    auto view1       = create_random_data(num_elements, 11);
+    auto view2       = create_random_data(num_elements + 7, 13);
+    const auto gold1 = to_vector(view1);
+    const auto gold2 = to_vector(view2);
+
+    // the zipped range stops at the end of the shortest one
+    const auto gold =
+        std::inner_product(gold1.cbegin(), gold1.cend(), gold2.cbegin(), 0);
+
+    auto r = KE::views::transform(KE::views::zip(view1, view2), Multiply());
+    EXPECT_EQ(r.size(), static_cast<std::ptrdiff_t>(num_elements));
+    EXPECT_EQ(KE::reduce(exespace(), KE::begin(r), KE::end(r)), gold);
+  }
+}
+
+TEST(std_algorithms_range_adaptors, iota_count_if) {
+  for (const auto num_elements : sizes) {
+    const int n = static_cast<int>(num_elements);
+    auto r      = KE::views::iota(-3, n);
+    EXPECT_EQ(r.size(), static_cast<std::ptrdiff_t>(n + 3));
+    EXPECT_EQ(KE::count_if(exespace(), KE::begin(r), KE::end(r), IsEven()),
+              (n + 3) / 2);
+
+    // sum of -3, ..., n-1
+    const int gold = (n - 1) * n / 2 - 6;
+    EXPECT_EQ(KE::reduce(exespace(), KE::begin(r), KE::end(r)), gold);
+  }
+}
+
+TEST(std_algorithms_range_adaptors, stride) {
+  for (const auto num_elements : sizes) {
+    for (const std::ptrdiff_t stride : {1, 3, 16}) {
+      auto view            = create_random_data(num_elements, 91);
+      const auto gold_data = to_vector(view);
+
+      auto r = KE::views::stride(view, stride);
+      const auto num_strided =
+          (static_cast<std::ptrdiff_t>(num_elements) + stride - 1) / stride;
+      ASSERT_EQ(r.size(), num_strided);
+
+      // read
+      data_view_t dest("dest", num_strided);
+      KE::copy(exespace(), KE::begin(r), KE::end(r), KE::begin(dest));
+      const auto result = to_vector(dest);
+      for (std::ptrdiff_t i = 0; i < num_strided; ++i) {
+        EXPECT_EQ(result[i], gold_data[i * stride]);
+      }
+
+      // write
+      KE::fill(exespace(), KE::begin(r), KE::end(r), 1000);
+      const auto filled = to_vector(view);
+      for (std::size_t i = 0; i < num_elements; ++i) {
+        EXPECT_EQ(filled[i], (i % stride == 0) ? 1000 : gold_data[i]);
+      }
+    }
+  }
+}
+
+}  // namespace RangeAdaptors
+}  // namespace stdalgos
+}  // namespace Test
@@ -0,0 +1,182 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Numeric.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace ReduceByKey {
+
+namespace KE = Kokkos::Experimental;
+
+using data_view_t = Kokkos::View<int*, exespace>;
+
+struct MinFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const int& a, const int& b) const { return b < a ? b : a; }
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const volatile int& a, const volatile int& b) const {
+    return b < a ? b : a;
+  }
+};
+
+struct SameDecade {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int a, int b) const { return a / 10 == b / 10; }
+};
+
+// keys made of runs of random length, including a few long ones
+data_view_t create_keys(std::size_t num_elements, unsigned seed) {
+  data_view_t view("keys", num_elements);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> run_dist(1, 20);
+  std::uniform_int_distribution<int> long_run_dist(0, 50);
+  std::uniform_int_distribution<int> step_dist(1, 7);
+  std::size_t i = 0;
+  int key       = 0;
+  while (i < num_elements) {
+    const int run = long_run_dist(gen) == 0 ? 5000 : run_dist(gen);
+    for (int j = 0; j < run && i < num_elements; ++j, ++i) {
+      view_h(i) = key;
+    }
+    key += step_dist(gen);
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+data_view_t create_values(std::size_t num_elements, unsigned seed) {
+  data_view_t view("values", num_elements);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-100, 100);
+  for (std::size_t i = 0; i < num_elements; ++i) {
+    view_h(i) = dist(gen);
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+std::vector<int> to_vector(const data_view_t& view, std::size_t count) {
+  auto view_h = create_host_space_copy(view);
+  std::vector<int> result(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result[i] = view_h(i);
+  }
+  return result;
+}
+
+template <class KeyEqualType, class BinaryOpType>
+void gold_reduce_by_key(const std::vector<int>& keys,
+                        const std::vector<int>& values,
+                        KeyEqualType key_equal, BinaryOpType binary_op,
+                        std::vector<int>& keys_out,
+                        std::vector<int>& values_out) {
+  keys_out.clear();
+  values_out.clear();
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    // the output key is the first one of the segment
+    if (i == 0 || !key_equal(keys[i - 1], keys[i])) {
+      keys_out.push_back(keys[i]);
+      values_out.push_back(values[i]);
+    } else {
+      values_out.back() = binary_op(values_out.back(), values[i]);
+    }
+  }
+}
+
+template <class... Args>
+void verify(const data_view_t& keys, const data_view_t& values,
+            const data_view_t& keys_dest, const data_view_t& values_dest,
+            std::size_t count, Args... args) {
+  const auto num_elements = keys.extent(0);
+  std::vector<int> gold_keys, gold_values;
+  gold_reduce_by_key(to_vector(keys, num_elements),
+                     to_vector(values, num_elements), args..., gold_keys,
+                     gold_values);
+  ASSERT_EQ(count, gold_keys.size());
+  EXPECT_EQ(to_vector(keys_dest, count), gold_keys);
+  EXPECT_EQ(to_vector(values_dest, count), gold_values);
+}
+
+const std::vector<std::size_t> sizes = {0, 1, 2, 13, 1103, 101513};
+
+TEST(std_algorithms_numerics_ops_test, reduce_by_key) {
+  const auto equal = [](int a, int b) { return a == b; };
+  const auto plus  = [](int a, int b) { return a + b; };
+
+  for (const auto num_elements : sizes) {
+    auto keys   = create_keys(num_elements, 321);
+    auto values = create_values(num_elements, 654);
+    data_view_t keys_dest("keys_dest", num_elements);
+    data_view_t values_dest("values_dest", num_elements);
+
+    // default ops, iterator api
+    auto res = KE::reduce_by_key(exespace(), KE::cbegin(keys), KE::cend(keys),
+                                 KE::cbegin(values), KE::begin(keys_dest),
+                                 KE::begin(values_dest));
+    const auto count = KE::distance(KE::begin(keys_dest), res.first);
+    EXPECT_EQ(count, KE::distance(KE::begin(values_dest), res.second));
+    verify(keys, values, keys_dest, values_dest, count, equal, plus);
+
+    // custom ops, view api
+    auto res2 = KE::reduce_by_key("label", exespace(), keys, values,
+                                  keys_dest, values_dest, SameDecade(),
+                                  MinFunctor());
+    const auto count2 = KE::distance(KE::begin(keys_dest), res2.first);
+    verify(keys, values, keys_dest, values_dest, count2, SameDecade(),
+           MinFunctor());
+  }
+}
+
+}  // namespace ReduceByKey
+}  // namespace stdalgos
+}  // namespace Test
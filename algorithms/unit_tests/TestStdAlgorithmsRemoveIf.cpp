@@ -226,6 +226,84 @@ TEST(std_algorithms_mod_seq_ops, remove_if) {
   run_all_scenarios<StridedThreeTag, int>();
 }
 
+// removes the values in [begin, end) that are multiples of step
+template <class ValueType>
+struct RemoveMultiplesInRangeFunctor {
+  ValueType m_begin;
+  ValueType m_end;
+  ValueType m_step;
+
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const ValueType val) const {
+    return m_begin <= val && val < m_end && val % m_step == 0;
+  }
+};
+
+// remove_if compacts in place through windows of about 1/32 of the range,
+// use a range spanning many of them so that both the buffered and the
+// direct moves are exercised, and one fitting in a single window
+template <class Tag, class ValueType>
+void run_compaction_scenarios() {
+  using pred_type   = RemoveMultiplesInRangeFunctor<ValueType>;
+  const ValueType n = 100003;
+  const auto window = KE::Impl::compact_window_size(n);
+
+  const std::map<std::string, pred_type> scenarios = {
+      {"keep-all", {0, n, n + 1}},
+      {"remove-all", {0, n, 1}},
+      {"remove-every-other", {0, n, 2}},
+      {"remove-every-seventh", {0, n, 7}},
+      {"remove-tail", {n / 2 + 3, n, 1}},
+      {"remove-head", {0, 3 * window + 5, 1}},
+      {"remove-middle", {window, 2 * n / 3, 1}}};
+
+  for (const auto& it : scenarios) {
+    for (const ValueType ext : {ValueType(0), ValueType(1500), n}) {
+      auto view = create_view<ValueType>(Tag{}, ext, "remove_if_view");
+      Kokkos::parallel_for(ext, AssignIndexFunctor<decltype(view)>(view));
+      auto data_h = create_host_space_copy(view);
+      auto rit =
+          KE::remove_if(exespace(), KE::begin(view), KE::end(view), it.second);
+      verify_data(data_h, view, rit, it.second);
+    }
+  }
+}
+
+TEST(std_algorithms_mod_seq_ops, remove_if_compaction) {
+  run_compaction_scenarios<DynamicTag, int>();
+  run_compaction_scenarios<StridedThreeTag, int>();
+}
+
+// the largest allocation made while the tools callback is set
+uint64_t largest_allocation = 0;
+
+void record_allocation(const Kokkos_Profiling_SpaceHandle, const char*,
+                       const void*, const uint64_t size) {
+  largest_allocation = (size > largest_allocation) ? size : largest_allocation;
+}
+
+// remove_if must not allocate a temporary as large as the range,
+// only a buffer for one window
+TEST(std_algorithms_mod_seq_ops, remove_if_compaction_memory) {
+  using value_type   = int;
+  const int n        = 1000003;
+  const auto window  = KE::Impl::compact_window_size(n);
+  const auto current = Kokkos::Tools::Experimental::get_callbacks();
+
+  auto view = create_view<value_type>(DynamicTag{}, n, "remove_if_view");
+  Kokkos::parallel_for(n, AssignIndexFunctor<decltype(view)>(view));
+
+  largest_allocation = 0;
+  Kokkos::Tools::Experimental::set_allocate_data_callback(&record_allocation);
+  auto rit = KE::remove_if(exespace(), KE::begin(view), KE::end(view),
+                           RemoveMultiplesInRangeFunctor<value_type>{0, n, 2});
+  Kokkos::Tools::Experimental::set_callbacks(current);
+
+  EXPECT_EQ(rit - KE::begin(view), n / 2);
+  EXPECT_GE(largest_allocation, window * sizeof(value_type));
+  EXPECT_LT(largest_allocation, n * sizeof(value_type) / 16);
+}
+
 }  // namespace RemoveIf
 }  // namespace stdalgos
 }  // namespace Test
@@ -0,0 +1,212 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_Numeric.hpp>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace ScanByKey {
+
+namespace KE = Kokkos::Experimental;
+
+using data_view_t = Kokkos::View<int*, exespace>;
+
+struct MaxFunctor {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const int& a, const int& b) const { return a < b ? b : a; }
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const volatile int& a, const volatile int& b) const {
+    return a < b ? b : a;
+  }
+};
+
+struct SameDecade {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int a, int b) const { return a / 10 == b / 10; }
+};
+
+// keys made of runs of random length, including a few long ones
+data_view_t create_keys(std::size_t num_elements, unsigned seed) {
+  data_view_t view("keys", num_elements);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> run_dist(1, 20);
+  std::uniform_int_distribution<int> long_run_dist(0, 50);
+  std::uniform_int_distribution<int> step_dist(1, 7);
+  std::size_t i = 0;
+  int key       = 0;
+  while (i < num_elements) {
+    const int run = long_run_dist(gen) == 0 ? 5000 : run_dist(gen);
+    for (int j = 0; j < run && i < num_elements; ++j, ++i) {
+      view_h(i) = key;
+    }
+    key += step_dist(gen);
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+data_view_t create_values(std::size_t num_elements, unsigned seed) {
+  data_view_t view("values", num_elements);
+  auto view_h = create_mirror_view(Kokkos::HostSpace(), view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-100, 100);
+  for (std::size_t i = 0; i < num_elements; ++i) {
+    view_h(i) = dist(gen);
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+std::vector<int> to_vector(const data_view_t& view) {
+  auto view_h = create_host_space_copy(view);
+  std::vector<int> result(view_h.extent(0));
+  for (std::size_t i = 0; i < result.size(); ++i) {
+    result[i] = view_h(i);
+  }
+  return result;
+}
+
+template <class KeyEqualType, class BinaryOpType>
+std::vector<int> gold_inclusive(const std::vector<int>& keys,
+                                const std::vector<int>& values,
+                                KeyEqualType key_equal,
+                                BinaryOpType binary_op) {
+  std::vector<int> result(keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || !key_equal(keys[i - 1], keys[i])) {
+      result[i] = values[i];
+    } else {
+      result[i] = binary_op(result[i - 1], values[i]);
+    }
+  }
+  return result;
+}
+
+template <class KeyEqualType, class BinaryOpType>
+std::vector<int> gold_exclusive(const std::vector<int>& keys,
+                                const std::vector<int>& values, int init,
+                                KeyEqualType key_equal,
+                                BinaryOpType binary_op) {
+  std::vector<int> result(keys.size());
+  int running = init;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || !key_equal(keys[i - 1], keys[i])) {
+      running = init;
+    }
+    result[i] = running;
+    running   = binary_op(running, values[i]);
+  }
+  return result;
+}
+
+const std::vector<std::size_t> sizes = {0, 1, 2, 13, 1103, 101513};
+
+TEST(std_algorithms_numerics_ops_test, inclusive_scan_by_key) {
+  const auto equal = [](int a, int b) { return a == b; };
+  const auto plus  = [](int a, int b) { return a + b; };
+
+  for (const auto num_elements : sizes) {
+    auto keys        = create_keys(num_elements, 123);
+    auto values      = create_values(num_elements, 456);
+    const auto keys_ = to_vector(keys);
+    const auto vals_ = to_vector(values);
+    data_view_t dest("dest", num_elements);
+
+    // default ops, iterator api
+    auto res = KE::inclusive_scan_by_key(exespace(), KE::cbegin(keys),
+                                         KE::cend(keys), KE::cbegin(values),
+                                         KE::begin(dest));
+    EXPECT_EQ(res, KE::end(dest));
+    EXPECT_EQ(to_vector(dest), gold_inclusive(keys_, vals_, equal, plus));
+
+    // custom ops, view api
+    KE::inclusive_scan_by_key("label", exespace(), keys, values, dest,
+                              SameDecade(), MaxFunctor());
+    EXPECT_EQ(to_vector(dest),
+              gold_inclusive(keys_, vals_, SameDecade(), MaxFunctor()));
+  }
+}
+
+TEST(std_algorithms_numerics_ops_test, exclusive_scan_by_key) {
+  const auto equal = [](int a, int b) { return a == b; };
+  const auto plus  = [](int a, int b) { return a + b; };
+
+  for (const auto num_elements : sizes) {
+    auto keys        = create_keys(num_elements, 789);
+    auto values      = create_values(num_elements, 1011);
+    const auto keys_ = to_vector(keys);
+    const auto vals_ = to_vector(values);
+    data_view_t dest("dest", num_elements);
+
+    // default ops, view api
+    KE::exclusive_scan_by_key(exespace(), keys, values, dest, 3);
+    EXPECT_EQ(to_vector(dest),
+              gold_exclusive(keys_, vals_, 3, equal, plus));
+
+    // custom ops, iterator api
+    auto res = KE::exclusive_scan_by_key(
+        "label", exespace(), KE::cbegin(keys), KE::cend(keys),
+        KE::cbegin(values), KE::begin(dest), -1000, SameDecade(),
+        MaxFunctor());
+    EXPECT_EQ(res, KE::end(dest));
+    EXPECT_EQ(to_vector(dest), gold_exclusive(keys_, vals_, -1000,
+                                              SameDecade(), MaxFunctor()));
+
+    // in place
+    KE::exclusive_scan_by_key(exespace(), keys, values, values, 0);
+    EXPECT_EQ(to_vector(values),
+              gold_exclusive(keys_, vals_, 0, equal, plus));
+  }
+}
+
+}  // namespace ScanByKey
+}  // namespace stdalgos
+}  // namespace Test
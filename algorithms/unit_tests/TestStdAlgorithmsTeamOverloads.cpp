@@ -0,0 +1,629 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <std_algorithms/Kokkos_BeginEnd.hpp>
+#include <std_algorithms/Kokkos_MinMaxElementOperations.hpp>
+#include <std_algorithms/Kokkos_ModifyingSequenceOperations.hpp>
+#include <std_algorithms/Kokkos_NonModifyingSequenceOperations.hpp>
+#include <std_algorithms/Kokkos_Numeric.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace Test {
+namespace stdalgos {
+namespace TeamOverloads {
+
+namespace KE = Kokkos::Experimental;
+
+using data_view_t   = Kokkos::View<int**, exespace>;
+using team_policy_t = Kokkos::TeamPolicy<exespace>;
+using member_t      = team_policy_t::member_type;
+
+struct IsPositive {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(int v) const { return v > 0; }
+};
+
+struct TimesTwo {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(int v) const { return 2 * v; }
+};
+
+struct MaxJoiner {
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const int& a, const int& b) const { return a > b ? a : b; }
+
+  KOKKOS_INLINE_FUNCTION
+  int operator()(const volatile int& a, const volatile int& b) const {
+    return a > b ? a : b;
+  }
+};
+
+// the entries are in [-5, 5] so that searches, counts and
+// adjacent matches hit something for all but the tiny rows
+data_view_t create_random_data(std::size_t num_rows, std::size_t num_cols,
+                               unsigned seed) {
+  data_view_t view("data", num_rows, num_cols);
+  auto view_h = Kokkos::create_mirror_view(view);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-5, 5);
+  for (std::size_t i = 0; i < num_rows; ++i) {
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      view_h(i, j) = dist(gen);
+    }
+  }
+  Kokkos::deep_copy(view, view_h);
+  return view;
+}
+
+auto create_host_copy(const data_view_t& view) {
+  return Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+}
+
+template <class ViewType>
+std::vector<int> host_row(const ViewType& view_h, std::size_t row) {
+  std::vector<int> result(view_h.extent(1));
+  for (std::size_t j = 0; j < result.size(); ++j) {
+    result[j] = view_h(row, j);
+  }
+  return result;
+}
+
+// the team size picked for AUTO may well be one, use the largest one
+// instead so that the algorithms really run on several threads
+template <class FunctorType>
+team_policy_t create_policy(std::size_t num_rows, const FunctorType& functor) {
+  const int team_size = team_policy_t(num_rows, Kokkos::AUTO())
+                            .team_size_max(functor, Kokkos::ParallelForTag());
+  return team_policy_t(num_rows, team_size);
+}
+
+// -------------------------------------------------------------
+// non-modifying algorithms, min/max element and reductions
+// -------------------------------------------------------------
+enum NonModifyingResults {
+  FindIndex = 0,
+  CountIf,
+  AllOf,
+  AnyOf,
+  NoneOf,
+  AdjacentFindIndex,
+  Equal,
+  MismatchIndex,
+  MinElementIndex,
+  MaxElementIndex,
+  MinMaxMinIndex,
+  MinMaxMaxIndex,
+  ReduceDefault,
+  ReduceInit,
+  ReduceCustom,
+  TransformReduceDefault,
+  SearchIndex,
+  SearchNIndex,
+  FindFirstOfIndex,
+  FindEndIndex,
+  LexicographicalCompare,
+  NumNonModifyingResults
+};
+
+struct NonModifyingFunctor {
+  data_view_t m_data;
+  data_view_t m_other;
+  data_view_t m_results;
+
+  KOKKOS_FUNCTION
+  void operator()(const member_t& member) const {
+    const auto row_index = member.league_rank();
+
+    auto row         = Kokkos::subview(m_data, row_index, Kokkos::ALL());
+    auto other       = Kokkos::subview(m_other, row_index, Kokkos::ALL());
+    const auto first = KE::begin(row);
+    // the searched sequences are the first (up to) two entries of the other
+    // row, the rows copied from the data always contain them
+    const auto num_needle = row.extent(0) < 2 ? row.extent(0) : 2;
+    const auto needle_range = Kokkos::make_pair(std::size_t(0), num_needle);
+    auto needle = Kokkos::subview(m_other, row_index, needle_range);
+
+    const auto find_it     = KE::find(member, row, 0);
+    const auto count       = KE::count_if(member, row, IsPositive());
+    const bool all         = KE::all_of(member, row, IsPositive());
+    const bool any         = KE::any_of(member, row, IsPositive());
+    const bool none        = KE::none_of(member, row, IsPositive());
+    const auto adjacent_it = KE::adjacent_find(member, row);
+    const bool equal       = KE::equal(member, row, other);
+    const auto mismatch_it = KE::mismatch(member, row, other);
+    const auto min_it      = KE::min_element(member, row);
+    const auto max_it      = KE::max_element(member, row);
+    const auto minmax_it   = KE::minmax_element(member, row);
+    const auto red_default = KE::reduce(member, row);
+    const auto red_init    = KE::reduce(member, row, 3);
+    const auto red_custom  = KE::reduce(member, row, -100, MaxJoiner());
+    const auto dot         = KE::transform_reduce(member, row, other, 0);
+    const auto search_it   = KE::search(member, row, needle);
+    const auto search_n_it = KE::search_n(member, row, num_needle, 1);
+    const auto first_of_it = KE::find_first_of(member, row, needle);
+    const auto find_end_it = KE::find_end(member, row, needle);
+    const bool lex_less    = KE::lexicographical_compare(member, row, other);
+
+    Kokkos::single(Kokkos::PerTeam(member), [=]() {
+      m_results(row_index, FindIndex)              = find_it - first;
+      m_results(row_index, CountIf)                = count;
+      m_results(row_index, AllOf)                  = all;
+      m_results(row_index, AnyOf)                  = any;
+      m_results(row_index, NoneOf)                 = none;
+      m_results(row_index, AdjacentFindIndex)      = adjacent_it - first;
+      m_results(row_index, Equal)                  = equal;
+      m_results(row_index, MismatchIndex)          = mismatch_it.first - first;
+      m_results(row_index, MinElementIndex)        = min_it - first;
+      m_results(row_index, MaxElementIndex)        = max_it - first;
+      m_results(row_index, MinMaxMinIndex)         = minmax_it.first - first;
+      m_results(row_index, MinMaxMaxIndex)         = minmax_it.second - first;
+      m_results(row_index, ReduceDefault)          = red_default;
+      m_results(row_index, ReduceInit)             = red_init;
+      m_results(row_index, ReduceCustom)           = red_custom;
+      m_results(row_index, TransformReduceDefault) = dot;
+      m_results(row_index, SearchIndex)            = search_it - first;
+      m_results(row_index, SearchNIndex)           = search_n_it - first;
+      m_results(row_index, FindFirstOfIndex)       = first_of_it - first;
+      m_results(row_index, FindEndIndex)           = find_end_it - first;
+      m_results(row_index, LexicographicalCompare) = lex_less;
+    });
+  }
+};
+
+void run_non_modifying(std::size_t num_rows, std::size_t num_cols) {
+  auto data  = create_random_data(num_rows, num_cols, 3 + num_cols);
+  auto other = create_random_data(num_rows, num_cols, 5 + num_cols);
+  // make some rows equal so that equal and mismatch see both outcomes
+  for (std::size_t i = 0; i < num_rows; i += 3) {
+    Kokkos::deep_copy(Kokkos::subview(other, i, Kokkos::ALL()),
+                      Kokkos::subview(data, i, Kokkos::ALL()));
+  }
+  data_view_t results("results", num_rows, NumNonModifyingResults);
+
+  NonModifyingFunctor functor{data, other, results};
+  Kokkos::parallel_for(create_policy(num_rows, functor), functor);
+
+  auto data_h    = create_host_copy(data);
+  auto other_h   = create_host_copy(other);
+  auto results_h = create_host_copy(results);
+  for (std::size_t i = 0; i < num_rows; ++i) {
+    const auto row         = host_row(data_h, i);
+    const auto other_row   = host_row(other_h, i);
+    const auto first       = row.cbegin();
+    const auto last        = row.cend();
+    const auto is_positive = [](int v) { return v > 0; };
+    const auto minmax      = std::minmax_element(first, last);
+    const auto num_needle  = std::min<std::size_t>(row.size(), 2);
+    const auto s_first     = other_row.cbegin();
+    const auto s_last      = s_first + num_needle;
+
+    EXPECT_EQ(std::find(first, last, 0) - first, results_h(i, FindIndex));
+    EXPECT_EQ(std::count_if(first, last, is_positive), results_h(i, CountIf));
+    EXPECT_EQ(std::all_of(first, last, is_positive), results_h(i, AllOf));
+    EXPECT_EQ(std::any_of(first, last, is_positive), results_h(i, AnyOf));
+    EXPECT_EQ(std::none_of(first, last, is_positive), results_h(i, NoneOf));
+    EXPECT_EQ(std::adjacent_find(first, last) - first,
+              results_h(i, AdjacentFindIndex));
+    EXPECT_EQ(std::equal(first, last, other_row.cbegin()),
+              results_h(i, Equal));
+    EXPECT_EQ(std::mismatch(first, last, other_row.cbegin()).first - first,
+              results_h(i, MismatchIndex));
+    EXPECT_EQ(std::min_element(first, last) - first,
+              results_h(i, MinElementIndex));
+    EXPECT_EQ(std::max_element(first, last) - first,
+              results_h(i, MaxElementIndex));
+    EXPECT_EQ(minmax.first - first, results_h(i, MinMaxMinIndex));
+    EXPECT_EQ(minmax.second - first, results_h(i, MinMaxMaxIndex));
+    EXPECT_EQ(std::accumulate(first, last, 0), results_h(i, ReduceDefault));
+    EXPECT_EQ(std::accumulate(first, last, 3), results_h(i, ReduceInit));
+    EXPECT_EQ(std::accumulate(first, last, -100, MaxJoiner()),
+              results_h(i, ReduceCustom));
+    EXPECT_EQ(std::inner_product(first, last, other_row.cbegin(), 0),
+              results_h(i, TransformReduceDefault));
+    EXPECT_EQ(std::search(first, last, s_first, s_last) - first,
+              results_h(i, SearchIndex));
+    EXPECT_EQ(std::search_n(first, last, num_needle, 1) - first,
+              results_h(i, SearchNIndex));
+    EXPECT_EQ(std::find_first_of(first, last, s_first, s_last) - first,
+              results_h(i, FindFirstOfIndex));
+    EXPECT_EQ(std::find_end(first, last, s_first, s_last) - first,
+              results_h(i, FindEndIndex));
+    EXPECT_EQ(std::lexicographical_compare(first, last, s_first,
+                                           other_row.cend()),
+              results_h(i, LexicographicalCompare));
+  }
+}
+
+// -------------------------------------------------------------
+// modifying algorithms and scans
+// -------------------------------------------------------------
+struct ModifyingFunctor {
+  data_view_t m_data;
+  data_view_t m_copy;
+  data_view_t m_transform;
+  data_view_t m_inclusive;
+  data_view_t m_exclusive;
+  data_view_t m_max_inclusive;
+  data_view_t m_max_inclusive_init;
+  data_view_t m_transform_inclusive;
+  data_view_t m_transform_inclusive_init;
+  data_view_t m_max_exclusive;
+  data_view_t m_transform_exclusive;
+  data_view_t m_adjacent;
+  data_view_t m_reverse;
+  data_view_t m_fill;
+
+  KOKKOS_FUNCTION
+  void operator()(const member_t& member) const {
+    const auto i = member.league_rank();
+    auto row     = Kokkos::subview(m_data, i, Kokkos::ALL());
+
+    auto copy_row = Kokkos::subview(m_copy, i, Kokkos::ALL());
+    KE::copy(member, row, copy_row);
+    KE::replace(member, copy_row, 0, 99);
+
+    auto transform_row = Kokkos::subview(m_transform, i, Kokkos::ALL());
+    KE::transform(member, row, transform_row, TimesTwo());
+
+    auto inclusive_row = Kokkos::subview(m_inclusive, i, Kokkos::ALL());
+    KE::inclusive_scan(member, row, inclusive_row);
+
+    auto exclusive_row = Kokkos::subview(m_exclusive, i, Kokkos::ALL());
+    KE::exclusive_scan(member, row, exclusive_row, 5);
+
+    auto max_inclusive_row = Kokkos::subview(m_max_inclusive, i, Kokkos::ALL());
+    KE::inclusive_scan(member, row, max_inclusive_row, MaxJoiner());
+
+    auto max_inclusive_init_row =
+        Kokkos::subview(m_max_inclusive_init, i, Kokkos::ALL());
+    KE::inclusive_scan(member, KE::cbegin(row), KE::cend(row),
+                       KE::begin(max_inclusive_init_row), MaxJoiner(), -3);
+
+    auto transform_inclusive_row =
+        Kokkos::subview(m_transform_inclusive, i, Kokkos::ALL());
+    KE::transform_inclusive_scan(member, row, transform_inclusive_row,
+                                 MaxJoiner(), TimesTwo());
+
+    auto transform_inclusive_init_row =
+        Kokkos::subview(m_transform_inclusive_init, i, Kokkos::ALL());
+    KE::transform_inclusive_scan(member, KE::cbegin(row), KE::cend(row),
+                                 KE::begin(transform_inclusive_init_row),
+                                 MaxJoiner(), TimesTwo(), 0);
+
+    auto max_exclusive_row = Kokkos::subview(m_max_exclusive, i, Kokkos::ALL());
+    KE::exclusive_scan(member, row, max_exclusive_row, -10, MaxJoiner());
+
+    // scanned in place
+    auto transform_exclusive_row =
+        Kokkos::subview(m_transform_exclusive, i, Kokkos::ALL());
+    KE::copy(member, row, transform_exclusive_row);
+    KE::transform_exclusive_scan(member, transform_exclusive_row,
+                                 transform_exclusive_row, 1, MaxJoiner(),
+                                 TimesTwo());
+
+    auto adjacent_row = Kokkos::subview(m_adjacent, i, Kokkos::ALL());
+    KE::adjacent_difference(member, row, adjacent_row);
+
+    // reversing twice gives back the input
+    auto reverse_row = Kokkos::subview(m_reverse, i, Kokkos::ALL());
+    KE::reverse_copy(member, row, reverse_row);
+    KE::reverse(member, reverse_row);
+
+    auto fill_row = Kokkos::subview(m_fill, i, Kokkos::ALL());
+    KE::fill(member, fill_row, 7);
+    KE::fill_n(member, fill_row, fill_row.extent(0) / 2, 1);
+  }
+};
+
+void run_modifying(std::size_t num_rows, std::size_t num_cols) {
+  auto data = create_random_data(num_rows, num_cols, 7 + num_cols);
+  ModifyingFunctor functor{data,
+                           data_view_t("copy", num_rows, num_cols),
+                           data_view_t("transform", num_rows, num_cols),
+                           data_view_t("inclusive", num_rows, num_cols),
+                           data_view_t("exclusive", num_rows, num_cols),
+                           data_view_t("max_inclusive", num_rows, num_cols),
+                           data_view_t("max_inclusive_init", num_rows,
+                                       num_cols),
+                           data_view_t("transform_inclusive", num_rows,
+                                       num_cols),
+                           data_view_t("transform_inclusive_init", num_rows,
+                                       num_cols),
+                           data_view_t("max_exclusive", num_rows, num_cols),
+                           data_view_t("transform_exclusive", num_rows,
+                                       num_cols),
+                           data_view_t("adjacent", num_rows, num_cols),
+                           data_view_t("reverse", num_rows, num_cols),
+                           data_view_t("fill", num_rows, num_cols)};
+  Kokkos::parallel_for(create_policy(num_rows, functor), functor);
+
+  auto data_h                = create_host_copy(data);
+  auto copy_h                = create_host_copy(functor.m_copy);
+  auto transform_h           = create_host_copy(functor.m_transform);
+  auto inclusive_h           = create_host_copy(functor.m_inclusive);
+  auto exclusive_h           = create_host_copy(functor.m_exclusive);
+  auto max_inclusive_h       = create_host_copy(functor.m_max_inclusive);
+  auto max_inclusive_init_h  = create_host_copy(functor.m_max_inclusive_init);
+  auto transform_inclusive_h = create_host_copy(functor.m_transform_inclusive);
+  auto max_exclusive_h       = create_host_copy(functor.m_max_exclusive);
+  auto transform_exclusive_h = create_host_copy(functor.m_transform_exclusive);
+  auto adjacent_h            = create_host_copy(functor.m_adjacent);
+  auto reverse_h             = create_host_copy(functor.m_reverse);
+  auto fill_h                = create_host_copy(functor.m_fill);
+  auto transform_inclusive_init_h =
+      create_host_copy(functor.m_transform_inclusive_init);
+  for (std::size_t i = 0; i < num_rows; ++i) {
+    const auto row = host_row(data_h, i);
+    std::vector<int> gold(num_cols);
+
+    std::replace_copy(row.cbegin(), row.cend(), gold.begin(), 0, 99);
+    EXPECT_EQ(gold, host_row(copy_h, i));
+
+    std::transform(row.cbegin(), row.cend(), gold.begin(), TimesTwo());
+    EXPECT_EQ(gold, host_row(transform_h, i));
+
+    std::partial_sum(row.cbegin(), row.cend(), gold.begin());
+    EXPECT_EQ(gold, host_row(inclusive_h, i));
+
+    int running = 5;
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      gold[j] = running;
+      running += row[j];
+    }
+    EXPECT_EQ(gold, host_row(exclusive_h, i));
+
+    std::partial_sum(row.cbegin(), row.cend(), gold.begin(), MaxJoiner());
+    EXPECT_EQ(gold, host_row(max_inclusive_h, i));
+
+    running = -3;
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      running = MaxJoiner()(running, row[j]);
+      gold[j] = running;
+    }
+    EXPECT_EQ(gold, host_row(max_inclusive_init_h, i));
+
+    std::transform(row.cbegin(), row.cend(), gold.begin(), TimesTwo());
+    std::partial_sum(gold.cbegin(), gold.cend(), gold.begin(), MaxJoiner());
+    EXPECT_EQ(gold, host_row(transform_inclusive_h, i));
+
+    running = 0;
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      running = MaxJoiner()(running, TimesTwo()(row[j]));
+      gold[j] = running;
+    }
+    EXPECT_EQ(gold, host_row(transform_inclusive_init_h, i));
+
+    running = -10;
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      gold[j] = running;
+      running = MaxJoiner()(running, row[j]);
+    }
+    EXPECT_EQ(gold, host_row(max_exclusive_h, i));
+
+    running = 1;
+    for (std::size_t j = 0; j < num_cols; ++j) {
+      gold[j] = running;
+      running = MaxJoiner()(running, TimesTwo()(row[j]));
+    }
+    EXPECT_EQ(gold, host_row(transform_exclusive_h, i));
+
+    std::adjacent_difference(row.cbegin(), row.cend(), gold.begin());
+    EXPECT_EQ(gold, host_row(adjacent_h, i));
+
+    EXPECT_EQ(row, host_row(reverse_h, i));
+
+    std::fill(gold.begin(), gold.end(), 7);
+    std::fill_n(gold.begin(), num_cols / 2, 1);
+    EXPECT_EQ(gold, host_row(fill_h, i));
+  }
+}
+
+// -------------------------------------------------------------
+// algorithms that compact, rotate or shift the elements
+// -------------------------------------------------------------
+enum CompactingResults {
+  CopyIf = 0,
+  Unique,
+  UniqueCopy,
+  Remove,
+  RemoveIf,
+  RemoveCopy,
+  RemoveCopyIf,
+  Rotate,
+  RotateCopy,
+  ShiftLeft,
+  ShiftRight,
+  NumCompactingResults
+};
+
+struct CompactingFunctor {
+  data_view_t m_data;
+  Kokkos::View<int***, exespace> m_outputs;
+  data_view_t m_ends;
+
+  KOKKOS_FUNCTION
+  auto output(int row_index, int result) const {
+    return Kokkos::subview(m_outputs, row_index, result, Kokkos::ALL());
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const member_t& member) const {
+    const auto i     = member.league_rank();
+    auto row         = Kokkos::subview(m_data, i, Kokkos::ALL());
+    const auto pivot = row.extent(0) / 3;
+    const auto shift = row.extent(0) / 4;
+
+    // the algorithms working in place run on a copy of the row
+    const int in_place[] = {Unique, Remove, RemoveIf,
+                            Rotate, ShiftLeft, ShiftRight};
+    for (int k : in_place) {
+      KE::copy(member, row, output(i, k));
+    }
+
+    const auto copy_if_it =
+        KE::copy_if(member, row, output(i, CopyIf), IsPositive());
+    const auto unique_it = KE::unique(member, output(i, Unique));
+    const auto unique_c_it =
+        KE::unique_copy(member, row, output(i, UniqueCopy));
+    const auto remove_it = KE::remove(member, output(i, Remove), 0);
+    const auto remove_if_it =
+        KE::remove_if(member, output(i, RemoveIf), IsPositive());
+    const auto remove_c_it =
+        KE::remove_copy(member, row, output(i, RemoveCopy), 0);
+    const auto remove_c_if_it =
+        KE::remove_copy_if(member, row, output(i, RemoveCopyIf), IsPositive());
+    const auto rotate_it = KE::rotate(member, output(i, Rotate), pivot);
+    const auto rotate_c_it =
+        KE::rotate_copy(member, row, pivot, output(i, RotateCopy));
+    const auto shift_l_it = KE::shift_left(member, output(i, ShiftLeft), shift);
+    const auto shift_r_it =
+        KE::shift_right(member, output(i, ShiftRight), shift);
+
+    Kokkos::single(Kokkos::PerTeam(member), [=]() {
+      m_ends(i, CopyIf)       = copy_if_it - KE::begin(output(i, CopyIf));
+      m_ends(i, Unique)       = unique_it - KE::begin(output(i, Unique));
+      m_ends(i, UniqueCopy)   = unique_c_it - KE::begin(output(i, UniqueCopy));
+      m_ends(i, Remove)       = remove_it - KE::begin(output(i, Remove));
+      m_ends(i, RemoveIf)     = remove_if_it - KE::begin(output(i, RemoveIf));
+      m_ends(i, RemoveCopy)   = remove_c_it - KE::begin(output(i, RemoveCopy));
+      m_ends(i, RemoveCopyIf) =
+          remove_c_if_it - KE::begin(output(i, RemoveCopyIf));
+      m_ends(i, Rotate)     = rotate_it - KE::begin(output(i, Rotate));
+      m_ends(i, RotateCopy) = rotate_c_it - KE::begin(output(i, RotateCopy));
+      m_ends(i, ShiftLeft)  = shift_l_it - KE::begin(output(i, ShiftLeft));
+      m_ends(i, ShiftRight) = shift_r_it - KE::begin(output(i, ShiftRight));
+    });
+  }
+};
+
+void run_compacting(std::size_t num_rows, std::size_t num_cols) {
+  auto data = create_random_data(num_rows, num_cols, 11 + num_cols);
+  CompactingFunctor functor{
+      data,
+      Kokkos::View<int***, exespace>("outputs", num_rows, NumCompactingResults,
+                                     num_cols),
+      data_view_t("ends", num_rows, NumCompactingResults)};
+  Kokkos::parallel_for(create_policy(num_rows, functor), functor);
+
+  auto data_h    = create_host_copy(data);
+  auto outputs_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       functor.m_outputs);
+  auto ends_h    = create_host_copy(functor.m_ends);
+
+  const auto is_positive = [](int v) { return v > 0; };
+  const std::ptrdiff_t n = num_cols;
+  const auto pivot       = n / 3;
+  const auto shift       = n / 4;
+  for (std::size_t i = 0; i < num_rows; ++i) {
+    const auto row = host_row(data_h, i);
+    // only the first "count" entries of the output are specified
+    const auto check = [&](int result, std::vector<int> gold,
+                           std::ptrdiff_t count) {
+      EXPECT_EQ(count, ends_h(i, result));
+      for (std::ptrdiff_t j = 0; j < count; ++j) {
+        EXPECT_EQ(gold[j], outputs_h(i, result, j));
+      }
+    };
+
+    std::vector<int> gold(num_cols);
+    auto gold_end =
+        std::copy_if(row.cbegin(), row.cend(), gold.begin(), is_positive);
+    check(CopyIf, gold, gold_end - gold.begin());
+
+    gold_end = std::unique_copy(row.cbegin(), row.cend(), gold.begin());
+    check(Unique, gold, gold_end - gold.begin());
+    check(UniqueCopy, gold, gold_end - gold.begin());
+
+    gold_end = std::remove_copy(row.cbegin(), row.cend(), gold.begin(), 0);
+    check(Remove, gold, gold_end - gold.begin());
+    check(RemoveCopy, gold, gold_end - gold.begin());
+
+    gold_end = std::remove_copy_if(row.cbegin(), row.cend(), gold.begin(),
+                                   is_positive);
+    check(RemoveIf, gold, gold_end - gold.begin());
+    check(RemoveCopyIf, gold, gold_end - gold.begin());
+
+    std::rotate_copy(row.cbegin(), row.cbegin() + pivot, row.cend(),
+                     gold.begin());
+    check(RotateCopy, gold, n);
+    EXPECT_EQ(n - pivot, ends_h(i, Rotate));
+    for (std::ptrdiff_t j = 0; j < n; ++j) {
+      EXPECT_EQ(gold[j], outputs_h(i, Rotate, j));
+    }
+
+    // the shifted elements are checked where they end up
+    EXPECT_EQ(n - shift, ends_h(i, ShiftLeft));
+    EXPECT_EQ(shift, ends_h(i, ShiftRight));
+    for (std::ptrdiff_t j = 0; j + shift < n; ++j) {
+      EXPECT_EQ(row[j + shift], outputs_h(i, ShiftLeft, j));
+      EXPECT_EQ(row[j], outputs_h(i, ShiftRight, j + shift));
+    }
+  }
+}
+
+TEST(std_algorithms_team_overloads, non_modifying_and_reductions) {
+  for (std::size_t num_cols : {0, 1, 3, 17, 153, 1103}) {
+    run_non_modifying(13, num_cols);
+  }
+}
+
+TEST(std_algorithms_team_overloads, modifying_and_scans) {
+  for (std::size_t num_cols : {0, 1, 3, 17, 153, 1103}) {
+    run_modifying(13, num_cols);
+  }
+}
+
+TEST(std_algorithms_team_overloads, compacting_rotating_and_shifting) {
+  for (std::size_t num_cols : {0, 1, 3, 17, 153, 1103}) {
+    run_compacting(13, num_cols);
+  }
+}
+
+}  // namespace TeamOverloads
+}  // namespace stdalgos
+}  // namespace Test
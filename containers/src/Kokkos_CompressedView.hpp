@@ -0,0 +1,412 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_COMPRESSED_VIEW_HPP
+#define KOKKOS_COMPRESSED_VIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <class DataType, class StorageType, class... Properties>
+class CompressedView;
+
+template <class>
+struct is_compressed_view : public std::false_type {};
+
+template <class D, class S, class... P>
+struct is_compressed_view<CompressedView<D, S, P...>> : public std::true_type {
+};
+
+template <class D, class S, class... P>
+struct is_compressed_view<const CompressedView<D, S, P...>>
+    : public std::true_type {};
+
+namespace Impl {
+
+// Replace the scalar of a View data type, e.g. double*[3] -> half_t*[3]
+template <class DataType, class StorageType>
+struct compressed_data_type {
+  using type = StorageType;
+};
+
+template <class DataType, class StorageType>
+struct compressed_data_type<const DataType, StorageType> {
+  using type = const typename compressed_data_type<DataType, StorageType>::type;
+};
+
+template <class DataType, class StorageType>
+struct compressed_data_type<DataType*, StorageType> {
+  using type = typename compressed_data_type<DataType, StorageType>::type*;
+};
+
+template <class DataType, class StorageType>
+struct compressed_data_type<DataType[], StorageType> {
+  using type = typename compressed_data_type<DataType, StorageType>::type[];
+};
+
+template <class DataType, class StorageType, size_t N>
+struct compressed_data_type<DataType[N], StorageType> {
+  using type = typename compressed_data_type<DataType, StorageType>::type[N];
+};
+
+}  // namespace Impl
+
+/// \class CompressedReference
+/// \brief Proxy to one element of a CompressedView.
+///
+/// Reads widen the stored value to \c WideType, writes narrow it back to
+/// \c StorageType.
+template <class WideType, class StorageType>
+class CompressedReference {
+ public:
+  using value_type   = WideType;
+  using storage_type = StorageType;
+
+ private:
+  storage_type* m_ptr;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  explicit CompressedReference(storage_type& ref) : m_ptr(&ref) {}
+
+  KOKKOS_DEFAULTED_FUNCTION
+  CompressedReference(const CompressedReference&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  operator value_type() const { return static_cast<value_type>(*m_ptr); }
+
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator=(const value_type& v) const {
+    *m_ptr = static_cast<storage_type>(v);
+    return *this;
+  }
+
+  // Assigning one proxy to another copies the element, it does not rebind.
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator=(const CompressedReference& rhs) const {
+    *m_ptr = *rhs.m_ptr;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  CompressedReference& operator=(const CompressedReference& rhs) {
+    *m_ptr = *rhs.m_ptr;
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator+=(const value_type& v) const {
+    return *this = static_cast<value_type>(*this) + v;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator-=(const value_type& v) const {
+    return *this = static_cast<value_type>(*this) - v;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator*=(const value_type& v) const {
+    return *this = static_cast<value_type>(*this) * v;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const CompressedReference& operator/=(const value_type& v) const {
+    return *this = static_cast<value_type>(*this) / v;
+  }
+};
+
+/// \class CompressedView
+/// \brief View storing its entries as \c StorageType while reading and
+///   writing them as the wider scalar of \c DataType.
+///
+/// \tparam DataType View data type of the wide scalar, e.g. double**
+/// \tparam StorageType narrow scalar used in memory, e.g. half_t, bhalf_t or
+///   float
+/// \tparam Properties same as for Kokkos::View
+///
+/// Read-mostly data which tolerates the reduced precision moves a half (float)
+/// or a quarter (half_t, bhalf_t) of the bytes of the wide representation.
+/// Note that half_t and bhalf_t are float on backends without native support.
+template <class DataType, class StorageType, class... Properties>
+class CompressedView {
+ public:
+  using wide_view_type = Kokkos::View<DataType, Properties...>;
+  using storage_view_type =
+      Kokkos::View<typename Impl::compressed_data_type<DataType,
+                                                       StorageType>::type,
+                   Properties...>;
+
+  using value_type     = typename wide_view_type::non_const_value_type;
+  using storage_type   = typename storage_view_type::non_const_value_type;
+  using reference_type = CompressedReference<
+      value_type, typename storage_view_type::value_type>;
+
+  using array_layout    = typename storage_view_type::array_layout;
+  using execution_space = typename storage_view_type::execution_space;
+  using memory_space    = typename storage_view_type::memory_space;
+  using device_type     = typename storage_view_type::device_type;
+  using size_type       = typename storage_view_type::size_type;
+  using HostMirror =
+      CompressedView<typename wide_view_type::non_const_data_type,
+                     StorageType, array_layout,
+                     Device<DefaultHostExecutionSpace,
+                            typename storage_view_type::traits::
+                                host_mirror_space::memory_space>>;
+
+  enum : unsigned { rank = storage_view_type::rank };
+
+  static_assert(std::is_arithmetic<value_type>::value,
+                "Kokkos::Experimental::CompressedView: the wide type must be "
+                "arithmetic");
+  static_assert(sizeof(storage_type) <= sizeof(value_type),
+                "Kokkos::Experimental::CompressedView: the storage type must "
+                "not be wider than the wide type");
+
+ private:
+  storage_view_type m_storage;
+
+ public:
+  CompressedView() = default;
+
+  /// Wrap an existing View of the storage type
+  KOKKOS_INLINE_FUNCTION
+  explicit CompressedView(const storage_view_type& storage)
+      : m_storage(storage) {}
+
+  /// Forwards to the constructors of the underlying storage View
+  template <class Arg0, class... Args,
+            class Enable = std::enable_if_t<
+                !is_compressed_view<Arg0>::value &&
+                !std::is_same<Arg0, storage_view_type>::value>>
+  explicit CompressedView(const Arg0& arg0, const Args&... args)
+      : m_storage(arg0, args...) {}
+
+  template <class... Is>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(const Is&... is) const {
+    return reference_type(m_storage(is...));
+  }
+
+  template <class I0>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator[](const I0& i0) const {
+    return reference_type(m_storage(i0));
+  }
+
+  /// The underlying View of the storage type
+  KOKKOS_INLINE_FUNCTION
+  const storage_view_type& storage() const { return m_storage; }
+
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION constexpr size_t extent(const iType& r) const {
+    return m_storage.extent(r);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_t size() const {
+    return m_storage.size();
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_t span() const {
+    return m_storage.span();
+  }
+
+  KOKKOS_INLINE_FUNCTION bool span_is_contiguous() const {
+    return m_storage.span_is_contiguous();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  typename storage_view_type::pointer_type data() const {
+    return m_storage.data();
+  }
+
+  KOKKOS_INLINE_FUNCTION bool is_allocated() const {
+    return m_storage.is_allocated();
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  array_layout layout() const { return m_storage.layout(); }
+
+  std::string label() const { return m_storage.label(); }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+// Flat conversion over the span of two contiguous Views with matching
+// layouts. Each work item touches one element of either array, so host
+// backends see a unit-stride loop the compiler can vectorize and device
+// backends get coalesced accesses.
+template <class DstScalar, class SrcScalar>
+struct CompressedViewConvert {
+  DstScalar* dst;
+  const SrcScalar* src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    dst[i] = static_cast<DstScalar>(src[i]);
+  }
+};
+
+template <class ExecSpace, class DstView, class SrcView>
+void compressed_view_deep_copy(const ExecSpace& exec, const DstView& dst,
+                               const SrcView& src) {
+  static_assert(unsigned(DstView::rank) == unsigned(SrcView::rank),
+                "Kokkos::deep_copy: CompressedView and View ranks differ");
+  static_assert(
+      std::is_same<typename DstView::array_layout,
+                   typename SrcView::array_layout>::value,
+      "Kokkos::deep_copy: CompressedView and View must have the same layout");
+
+  using dst_scalar = typename DstView::value_type;
+  using src_scalar = typename SrcView::const_value_type;
+
+  enum {
+    ExecCanAccessDst =
+        Kokkos::SpaceAccessibility<ExecSpace,
+                                   typename DstView::memory_space>::accessible,
+    ExecCanAccessSrc =
+        Kokkos::SpaceAccessibility<ExecSpace,
+                                   typename SrcView::memory_space>::accessible
+  };
+
+  for (unsigned r = 0; r < DstView::rank; ++r) {
+    if (dst.extent(r) != src.extent(r)) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::deep_copy: CompressedView and View extents do not match");
+    }
+  }
+  if (!(ExecCanAccessDst && ExecCanAccessSrc)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "deep_copy given views that would require a temporary allocation");
+  }
+  if (!dst.span_is_contiguous() || !src.span_is_contiguous() ||
+      dst.span() != src.span()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::deep_copy: CompressedView conversion requires contiguous "
+        "Views");
+  }
+
+  Kokkos::parallel_for(
+      "Kokkos::deep_copy-CompressedView",
+      Kokkos::RangePolicy<ExecSpace>(exec, 0, dst.span()),
+      CompressedViewConvert<dst_scalar, src_scalar>{dst.data(), src.data()});
+}
+
+}  // namespace Impl
+
+/// Narrow a full-width View into a CompressedView
+template <class ExecSpace, class DT, class S, class... DP, class ST,
+          class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec,
+          const Kokkos::Experimental::CompressedView<DT, S, DP...>& dst,
+          const View<ST, SP...>& src) {
+  Impl::compressed_view_deep_copy(exec, dst.storage(), src);
+}
+
+template <class DT, class S, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const Kokkos::Experimental::CompressedView<DT, S, DP...>& dst,
+    const View<ST, SP...>& src) {
+  using exec_space = typename Kokkos::Experimental::CompressedView<
+      DT, S, DP...>::execution_space;
+  Kokkos::fence("Kokkos::deep_copy: CompressedView fence before copy");
+  Impl::compressed_view_deep_copy(exec_space(), dst.storage(), src);
+  Kokkos::fence("Kokkos::deep_copy: CompressedView fence after copy");
+}
+
+/// Widen a CompressedView into a full-width View
+template <class ExecSpace, class DT, class... DP, class ST, class S,
+          class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec, const View<DT, DP...>& dst,
+          const Kokkos::Experimental::CompressedView<ST, S, SP...>& src) {
+  Impl::compressed_view_deep_copy(exec, dst, src.storage());
+}
+
+template <class DT, class... DP, class ST, class S, class... SP>
+inline void deep_copy(
+    const View<DT, DP...>& dst,
+    const Kokkos::Experimental::CompressedView<ST, S, SP...>& src) {
+  using exec_space = typename Kokkos::Experimental::CompressedView<
+      ST, S, SP...>::execution_space;
+  Kokkos::fence("Kokkos::deep_copy: CompressedView fence before copy");
+  Impl::compressed_view_deep_copy(exec_space(), dst, src.storage());
+  Kokkos::fence("Kokkos::deep_copy: CompressedView fence after copy");
+}
+
+/// Copy the compressed representation, e.g. between memory spaces
+template <class DT, class S, class... DP, class ST, class... SP>
+inline void deep_copy(
+    const Kokkos::Experimental::CompressedView<DT, S, DP...>& dst,
+    const Kokkos::Experimental::CompressedView<ST, S, SP...>& src) {
+  Kokkos::deep_copy(dst.storage(), src.storage());
+}
+
+template <class ExecSpace, class DT, class S, class... DP, class ST,
+          class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec,
+          const Kokkos::Experimental::CompressedView<DT, S, DP...>& dst,
+          const Kokkos::Experimental::CompressedView<ST, S, SP...>& src) {
+  Kokkos::deep_copy(exec, dst.storage(), src.storage());
+}
+
+template <class DT, class S, class... P>
+inline typename Kokkos::Experimental::CompressedView<DT, S, P...>::HostMirror
+create_mirror_view(
+    const Kokkos::Experimental::CompressedView<DT, S, P...>& src) {
+  return typename Kokkos::Experimental::CompressedView<DT, S, P...>::HostMirror(
+      Kokkos::create_mirror_view(src.storage()));
+}
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_COMPRESSED_VIEW_HPP */
@@ -0,0 +1,600 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_SOA_VIEW_HPP
+#define KOKKOS_SOA_VIEW_HPP
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \brief Describes one data member of an aggregate stored in a SoAView.
+///
+/// Use the KOKKOS_SOA_MEMBER(Type, name) macro to spell it.
+template <class MemberPointer, MemberPointer Ptr>
+struct SoAMember;
+
+/// \brief Ordered list of the members of an aggregate stored in a SoAView.
+template <class... Members>
+struct SoAMemberList {};
+
+/// \brief Customization point: specialize for each aggregate that should be
+/// stored as a structure of arrays, e.g.
+///
+///   template <>
+///   struct Kokkos::Experimental::SoAMembers<Particle> {
+///     using type = Kokkos::Experimental::SoAMemberList<
+///         KOKKOS_SOA_MEMBER(Particle, x), KOKKOS_SOA_MEMBER(Particle, v),
+///         KOKKOS_SOA_MEMBER(Particle, id)>;
+///   };
+template <class T>
+struct SoAMembers;
+
+template <class DataType, class... Properties>
+class SoAView;
+
+template <class>
+struct is_soa_view : public std::false_type {};
+
+template <class D, class... P>
+struct is_soa_view<SoAView<D, P...>> : public std::true_type {};
+
+template <class D, class... P>
+struct is_soa_view<const SoAView<D, P...>> : public std::true_type {};
+
+namespace Impl {
+
+template <class MemberPointer>
+struct soa_member_pointer_traits;
+
+template <class T, class M>
+struct soa_member_pointer_traits<M T::*> {
+  using struct_type = T;
+  using value_type  = M;
+};
+
+template <class List, size_t I>
+struct soa_member_at;
+
+template <class Member, class... Members>
+struct soa_member_at<SoAMemberList<Member, Members...>, 0> {
+  using type = Member;
+};
+
+template <class Member, class... Members, size_t I>
+struct soa_member_at<SoAMemberList<Member, Members...>, I> {
+  using type = typename soa_member_at<SoAMemberList<Members...>, I - 1>::type;
+};
+
+// One array of the structure of arrays, tagged by the member index so that
+// members sharing the same type remain distinct bases.
+template <size_t I, class ViewType>
+struct SoAField {
+  ViewType view;
+};
+
+template <class Indices, class... Views>
+struct SoAFields;
+
+template <size_t... Is, class... Views>
+struct SoAFields<std::index_sequence<Is...>, Views...>
+    : SoAField<Is, Views>... {};
+
+template <size_t I, class ViewType>
+KOKKOS_INLINE_FUNCTION const ViewType& soa_get_field(
+    const SoAField<I, ViewType>& field) {
+  return field.view;
+}
+
+// Runtime lookup of a member pointer among the members of matching type.
+// Members of a different type are never compared, so the search folds to a
+// single branch when the pointer is a compile-time constant.
+template <class List, class M, size_t I, bool InRange = (I < List::size)>
+struct soa_member_has_type : std::false_type {};
+
+template <class List, class M, size_t I>
+struct soa_member_has_type<List, M, I, true>
+    : std::is_same<M, typename List::template value_type<I>> {};
+
+template <class List, class M, size_t I, size_t N = List::size,
+          bool SameType = soa_member_has_type<List, M, I>::value>
+struct SoAMemberLookup;
+
+template <bool... Bs>
+struct soa_all_of : std::true_type {};
+
+template <bool B, bool... Bs>
+struct soa_all_of<B, Bs...>
+    : std::integral_constant<bool, B && soa_all_of<Bs...>::value> {};
+
+}  // namespace Impl
+
+template <class MemberPointer, MemberPointer Ptr>
+struct SoAMember {
+  using traits      = Impl::soa_member_pointer_traits<MemberPointer>;
+  using struct_type = typename traits::struct_type;
+  using value_type  = typename traits::value_type;
+
+  static_assert(!std::is_array<value_type>::value,
+                "Kokkos::Experimental::SoAMember: array data members are not "
+                "supported");
+
+  KOKKOS_INLINE_FUNCTION
+  static constexpr MemberPointer pointer() { return Ptr; }
+
+  KOKKOS_INLINE_FUNCTION
+  static value_type& get(struct_type& s) { return s.*Ptr; }
+
+  KOKKOS_INLINE_FUNCTION
+  static const value_type& get(const struct_type& s) { return s.*Ptr; }
+};
+
+#define KOKKOS_SOA_MEMBER(TYPE, NAME) \
+  ::Kokkos::Experimental::SoAMember<decltype(&TYPE::NAME), &TYPE::NAME>
+
+namespace Impl {
+
+template <class T, class List>
+struct SoAViewTraitsImpl;
+
+template <class T, class... Members>
+struct SoAViewTraitsImpl<T, SoAMemberList<Members...>> {
+  static constexpr size_t size = sizeof...(Members);
+
+  template <size_t I>
+  using member = typename soa_member_at<SoAMemberList<Members...>, I>::type;
+
+  template <size_t I>
+  using value_type = typename member<I>::value_type;
+
+  template <class... Properties>
+  using fields_type =
+      SoAFields<std::make_index_sequence<size>,
+                Kokkos::View<typename Members::value_type*, Properties...>...>;
+
+  static_assert(
+      soa_all_of<
+          std::is_same<typename Members::struct_type, T>::value...>::value,
+      "Kokkos::Experimental::SoAMembers<T>: all members must belong to T");
+};
+
+template <class T>
+using SoAViewTraits = SoAViewTraitsImpl<T, typename SoAMembers<T>::type>;
+
+template <class List, class M, size_t I, size_t N>
+struct SoAMemberLookup<List, M, I, N, true> {
+  template <class Fields, class Ptr>
+  KOKKOS_INLINE_FUNCTION static M* element(const Fields& fields, Ptr ptr,
+                                           size_t i) {
+    if (ptr == List::template member<I>::pointer())
+      return &soa_get_field<I>(fields)(i);
+    return SoAMemberLookup<List, M, I + 1>::element(fields, ptr, i);
+  }
+
+  template <class ViewType, class Fields, class Ptr>
+  static ViewType field(const Fields& fields, Ptr ptr) {
+    if (ptr == List::template member<I>::pointer())
+      return soa_get_field<I>(fields);
+    return SoAMemberLookup<List, M, I + 1>::template field<ViewType>(fields,
+                                                                     ptr);
+  }
+};
+
+template <class List, class M, size_t I, size_t N>
+struct SoAMemberLookup<List, M, I, N, false> {
+  template <class Fields, class Ptr>
+  KOKKOS_INLINE_FUNCTION static M* element(const Fields& fields, Ptr ptr,
+                                           size_t i) {
+    return SoAMemberLookup<List, M, I + 1>::element(fields, ptr, i);
+  }
+
+  template <class ViewType, class Fields, class Ptr>
+  static ViewType field(const Fields& fields, Ptr ptr) {
+    return SoAMemberLookup<List, M, I + 1>::template field<ViewType>(fields,
+                                                                     ptr);
+  }
+};
+
+template <class List, class M, size_t N>
+struct SoAMemberLookup<List, M, N, N, false> {
+  template <class Fields, class Ptr>
+  KOKKOS_INLINE_FUNCTION static M* element(const Fields&, Ptr, size_t) {
+    Kokkos::abort(
+        "Kokkos::Experimental::SoAView: member pointer is not part of "
+        "SoAMembers<T>");
+    return nullptr;
+  }
+
+  template <class ViewType, class Fields, class Ptr>
+  static ViewType field(const Fields&, Ptr) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::SoAView: member pointer is not part of "
+        "SoAMembers<T>");
+    return ViewType();
+  }
+};
+
+template <class Traits, class Fields, size_t... Is>
+KOKKOS_INLINE_FUNCTION void soa_scatter(
+    const Fields& fields, size_t i,
+    const typename Traits::template member<0>::struct_type& src,
+    std::index_sequence<Is...>) {
+  int dummy[] = {
+      0, (soa_get_field<Is>(fields)(i) = Traits::template member<Is>::get(src),
+          0)...};
+  (void)dummy;
+}
+
+template <class Traits, class Fields, size_t... Is>
+KOKKOS_INLINE_FUNCTION void soa_gather(
+    const Fields& fields, size_t i,
+    typename Traits::template member<0>::struct_type& dst,
+    std::index_sequence<Is...>) {
+  int dummy[] = {
+      0, (Traits::template member<Is>::get(dst) = soa_get_field<Is>(fields)(i),
+          0)...};
+  (void)dummy;
+}
+
+}  // namespace Impl
+
+/// \class SoAReference
+/// \brief Proxy returned by SoAView::operator() for one element.
+///
+/// Reads gather the members into a value of the aggregate type, writes
+/// scatter them; single members are reached through get<I>() or
+/// get(&T::member) without touching the other arrays.
+template <class SoAViewType>
+class SoAReference {
+ public:
+  using value_type  = typename SoAViewType::value_type;
+  using traits_type = typename SoAViewType::traits_type;
+  using fields_type = typename SoAViewType::fields_type;
+
+ private:
+  const fields_type* m_fields;
+  size_t m_index;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  SoAReference(const fields_type& fields, size_t i)
+      : m_fields(&fields), m_index(i) {}
+
+  KOKKOS_DEFAULTED_FUNCTION SoAReference(const SoAReference&) = default;
+
+  /// Reference to the I-th member of the element
+  template <size_t I>
+  KOKKOS_INLINE_FUNCTION typename traits_type::template value_type<I>& get()
+      const {
+    return Impl::soa_get_field<I>(*m_fields)(m_index);
+  }
+
+  /// Reference to the member designated by \c ptr, e.g. get(&Particle::x)
+  template <class M>
+  KOKKOS_INLINE_FUNCTION M& get(M value_type::*ptr) const {
+    return *Impl::SoAMemberLookup<traits_type, M, 0>::element(*m_fields, ptr,
+                                                              m_index);
+  }
+
+  template <class M>
+  KOKKOS_INLINE_FUNCTION M& operator->*(M value_type::*ptr) const {
+    return get(ptr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  operator value_type() const {
+    value_type v;
+    Impl::soa_gather<traits_type>(
+        *m_fields, m_index, v, std::make_index_sequence<traits_type::size>{});
+    return v;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  const SoAReference& operator=(const value_type& v) const {
+    Impl::soa_scatter<traits_type>(
+        *m_fields, m_index, v, std::make_index_sequence<traits_type::size>{});
+    return *this;
+  }
+
+  // Assigning one proxy to another copies the element, it does not rebind.
+  KOKKOS_INLINE_FUNCTION
+  const SoAReference& operator=(const SoAReference& rhs) const {
+    return *this = static_cast<value_type>(rhs);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  SoAReference& operator=(const SoAReference& rhs) {
+    *static_cast<const SoAReference*>(this) = static_cast<value_type>(rhs);
+    return *this;
+  }
+};
+
+/// \class SoAView
+/// \brief Rank-1 array of aggregates stored as one contiguous View per member.
+///
+/// \tparam DataType must be T* where T is an aggregate for which
+///   Kokkos::Experimental::SoAMembers<T> has been specialized.
+/// \tparam Properties same as for Kokkos::View (layout, device, traits).
+///
+/// Kernels touching a single member can take field<I>() (or field(&T::m))
+/// and stream a plain contiguous View instead of a strided AoS access.
+template <class DataType, class... Properties>
+class SoAView {
+  static_assert(std::is_pointer<DataType>::value &&
+                    !std::is_pointer<std::remove_pointer_t<DataType>>::value,
+                "Kokkos::Experimental::SoAView: only rank-1 data types T* are "
+                "supported");
+
+ public:
+  using value_type  = std::remove_pointer_t<DataType>;
+  using data_type   = DataType;
+  using traits_type = Impl::SoAViewTraits<value_type>;
+  using fields_type =
+      typename traits_type::template fields_type<Properties...>;
+  using reference_type  = SoAReference<SoAView>;
+  using aos_view_type   = Kokkos::View<value_type*, Properties...>;
+  using execution_space = typename aos_view_type::execution_space;
+  using memory_space    = typename aos_view_type::memory_space;
+  using device_type     = typename aos_view_type::device_type;
+  using size_type       = typename aos_view_type::size_type;
+  using HostMirror      = SoAView<value_type*, Kokkos::HostSpace>;
+
+  template <size_t I>
+  using field_type = Kokkos::View<typename traits_type::template value_type<I>*,
+                                  Properties...>;
+
+  static_assert(!std::is_const<value_type>::value,
+                "Kokkos::Experimental::SoAView: value type must not be const");
+
+  enum : unsigned { rank = 1, number_of_members = traits_type::size };
+
+ private:
+  fields_type m_fields;
+
+  template <size_t... Is>
+  void allocate(const std::string& label, size_t n,
+                std::index_sequence<Is...>) {
+    int dummy[] = {0, (static_cast<Impl::SoAField<Is, field_type<Is>>&>(
+                           m_fields)
+                           .view = field_type<Is>(
+                           label + "::" + std::to_string(Is), n),
+                       0)...};
+    (void)dummy;
+  }
+
+ public:
+  SoAView() = default;
+
+  SoAView(const std::string& label, size_t n) : m_fields() {
+    allocate(label, n, std::make_index_sequence<traits_type::size>{});
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  reference_type operator()(size_t i) const {
+    return reference_type(m_fields, i);
+  }
+
+  /// Contiguous View holding the I-th member of every element
+  template <size_t I>
+  KOKKOS_INLINE_FUNCTION const field_type<I>& field() const {
+    return Impl::soa_get_field<I>(m_fields);
+  }
+
+  /// Contiguous View holding the member designated by \c ptr
+  template <class M>
+  Kokkos::View<M*, Properties...> field(M value_type::*ptr) const {
+    return Impl::SoAMemberLookup<traits_type, M, 0>::template field<
+        Kokkos::View<M*, Properties...>>(m_fields, ptr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t extent(const unsigned r) const {
+    return r == 0 ? field<0>().extent(0) : 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_t size() const { return field<0>().size(); }
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_allocated() const { return field<0>().is_allocated(); }
+
+  /// The label given at construction, recovered from the "<label>::0" label
+  /// of the first field
+  std::string label() const {
+    const std::string label = field<0>().label();
+    return label.size() < 3 ? label : label.substr(0, label.size() - 3);
+  }
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Kokkos {
+namespace Impl {
+
+template <class SoAViewType, class ViewType, bool Scatter>
+struct SoAViewCopyFunctor {
+  SoAViewType soa;
+  ViewType aos;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const size_t i) const {
+    if (Scatter) {
+      soa(i) = aos(i);
+    } else {
+      aos(i) = soa(i);
+    }
+  }
+};
+
+template <bool Scatter, class ExecSpace, class SoAViewType, class ViewType>
+void soa_view_deep_copy(const ExecSpace& exec, const SoAViewType& soa,
+                        const ViewType& aos) {
+  static_assert(
+      std::is_same<typename SoAViewType::value_type,
+                   typename ViewType::non_const_value_type>::value,
+      "Kokkos::deep_copy: SoAView and View must have the same value type");
+  static_assert(ViewType::rank == 1,
+                "Kokkos::deep_copy: SoAView can only be copied to/from a "
+                "rank-1 View");
+
+  if (soa.extent(0) != aos.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::deep_copy: SoAView and View extents do not match");
+  }
+
+  enum {
+    SoAExecCanAccessView =
+        Kokkos::SpaceAccessibility<typename SoAViewType::execution_space,
+                                   typename ViewType::memory_space>::accessible
+  };
+
+  if (SoAExecCanAccessView) {
+    Kokkos::parallel_for(
+        Scatter ? "Kokkos::deep_copy-AoSToSoA" : "Kokkos::deep_copy-SoAToAoS",
+        Kokkos::RangePolicy<ExecSpace>(exec, 0, aos.extent(0)),
+        SoAViewCopyFunctor<SoAViewType, ViewType, Scatter>{soa, aos});
+  } else {
+    Kokkos::Impl::throw_runtime_exception(
+        "deep_copy given views that would require a temporary allocation");
+  }
+}
+
+template <class DstType, class SrcType, size_t... Is>
+void soa_view_deep_copy_fields(const DstType& dst, const SrcType& src,
+                               std::index_sequence<Is...>) {
+  int dummy[] = {
+      0, (Kokkos::deep_copy(dst.template field<Is>(), src.template field<Is>()),
+          0)...};
+  (void)dummy;
+}
+
+template <class ExecSpace, class DstType, class SrcType, size_t... Is>
+void soa_view_deep_copy_fields(const ExecSpace& exec, const DstType& dst,
+                               const SrcType& src, std::index_sequence<Is...>) {
+  int dummy[] = {0, (Kokkos::deep_copy(exec, dst.template field<Is>(),
+                                       src.template field<Is>()),
+                     0)...};
+  (void)dummy;
+}
+
+}  // namespace Impl
+
+/// Scatter a rank-1 AoS View into a SoAView.  The View must be accessible
+/// from the execution space of the SoAView.
+template <class ExecSpace, class T, class... DP, class ST, class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec,
+          const Kokkos::Experimental::SoAView<T, DP...>& dst,
+          const View<ST, SP...>& src) {
+  Impl::soa_view_deep_copy<true>(exec, dst, src);
+}
+
+template <class T, class... DP, class ST, class... SP>
+inline void deep_copy(const Kokkos::Experimental::SoAView<T, DP...>& dst,
+                      const View<ST, SP...>& src) {
+  using exec_space =
+      typename Kokkos::Experimental::SoAView<T, DP...>::execution_space;
+  Kokkos::fence("Kokkos::deep_copy: SoAView fence before copy");
+  Impl::soa_view_deep_copy<true>(exec_space(), dst, src);
+  Kokkos::fence("Kokkos::deep_copy: SoAView fence after copy");
+}
+
+/// Gather a SoAView into a rank-1 AoS View.  The View must be accessible
+/// from the execution space of the SoAView.
+template <class ExecSpace, class DT, class... DP, class T, class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec, const View<DT, DP...>& dst,
+          const Kokkos::Experimental::SoAView<T, SP...>& src) {
+  Impl::soa_view_deep_copy<false>(exec, src, dst);
+}
+
+template <class DT, class... DP, class T, class... SP>
+inline void deep_copy(const View<DT, DP...>& dst,
+                      const Kokkos::Experimental::SoAView<T, SP...>& src) {
+  using exec_space =
+      typename Kokkos::Experimental::SoAView<T, SP...>::execution_space;
+  Kokkos::fence("Kokkos::deep_copy: SoAView fence before copy");
+  Impl::soa_view_deep_copy<false>(exec_space(), src, dst);
+  Kokkos::fence("Kokkos::deep_copy: SoAView fence after copy");
+}
+
+/// Copy member arrays one by one; the two SoAViews may live in different
+/// memory spaces.
+template <class ExecSpace, class T, class... DP, class... SP>
+inline std::enable_if_t<Kokkos::is_execution_space<ExecSpace>::value>
+deep_copy(const ExecSpace& exec,
+          const Kokkos::Experimental::SoAView<T, DP...>& dst,
+          const Kokkos::Experimental::SoAView<T, SP...>& src) {
+  using traits_type =
+      typename Kokkos::Experimental::SoAView<T, DP...>::traits_type;
+  Impl::soa_view_deep_copy_fields(
+      exec, dst, src, std::make_index_sequence<traits_type::size>{});
+}
+
+template <class T, class... DP, class... SP>
+inline void deep_copy(const Kokkos::Experimental::SoAView<T, DP...>& dst,
+                      const Kokkos::Experimental::SoAView<T, SP...>& src) {
+  using traits_type =
+      typename Kokkos::Experimental::SoAView<T, DP...>::traits_type;
+  Impl::soa_view_deep_copy_fields(
+      dst, src, std::make_index_sequence<traits_type::size>{});
+}
+
+template <class T, class... P>
+inline typename Kokkos::Experimental::SoAView<T, P...>::HostMirror
+create_mirror(const Kokkos::Experimental::SoAView<T, P...>& src) {
+  return typename Kokkos::Experimental::SoAView<T, P...>::HostMirror(
+      std::string(src.label()).append("_mirror"), src.extent(0));
+}
+
+}  // namespace Kokkos
+
+#endif /* #ifndef KOKKOS_SOA_VIEW_HPP */
@@ -493,6 +493,184 @@ DataType maximum_entry(const StaticCrsGraph<DataType, Arg1Type, Arg2Type,
   return result;
 }
 
+//----------------------------------------------------------------------------
+
+namespace Experimental {
+namespace Impl {
+
+// Start of every chunk on the merge path of the row ends with the entries:
+// chunk c starts where rows + entries consumed reach c * total / num_chunks
+template <class RowMapType, class StartsType>
+struct CrsMergePathStarts {
+  using size_type = typename RowMapType::non_const_value_type;
+
+  RowMapType row_map;
+  StartsType starts;
+  size_type num_rows;
+  size_type num_entries;
+  int num_chunks;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int c) const {
+    const size_type total    = num_rows + num_entries;
+    const size_type diagonal = static_cast<size_type>(
+        static_cast<double>(total) * c / num_chunks);
+    // The row i where the diagonal crosses the path, for which rows before i
+    // end at or before entry diagonal - i and row i ends after it
+    size_type lo = diagonal > num_entries ? diagonal - num_entries : 0;
+    size_type hi = diagonal < num_rows ? diagonal : num_rows;
+    while (lo < hi) {
+      const size_type mid = lo + (hi - lo) / 2;
+      if (row_map(mid + 1) <= diagonal - 1 - mid) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    starts(c, 0) = lo;
+    starts(c, 1) = diagonal - lo;
+  }
+};
+
+template <class RowMapType, class StartsType, class FunctorType>
+struct CrsMergePathChunk {
+  using size_type = typename RowMapType::non_const_value_type;
+
+  RowMapType row_map;
+  StartsType starts;
+  FunctorType functor;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int c) const {
+    const size_type last_row   = starts(c + 1, 0);
+    const size_type last_entry = starts(c + 1, 1);
+    size_type row              = starts(c, 0);
+    size_type entry            = starts(c, 1);
+    for (; row < last_row; ++row) {
+      const size_type end = row_map(row + 1);
+      // A row whose entries all went to the previous chunk ended there
+      if (entry < end || entry == row_map(row)) functor(row, entry, end);
+      entry = end;
+    }
+    // The first entries of a row finished by the next chunks
+    if (entry < last_entry) functor(row, entry, last_entry);
+  }
+};
+
+}  // namespace Impl
+
+/// \class CrsMergePathPolicy
+/// \brief Iterates over the rows of a CRS structure with the work of rows
+/// and entries split evenly across chunks, after the merge-path SpMV of
+/// D. Merrill and M. Garland (SC 2016).
+///
+/// Kokkos::parallel_for(policy, functor) calls functor(row, begin, end) for
+/// the entries begin to end - 1 of row. Empty rows are visited once. Long
+/// rows are split between chunks running concurrently: every row gets one
+/// call with end == row_map(row + 1), possibly preceded by calls for its
+/// first entries. Functors combining the entries of a row must do so
+/// atomically unless begin == row_map(row) and end == row_map(row + 1).
+///
+/// The chunk starts are computed on construction, so a policy is best
+/// reused for every loop over the same structure.
+template <class ExecutionSpace, class RowMapType>
+class CrsMergePathPolicy {
+ public:
+  using execution_space = ExecutionSpace;
+  using size_type       = typename RowMapType::non_const_value_type;
+  using row_map_type    = RowMapType;
+  using starts_type =
+      Kokkos::View<size_type* [2], typename ExecutionSpace::memory_space>;
+
+ private:
+  ExecutionSpace m_space;
+  RowMapType m_row_map;
+  starts_type m_starts;
+  int m_num_chunks;
+
+ public:
+  /// num_chunks defaults to a few chunks per thread, of at least 256
+  /// rows and entries each
+  CrsMergePathPolicy(const ExecutionSpace& space, const RowMapType& row_map,
+                     int num_chunks = 0)
+      : m_space(space), m_row_map(row_map) {
+    static_assert(RowMapType::rank == 1,
+                  "Kokkos::Experimental::CrsMergePathPolicy: the row map "
+                  "must be of rank 1");
+    const size_type num_rows =
+        row_map.extent(0) > 0 ? row_map.extent(0) - 1 : 0;
+    size_type num_entries = 0;
+    if (num_rows > 0) {
+      Kokkos::deep_copy(space, num_entries,
+                        Kokkos::subview(row_map, num_rows));
+      space.fence(
+          "Kokkos::Experimental::CrsMergePathPolicy: fence after reading the "
+          "number of entries");
+    }
+    if (num_chunks <= 0) {
+      const size_type by_size    = (num_rows + num_entries) / 256;
+      const size_type by_threads = 4 * size_type(space.concurrency());
+      num_chunks = int(by_size < by_threads ? by_size : by_threads);
+      if (num_chunks < 1) num_chunks = 1;
+    }
+    m_num_chunks = num_rows > 0 ? num_chunks : 0;
+    m_starts     = starts_type(
+        Kokkos::view_alloc(space, "Kokkos::CrsMergePathPolicy::starts"),
+        m_num_chunks + 1);
+    if (m_num_chunks > 0) {
+      Kokkos::parallel_for(
+          "Kokkos::CrsMergePathPolicy::starts",
+          Kokkos::RangePolicy<ExecutionSpace>(space, 0, m_num_chunks + 1),
+          Impl::CrsMergePathStarts<RowMapType, starts_type>{
+              row_map, m_starts, num_rows, num_entries, m_num_chunks});
+    }
+  }
+
+  explicit CrsMergePathPolicy(const RowMapType& row_map, int num_chunks = 0)
+      : CrsMergePathPolicy(ExecutionSpace(), row_map, num_chunks) {}
+
+  const ExecutionSpace& space() const { return m_space; }
+  const RowMapType& row_map() const { return m_row_map; }
+  int num_chunks() const { return m_num_chunks; }
+
+  /// (row, entry) where each chunk starts, and where the last one ends
+  const starts_type& chunk_starts() const { return m_starts; }
+};
+
+template <class ExecutionSpace, class RowMapType>
+CrsMergePathPolicy<ExecutionSpace, RowMapType> crs_merge_path_policy(
+    const ExecutionSpace& space, const RowMapType& row_map,
+    const int num_chunks = 0) {
+  return CrsMergePathPolicy<ExecutionSpace, RowMapType>(space, row_map,
+                                                        num_chunks);
+}
+
+}  // namespace Experimental
+
+template <class ExecutionSpace, class RowMapType, class FunctorType>
+void parallel_for(
+    const Experimental::CrsMergePathPolicy<ExecutionSpace, RowMapType>& policy,
+    const FunctorType& functor, const std::string& str = "") {
+  using chunk_type = Experimental::Impl::CrsMergePathChunk<
+      RowMapType,
+      typename Experimental::CrsMergePathPolicy<ExecutionSpace,
+                                                RowMapType>::starts_type,
+      FunctorType>;
+  Kokkos::parallel_for(
+      str,
+      Kokkos::RangePolicy<ExecutionSpace>(policy.space(), 0,
+                                          policy.num_chunks()),
+      chunk_type{policy.row_map(), policy.chunk_starts(), functor});
+}
+
+template <class ExecutionSpace, class RowMapType, class FunctorType>
+void parallel_for(
+    const std::string& str,
+    const Experimental::CrsMergePathPolicy<ExecutionSpace, RowMapType>& policy,
+    const FunctorType& functor) {
+  Kokkos::parallel_for(policy, functor, str);
+}
+
 }  // namespace Kokkos
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,161 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEST_COMPRESSEDVIEW_HPP
+#define KOKKOS_TEST_COMPRESSEDVIEW_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_CompressedView.hpp>
+
+namespace Test {
+
+namespace {
+
+template <class StorageType>
+void test_compressed_view_rank1(int n) {
+  using compressed_type =
+      Kokkos::Experimental::CompressedView<double*, StorageType,
+                                           TEST_EXECSPACE>;
+  using wide_type = Kokkos::View<double*, TEST_EXECSPACE>;
+
+  compressed_type c;
+  ASSERT_FALSE(c.is_allocated());
+
+  c = compressed_type("c", n);
+  ASSERT_TRUE(c.is_allocated());
+  ASSERT_EQ(c.extent(0), size_t(n));
+  ASSERT_EQ(c.size(), size_t(n));
+  ASSERT_EQ(c.label(), "c");
+  static_assert(
+      std::is_same<typename compressed_type::storage_view_type::value_type,
+                   StorageType>::value,
+      "");
+
+  // Small integers and halves are exact in all storage types
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), KOKKOS_LAMBDA(int i) {
+        c(i) = 0.5 * (i % 64);
+        c(i) += 1.0;
+        c(i) *= 2.0;
+      });
+
+  wide_type w("w", n);
+  Kokkos::deep_copy(w, c);
+  auto w_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(w_h(i), (i % 64) + 2.0);
+  }
+
+  // Round trip through the wide representation
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n),
+      KOKKOS_LAMBDA(int i) { w(i) = -(i % 32); });
+  Kokkos::deep_copy(TEST_EXECSPACE(), c, w);
+  TEST_EXECSPACE().fence();
+
+  auto c_h = Kokkos::create_mirror_view(c);
+  Kokkos::deep_copy(c_h, c);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(double(c_h(i)), -(i % 32));
+  }
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n),
+      KOKKOS_LAMBDA(int i, int& err) {
+        double const v = c(i);
+        if (v != -(i % 32)) ++err;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+void test_compressed_view_rank2(int n) {
+  using storage_type = Kokkos::Experimental::half_t;
+  using compressed_type =
+      Kokkos::Experimental::CompressedView<double* [3], storage_type,
+                                           TEST_EXECSPACE>;
+  using wide_type = Kokkos::View<double* [3], TEST_EXECSPACE>;
+
+  compressed_type c(Kokkos::view_alloc(Kokkos::WithoutInitializing, "c"), n);
+  ASSERT_EQ(c.extent(0), size_t(n));
+  ASSERT_EQ(c.extent(1), size_t(3));
+
+  wide_type w("w", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), KOKKOS_LAMBDA(int i) {
+        for (int j = 0; j < 3; ++j) w(i, j) = j - 0.25 * (i % 8);
+      });
+  Kokkos::deep_copy(c, w);
+
+  // Wrapping the storage View shares the allocation
+  compressed_type alias(c.storage());
+  ASSERT_EQ(alias.data(), c.data());
+
+  wide_type w2("w2", n);
+  Kokkos::deep_copy(w2, alias);
+  auto w_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w);
+  auto w2_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), w2);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < 3; ++j) ASSERT_EQ(w2_h(i, j), w_h(i, j));
+  }
+
+  wide_type mismatch("mismatch", n + 1);
+  ASSERT_THROW(Kokkos::deep_copy(c, mismatch), std::runtime_error);
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, compressed_view) {
+  test_compressed_view_rank1<float>(10);
+  test_compressed_view_rank1<float>(1000);
+  test_compressed_view_rank1<Kokkos::Experimental::half_t>(1000);
+  test_compressed_view_rank1<Kokkos::Experimental::bhalf_t>(1000);
+  test_compressed_view_rank2(100);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_COMPRESSEDVIEW_HPP
@@ -0,0 +1,206 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_TEST_SOAVIEW_HPP
+#define KOKKOS_TEST_SOAVIEW_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SoAView.hpp>
+
+namespace Test {
+
+struct SoAParticle {
+  double x;
+  double y;
+  float w;
+  int id;
+};
+
+}  // namespace Test
+
+namespace Kokkos {
+namespace Experimental {
+template <>
+struct SoAMembers<Test::SoAParticle> {
+  using type = SoAMemberList<KOKKOS_SOA_MEMBER(Test::SoAParticle, x),
+                             KOKKOS_SOA_MEMBER(Test::SoAParticle, y),
+                             KOKKOS_SOA_MEMBER(Test::SoAParticle, w),
+                             KOKKOS_SOA_MEMBER(Test::SoAParticle, id)>;
+};
+}  // namespace Experimental
+}  // namespace Kokkos
+
+namespace Test {
+
+namespace Impl {
+
+template <class AoSView>
+struct FillParticles {
+  AoSView aos;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    aos(i).x  = 1.0 * i;
+    aos(i).y  = 2.0 * i;
+    aos(i).w  = 0.5f * i;
+    aos(i).id = i;
+  }
+};
+
+template <class SoAView>
+struct UpdateParticles {
+  SoAView soa;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    // named access through member pointers
+    soa(i).get(&SoAParticle::x) += 1.0;
+    soa(i)->*(&SoAParticle::y) *= 2.0;
+    // positional access
+    soa(i).template get<3>() += 10;
+    // whole element access
+    SoAParticle p = soa(i);
+    p.w += 1.0f;
+    soa(i) = p;
+  }
+};
+
+template <class SoAView>
+struct CountSoAErrors {
+  SoAView soa;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, int& errors) const {
+    if (soa.template field<0>()(i) != 1.0 * i) ++errors;
+    if (soa.template field<1>()(i) != 2.0 * i) ++errors;
+    if (soa.template field<2>()(i) != 0.5f * i) ++errors;
+    if (soa.template field<3>()(i) != i) ++errors;
+  }
+};
+
+}  // namespace Impl
+
+template <class ExecSpace>
+void test_soa_view(int n) {
+  using aos_type = Kokkos::View<SoAParticle*, ExecSpace>;
+  using soa_type = Kokkos::Experimental::SoAView<SoAParticle*, ExecSpace>;
+
+  static_assert(soa_type::number_of_members == 4, "");
+  static_assert(std::is_same<typename soa_type::template field_type<2>,
+                             Kokkos::View<float*, ExecSpace>>::value,
+                "");
+  static_assert(Kokkos::Experimental::is_soa_view<soa_type>::value, "");
+  static_assert(!Kokkos::Experimental::is_soa_view<aos_type>::value, "");
+
+  soa_type empty;
+  ASSERT_FALSE(empty.is_allocated());
+  ASSERT_EQ(empty.label(), "");
+
+  aos_type aos("aos", n);
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, n),
+                       Impl::FillParticles<aos_type>{aos});
+
+  soa_type soa("soa", n);
+  ASSERT_TRUE(soa.is_allocated());
+  ASSERT_EQ(soa.extent(0), size_t(n));
+  ASSERT_EQ(soa.size(), size_t(n));
+  ASSERT_EQ(soa.label(), "soa");
+  ASSERT_EQ(soa.field(&SoAParticle::y).label(), "soa::1");
+
+  Kokkos::deep_copy(soa, aos);
+
+  // every member array is contiguous and holds the scattered values
+  int errors = 0;
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<ExecSpace>(0, n),
+                          Impl::CountSoAErrors<soa_type>{soa}, errors);
+  ASSERT_EQ(errors, 0);
+  ASSERT_EQ(soa.field(&SoAParticle::w).data(),
+            soa.template field<2>().data());
+
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, n),
+                       Impl::UpdateParticles<soa_type>{soa});
+
+  ExecSpace exec;
+  Kokkos::deep_copy(exec, aos, soa);
+  exec.fence();
+
+  auto aos_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aos);
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(aos_h(i).x, 1.0 * i + 1.0);
+    ASSERT_EQ(aos_h(i).y, 4.0 * i);
+    ASSERT_EQ(aos_h(i).w, 0.5f * i + 1.0f);
+    ASSERT_EQ(aos_h(i).id, i + 10);
+  }
+
+  // member-wise copy between SoAViews in different memory spaces
+  auto soa_h = Kokkos::create_mirror(soa);
+  ASSERT_EQ(soa_h.label(), "soa_mirror");
+  Kokkos::deep_copy(soa_h, soa);
+  for (int i = 0; i < n; ++i) {
+    SoAParticle p = soa_h(i);
+    ASSERT_EQ(p.x, aos_h(i).x);
+    ASSERT_EQ(p.y, aos_h(i).y);
+    ASSERT_EQ(p.w, aos_h(i).w);
+    ASSERT_EQ(p.id, aos_h(i).id);
+    ASSERT_EQ(soa_h(i).get(&SoAParticle::id), aos_h(i).id);
+  }
+
+  // proxy to proxy assignment copies the element
+  soa_h(0) = soa_h(n - 1);
+  ASSERT_EQ(soa_h(0).template get<3>(), n - 1 + 10);
+  ASSERT_EQ(soa_h(1).template get<3>(), 1 + 10);
+
+  Kokkos::View<SoAParticle*, ExecSpace> too_short("too_short", n - 1);
+  ASSERT_THROW(Kokkos::deep_copy(soa, too_short), std::runtime_error);
+}
+
+TEST(TEST_CATEGORY, soa_view) {
+  test_soa_view<TEST_EXECSPACE>(10);
+  test_soa_view<TEST_EXECSPACE>(1000);
+}
+
+}  // namespace Test
+
+#endif /* #ifndef KOKKOS_TEST_SOAVIEW_HPP */
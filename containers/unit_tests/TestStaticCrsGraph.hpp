@@ -275,6 +275,78 @@ void run_test_graph4() {
                             Kokkos::MemoryUnmanaged>::value));
 }
 
+template <class RowMapType, class CountsType>
+struct MergePathVisits {
+  RowMapType row_map;
+  CountsType entry_visits;
+  CountsType row_completions;
+  CountsType errors;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const unsigned row, const unsigned begin,
+                  const unsigned end) const {
+    if (begin > end || begin < row_map(row) || end > row_map(row + 1)) {
+      Kokkos::atomic_increment(&errors(0));
+    }
+    for (unsigned k = begin; k < end; ++k) {
+      Kokkos::atomic_increment(&entry_visits(k));
+    }
+    if (end == row_map(row + 1)) {
+      Kokkos::atomic_increment(&row_completions(row));
+    }
+  }
+};
+
+// Power-law row lengths: many empty and short rows, a few very long ones
+template <class Space>
+void run_test_merge_path(const int num_chunks) {
+  using dView       = Kokkos::StaticCrsGraph<unsigned, Space>;
+  using counts_type = Kokkos::View<int*, Space>;
+
+  const unsigned num_rows = 3000;
+  std::vector<std::vector<unsigned>> input(num_rows);
+  for (unsigned r = 0; r < num_rows; ++r) {
+    const unsigned length = r % 3 == 0 ? 0 : 100000 / ((r * 7919) % 997 + 1);
+    for (unsigned i = 0; i < length; ++i) input[r].push_back(i);
+  }
+  dView graph = Kokkos::create_staticcrsgraph<dView>("graph", input);
+  const unsigned num_entries = graph.entries.extent(0);
+
+  counts_type entry_visits("entry_visits", num_entries);
+  counts_type row_completions("row_completions", num_rows);
+  counts_type errors("errors", 1);
+  auto policy = Kokkos::Experimental::crs_merge_path_policy(
+      Space(), graph.row_map, num_chunks);
+  if (num_chunks > 0) {
+    ASSERT_EQ(policy.num_chunks(), num_chunks);
+  }
+  Kokkos::parallel_for(
+      "merge_path", policy,
+      MergePathVisits<typename dView::row_map_type, counts_type>{
+          graph.row_map, entry_visits, row_completions, errors});
+
+  // Every entry once, every row completed once
+  auto h_entry_visits =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entry_visits);
+  auto h_row_completions =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), row_completions);
+  auto h_errors =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), errors);
+  ASSERT_EQ(h_errors(0), 0);
+  for (unsigned k = 0; k < num_entries; ++k) ASSERT_EQ(h_entry_visits(k), 1);
+  for (unsigned r = 0; r < num_rows; ++r) ASSERT_EQ(h_row_completions(r), 1);
+
+  // The chunks share rows and entries evenly
+  auto h_starts = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      policy.chunk_starts());
+  const double per_chunk = double(num_rows + num_entries) / policy.num_chunks();
+  for (int c = 0; c < policy.num_chunks(); ++c) {
+    const double work = double(h_starts(c + 1, 0) - h_starts(c, 0)) +
+                        double(h_starts(c + 1, 1) - h_starts(c, 1));
+    ASSERT_NEAR(work, per_chunk, 1.0);
+  }
+}
+
 } /* namespace TestStaticCrsGraph */
 
 TEST(TEST_CATEGORY, staticcrsgraph) {
@@ -294,4 +366,11 @@ TEST(TEST_CATEGORY, staticcrsgraph) {
   TestStaticCrsGraph::run_test_graph3<TEST_EXECSPACE>(75, 100000);
   TestStaticCrsGraph::run_test_graph4<TEST_EXECSPACE>();
 }
+
+TEST(TEST_CATEGORY, staticcrsgraph_merge_path) {
+  TestStaticCrsGraph::run_test_merge_path<TEST_EXECSPACE>(0);
+  TestStaticCrsGraph::run_test_merge_path<TEST_EXECSPACE>(1);
+  TestStaticCrsGraph::run_test_merge_path<TEST_EXECSPACE>(7);
+  TestStaticCrsGraph::run_test_merge_path<TEST_EXECSPACE>(1000);
+}
 }  // namespace Test
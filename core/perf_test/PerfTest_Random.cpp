@@ -0,0 +1,206 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <PerfTest_Category.hpp>
+
+namespace Test {
+
+namespace {
+
+using exec_space = Kokkos::DefaultExecutionSpace;
+using pool_type  = Kokkos::Random_XorShift64_Pool<exec_space>;
+
+// Fills samples with draws of the sampler, one pool state per 1024 samples
+template <class Sampler>
+struct DrawSamples {
+  Kokkos::View<double*> samples;
+  pool_type pool;
+  Sampler sampler;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int chunk) const {
+    auto gen    = pool.get_state();
+    const int n = samples.extent(0);
+    for (int i = chunk * 1024; i < n && i < (chunk + 1) * 1024; ++i) {
+      samples(i) = sampler(gen);
+    }
+    pool.free_state(gen);
+  }
+};
+
+template <class Sampler>
+void run_distribution(const char* name, const Sampler& sampler, const int N,
+                      const int R) {
+  Kokkos::View<double*> samples("samples", N);
+  pool_type pool(5374857);
+  DrawSamples<Sampler> functor{samples, pool, sampler};
+  Kokkos::parallel_for("Kokkos::PerfTest::Random", (N + 1023) / 1024,
+                       functor);
+  Kokkos::fence();
+  Kokkos::Timer timer;
+  for (int r = 0; r < R; r++) {
+    Kokkos::parallel_for("Kokkos::PerfTest::Random", (N + 1023) / 1024,
+                         functor);
+  }
+  Kokkos::fence();
+  const double time = timer.seconds() / R;
+  printf("   %-22s %9d   %lf s   %8.2lf Msamples/s\n", name, N, time,
+         1.0e-6 * N / time);
+}
+
+struct Uniform {
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return gen.drand();
+  }
+};
+
+struct Normal {
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return gen.normal();
+  }
+};
+
+struct Exponential {
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_exponential(gen, 2.0);
+  }
+};
+
+struct Gamma {
+  double shape;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_gamma(gen, shape);
+  }
+};
+
+struct Poisson {
+  double mean;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_poisson(gen, mean);
+  }
+};
+
+struct Binomial {
+  int64_t n;
+  double p;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return Kokkos::rand_binomial(gen, n, p);
+  }
+};
+
+struct AliasTable {
+  Kokkos::Random_AliasTable<exec_space> table;
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return table.draw(gen);
+  }
+};
+
+}  // namespace
+
+TEST(default_exec, RandomDistributions) {
+  const int N = 1 << 22;
+  const int R = 5;
+
+  Kokkos::View<double*> weights("weights", 1000);
+  Kokkos::fill_random(weights, pool_type(17), 0.0, 1.0);
+  const AliasTable alias{Kokkos::Random_AliasTable<exec_space>(weights)};
+
+  printf("Drawing from distributions with Random_XorShift64:\n");
+  run_distribution("uniform", Uniform(), N, R);
+  run_distribution("normal", Normal(), N, R);
+  run_distribution("exponential", Exponential(), N, R);
+  run_distribution("gamma(0.5)", Gamma{0.5}, N, R);
+  run_distribution("gamma(4)", Gamma{4.0}, N, R);
+  run_distribution("poisson(4)", Poisson{4.0}, N, R);
+  run_distribution("poisson(1000)", Poisson{1000.0}, N, R);
+  run_distribution("binomial(20,0.3)", Binomial{20, 0.3}, N, R);
+  run_distribution("binomial(10^6,0.5)", Binomial{1000000, 0.5}, N, R);
+  run_distribution("alias table(1000)", alias, N, R);
+}
+
+TEST(default_exec, RandomFill) {
+  const int R = 5;
+  printf("Kokkos::fill_random and Kokkos::fill_random_normal:\n");
+  for (int N = 1 << 16; N <= 1 << 24; N <<= 4) {
+    Kokkos::View<double*> a("a", N);
+    Kokkos::View<float*> b("b", N);
+    Kokkos::View<int*> c("c", N);
+    pool_type pool(5374857);
+    Kokkos::Timer timer;
+    double time[4] = {0, 0, 0, 0};
+    for (int r = 0; r < R; r++) {
+      timer.reset();
+      Kokkos::fill_random(a, pool, 0.0, 1.0);
+      Kokkos::fence();
+      time[0] += timer.seconds();
+      timer.reset();
+      Kokkos::fill_random(b, pool, 0.0f, 1.0f);
+      Kokkos::fence();
+      time[1] += timer.seconds();
+      timer.reset();
+      Kokkos::fill_random(c, pool, 0, 1000);
+      Kokkos::fence();
+      time[2] += timer.seconds();
+      timer.reset();
+      Kokkos::fill_random_normal(a, pool);
+      Kokkos::fence();
+      time[3] += timer.seconds();
+    }
+    printf("   %9d   double %lf s   float %lf s   int %lf s   normal %lf s\n",
+           N, time[0] / R, time[1] / R, time[2] / R, time[3] / R);
+  }
+}
+
+}  // namespace Test
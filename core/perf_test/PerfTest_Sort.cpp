@@ -0,0 +1,161 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <PerfTest_Category.hpp>
+
+namespace Test {
+
+namespace {
+
+template <class KeyType>
+struct LessThan {
+  KOKKOS_INLINE_FUNCTION
+  bool operator()(const KeyType& a, const KeyType& b) const { return a < b; }
+};
+
+// Times sorting a copy of keys with the given sorter, averaged over R runs
+template <class ViewType, class Sorter>
+double time_sort(const ViewType& keys, const int R, Sorter sorter) {
+  ViewType work("work", keys.extent(0));
+  double time = 0;
+  for (int r = 0; r < R; r++) {
+    Kokkos::deep_copy(work, keys);
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    sorter(work);
+    Kokkos::fence();
+    time += timer.seconds();
+  }
+  return time / R;
+}
+
+template <class KeyType>
+void run_sort(const char* type_name, const int N, const int R, KeyType range) {
+  using view_type  = Kokkos::View<KeyType*>;
+  using exec_space = typename view_type::execution_space;
+
+  view_type keys("keys", N);
+  Kokkos::Random_XorShift64_Pool<exec_space> pool(5374857);
+  Kokkos::fill_random(keys, pool, KeyType(-range), range);
+
+  const double radix = time_sort(keys, R, [](const view_type& v) {
+    exec_space exec;
+    Kokkos::Impl::RadixSort<exec_space, view_type> sorter(exec, v);
+    sorter.sort(exec);
+  });
+  const double bin =
+      time_sort(keys, R, [](const view_type& v) { Kokkos::sort(v, true); });
+  const double merge = time_sort(keys, R, [](const view_type& v) {
+    Kokkos::sort(v, LessThan<KeyType>());
+  });
+
+  printf("   %-6s %9d   radix %lf s   BinSort %lf s   merge %lf s", type_name,
+         N, radix, bin, merge);
+  if (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 typename view_type::memory_space>::
+          accessible) {
+    const double stl = time_sort(keys, R, [](const view_type& v) {
+      std::sort(v.data(), v.data() + v.extent(0));
+    });
+    printf("   std::sort %lf s", stl);
+  }
+  printf("\n");
+}
+
+// Keys packed into a few narrow clusters, so that a BinSort over the key
+// range puts most keys into a handful of large bins
+void run_clustered_bin_sort(const int N, const int num_bins, const int R) {
+  using view_type  = Kokkos::View<double*>;
+  using exec_space = typename view_type::execution_space;
+  using bin_op     = Kokkos::BinOp1D<view_type>;
+
+  view_type keys("keys", N);
+  Kokkos::Random_XorShift64_Pool<exec_space> pool(5374857);
+  Kokkos::fill_random(keys, pool, 0.0, 1.0);
+  Kokkos::parallel_for(
+      "Kokkos::PerfTest::Cluster", N, KOKKOS_LAMBDA(const int i) {
+        keys(i) = (i % 8) * (num_bins / 8) + keys(i);
+      });
+
+  const double time = time_sort(keys, R, [num_bins](const view_type& v) {
+    Kokkos::BinSort<view_type, bin_op> bin_sort(
+        v, bin_op(num_bins, 0.0, double(num_bins)), true);
+    bin_sort.create_permute_vector();
+    bin_sort.sort(v);
+  });
+  printf("   %9d keys in 8 of %6d bins   BinSort %lf s\n", N, num_bins,
+         time);
+}
+
+}  // namespace
+
+TEST(default_exec, SortClusteredBins) {
+  const int R = 3;
+  printf("Sorting clustered keys within bins:\n");
+  for (int N = 1 << 14; N <= 1 << 20; N <<= 2) {
+    run_clustered_bin_sort(N, 8, R);
+    run_clustered_bin_sort(N, 64, R);
+  }
+}
+
+TEST(default_exec, Sort) {
+  const int R = 5;
+  printf("Sorting random keys, Kokkos::sort switches to radix sort at %d, ",
+         int(Kokkos::Impl::radix_sort_min_size));
+  printf("merge sort is Kokkos::sort with a comparator:\n");
+  for (int N = 1 << 12; N <= 1 << 22; N <<= 2) {
+    run_sort<int>("int", N, R, 1 << 29);
+    run_sort<int64_t>("int64", N, R, int64_t(1) << 61);
+    run_sort<float>("float", N, R, 1.0e6f);
+    run_sort<double>("double", N, R, 1.0e6);
+  }
+}
+
+}  // namespace Test
@@ -0,0 +1,158 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <PerfTest_Category.hpp>
+
+namespace Test {
+
+namespace {
+
+template <class ViewType>
+struct Stencil7Point {
+  ViewType dst;
+  typename ViewType::const_type src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j, const int k) const {
+    dst(i, j, k) = src(i - 1, j, k) + src(i + 1, j, k) + src(i, j - 1, k) +
+                   src(i, j + 1, k) + src(i, j, k - 1) + src(i, j, k + 1) -
+                   6.0 * src(i, j, k);
+  }
+};
+
+template <class ViewType>
+struct Stencil5Point {
+  ViewType dst;
+  typename ViewType::const_type src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j) const {
+    dst(i, j) = src(i - 1, j) + src(i + 1, j) + src(i, j - 1) + src(i, j + 1) -
+                4.0 * src(i, j);
+  }
+};
+
+template <class Layout>
+double run_stencil_3d(const int N, const int R) {
+  using view_type = Kokkos::View<double***, Layout>;
+  using policy    = Kokkos::MDRangePolicy<Kokkos::Rank<3>>;
+
+  view_type a("A", N, N, N);
+  view_type b("B", N, N, N);
+  Kokkos::deep_copy(a, 1.0);
+
+  Stencil7Point<view_type> functor{b, a};
+  Kokkos::parallel_for("Kokkos::PerfTest::Stencil3D",
+                       policy({1, 1, 1}, {N - 1, N - 1, N - 1}), functor);
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  for (int r = 0; r < R; r++) {
+    Kokkos::parallel_for("Kokkos::PerfTest::Stencil3D",
+                         policy({1, 1, 1}, {N - 1, N - 1, N - 1}), functor);
+  }
+  Kokkos::fence();
+  return timer.seconds() / R;
+}
+
+template <class Layout>
+double run_stencil_2d(const int N, const int R) {
+  using view_type = Kokkos::View<double**, Layout>;
+  using policy    = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+
+  view_type a("A", N, N);
+  view_type b("B", N, N);
+  Kokkos::deep_copy(a, 1.0);
+
+  Stencil5Point<view_type> functor{b, a};
+  Kokkos::parallel_for("Kokkos::PerfTest::Stencil2D",
+                       policy({1, 1}, {N - 1, N - 1}), functor);
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  for (int r = 0; r < R; r++) {
+    Kokkos::parallel_for("Kokkos::PerfTest::Stencil2D",
+                         policy({1, 1}, {N - 1, N - 1}), functor);
+  }
+  Kokkos::fence();
+  return timer.seconds() / R;
+}
+
+void print_stencil_result(const char* name, double time, double points) {
+  printf("   %-13s %lf s   %lf Gpoints/s\n", name, time,
+         points / time / 1.0e9);
+}
+
+}  // namespace
+
+TEST(default_exec, ViewLayoutStencil) {
+  const int N3 = 128;
+  const int N2 = 2048;
+  const int R  = 10;
+
+  const double points3 = 1.0 * (N3 - 2) * (N3 - 2) * (N3 - 2);
+  printf("7-point stencil on %d^3 grid:\n", N3);
+  print_stencil_result("LayoutLeft:", run_stencil_3d<Kokkos::LayoutLeft>(N3, R),
+                       points3);
+  print_stencil_result("LayoutRight:",
+                       run_stencil_3d<Kokkos::LayoutRight>(N3, R), points3);
+  print_stencil_result(
+      "LayoutMorton:",
+      run_stencil_3d<Kokkos::Experimental::LayoutMorton>(N3, R), points3);
+
+  const double points2 = 1.0 * (N2 - 2) * (N2 - 2);
+  printf("5-point stencil on %d^2 grid:\n", N2);
+  print_stencil_result("LayoutLeft:", run_stencil_2d<Kokkos::LayoutLeft>(N2, R),
+                       points2);
+  print_stencil_result("LayoutRight:",
+                       run_stencil_2d<Kokkos::LayoutRight>(N2, R), points2);
+  print_stencil_result(
+      "LayoutMorton:",
+      run_stencil_2d<Kokkos::Experimental::LayoutMorton>(N2, R), points2);
+}
+
+}  // namespace Test
@@ -0,0 +1,127 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <PerfTest_Category.hpp>
+
+namespace Test {
+
+namespace {
+
+constexpr int block_size = 8;
+
+// y(e, :) = A(e, :, :) * x(e, :) for a batch of small dense blocks. With
+// static inner extents the offsets of A(e, i, j) fold to e * 64 + i * 8 + j,
+// leaving no index arithmetic in the inner loops.
+template <class MatrixType, class VectorType>
+struct BatchedGemv {
+  typename MatrixType::const_type A;
+  typename VectorType::const_type x;
+  VectorType y;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int e) const {
+    for (int i = 0; i < block_size; ++i) {
+      double sum = 0;
+      for (int j = 0; j < block_size; ++j) sum += A(e, i, j) * x(e, j);
+      y(e, i) = sum;
+    }
+  }
+};
+
+template <class MatrixType, class VectorType>
+double run_batched_gemv(const MatrixType& A, const VectorType& x,
+                        const VectorType& y, const int R) {
+  Kokkos::deep_copy(A, 1.0);
+  Kokkos::deep_copy(x, 2.0);
+
+  const int E = A.extent(0);
+  BatchedGemv<MatrixType, VectorType> functor{A, x, y};
+  Kokkos::parallel_for("Kokkos::PerfTest::BatchedGemv", E, functor);
+  Kokkos::fence();
+
+  Kokkos::Timer timer;
+  for (int r = 0; r < R; r++) {
+    Kokkos::parallel_for("Kokkos::PerfTest::BatchedGemv", E, functor);
+  }
+  Kokkos::fence();
+  return timer.seconds() / R;
+}
+
+void print_gemv_result(const char* name, double time, double flops) {
+  printf("   %-16s %lf s   %lf GFlop/s\n", name, time, flops / time / 1.0e9);
+}
+
+}  // namespace
+
+TEST(default_exec, ViewStaticExtents) {
+  const int E = 100000;
+  const int R = 10;
+
+  const double flops = 2.0 * E * block_size * block_size;
+  printf("Batched %dx%d gemv over %d blocks:\n", block_size, block_size, E);
+
+  {
+    using matrix_type = Kokkos::View<double * [block_size][block_size]>;
+    using vector_type = Kokkos::View<double * [block_size]>;
+    print_gemv_result("static extents:",
+                      run_batched_gemv(matrix_type("A", E), vector_type("x", E),
+                                       vector_type("y", E), R),
+                      flops);
+  }
+  {
+    using matrix_type = Kokkos::View<double***>;
+    using vector_type = Kokkos::View<double**>;
+    print_gemv_result(
+        "dynamic extents:",
+        run_batched_gemv(matrix_type("A", E, block_size, block_size),
+                         vector_type("x", E, block_size),
+                         vector_type("y", E, block_size), R),
+        flops);
+  }
+}
+
+}  // namespace Test
@@ -301,6 +301,48 @@ struct LayoutTiled {
   }
 };
 
+//----------------------------------------------------------------------------
+/// \struct LayoutMorton
+/// \brief Memory layout tag indicating a Morton (Z-order) space-filling
+///   curve ordering of multi-indices.
+///
+/// The bits of the indices are interleaved, i0 taking the lowest bit, so
+/// that entries which are close in any direction are also close in memory.
+/// This favours neighbour-access kernels (stencils) on rank-2 and rank-3
+/// arrays, the only ranks this layout supports.  When the extents
+/// differ, bits of the longer dimensions which have no counterpart in the
+/// shorter ones are appended as the most significant bits.  Each extent is
+/// padded to a power of two, hence the span may exceed the size.
+struct LayoutMorton {
+  //! Tag this class as a kokkos array layout
+  using array_layout = LayoutMorton;
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  LayoutMorton(LayoutMorton const&) = default;
+  LayoutMorton(LayoutMorton&&)      = default;
+  LayoutMorton& operator=(LayoutMorton const&) = default;
+  LayoutMorton& operator=(LayoutMorton&&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr LayoutMorton(size_t N0 = 0, size_t N1 = 0, size_t N2 = 0,
+                                  size_t N3 = 0, size_t N4 = 0, size_t N5 = 0,
+                                  size_t N6 = 0, size_t N7 = 0)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+
+  friend bool operator==(const LayoutMorton& left, const LayoutMorton& right) {
+    for (unsigned int rank = 0; rank < ARRAY_LAYOUT_MAX_RANK; ++rank)
+      if (left.dimension[rank] != right.dimension[rank]) return false;
+    return true;
+  }
+
+  friend bool operator!=(const LayoutMorton& left, const LayoutMorton& right) {
+    return !(left == right);
+  }
+};
+
 }  // namespace Experimental
 
 // For use with view_copy
@@ -497,6 +497,7 @@ constexpr bool is_assignable(const Kokkos::View<ViewTDst...>& dst,
 
 #include <impl/Kokkos_ViewMapping.hpp>
 #include <impl/Kokkos_ViewArray.hpp>
+#include <impl/Kokkos_ViewLayoutMorton.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -0,0 +1,276 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_EXPERIMENTAL_VIEWLAYOUTMORTON_HPP
+#define KOKKOS_EXPERIMENTAL_VIEWLAYOUTMORTON_HPP
+
+#include <Kokkos_Layout.hpp>
+
+#include <cstdint>
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+// Insert one zero bit between each of the lower 32 bits of x
+KOKKOS_INLINE_FUNCTION constexpr uint64_t morton_spread_by_1(uint64_t x) {
+  x &= 0x00000000ffffffffULL;
+  x = (x | (x << 16)) & 0x0000ffff0000ffffULL;
+  x = (x | (x << 8)) & 0x00ff00ff00ff00ffULL;
+  x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  x = (x | (x << 2)) & 0x3333333333333333ULL;
+  x = (x | (x << 1)) & 0x5555555555555555ULL;
+  return x;
+}
+
+// Insert two zero bits between each of the lower 21 bits of x
+KOKKOS_INLINE_FUNCTION constexpr uint64_t morton_spread_by_2(uint64_t x) {
+  x &= 0x00000000001fffffULL;
+  x = (x | (x << 32)) & 0x001f00000000ffffULL;
+  x = (x | (x << 16)) & 0x001f0000ff0000ffULL;
+  x = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+  x = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+  x = (x | (x << 2)) & 0x1249249249249249ULL;
+  return x;
+}
+
+// Number of bits needed to index [0,n), i.e. ceil(log2(n))
+KOKKOS_INLINE_FUNCTION constexpr unsigned morton_index_bits(size_t n) {
+  unsigned bits = 0;
+  while ((size_t(1) << bits) < n) ++bits;
+  return bits;
+}
+
+/** \brief  Offset for LayoutMorton.
+ *
+ *  Rank 2, with b the number of bits of the shorter extent:
+ *    [ high bits of the longer index | interleave(i1, i0) over b bits ]
+ *
+ *  Rank 3, with b0 <= b1 <= b2 the sorted bit counts of the extents:
+ *    [ bits >= b1 of the longest index
+ *    | interleave of the two longest indices over bits [b0, b1)
+ *    | interleave(i2, i1, i0) over b0 bits ]
+ *
+ *  Indices which have no bits in a segment contribute nothing to it, hence
+ *  every segment can be computed without branching on which extent is the
+ *  longest.
+ */
+template <class Dimension>
+struct ViewOffset<
+    Dimension, Kokkos::Experimental::LayoutMorton,
+    typename std::enable_if<(Dimension::rank == 2 ||
+                             Dimension::rank == 3)>::type> {
+ public:
+  // Is an irregular layout that does not have uniform striding for each index.
+  using is_mapping_plugin = std::true_type;
+  using is_regular        = std::false_type;
+
+  using size_type      = size_t;
+  using dimension_type = Dimension;
+  using array_layout   = Kokkos::Experimental::LayoutMorton;
+
+  dimension_type m_dim;
+  unsigned m_low_bits;     // bits interleaved between all indices
+  unsigned m_mid_bits;     // rank 3: bits interleaved between two indices
+  unsigned m_high_shift;   // position of the non-interleaved bits
+  unsigned m_mid_slot[3];  // rank 3: position of each index in mid segment
+  uint64_t m_low_mask;
+  uint64_t m_mid_mask;
+  size_type m_span;
+
+  //----------------------------------------
+
+  template <typename I0, typename I1>
+  KOKKOS_INLINE_FUNCTION size_type operator()(I0 const& i0,
+                                              I1 const& i1) const {
+    const uint64_t j0 = static_cast<uint64_t>(i0);
+    const uint64_t j1 = static_cast<uint64_t>(i1);
+    return morton_spread_by_1(j0 & m_low_mask) |
+           (morton_spread_by_1(j1 & m_low_mask) << 1) |
+           (((j0 | j1) >> m_low_bits) << m_high_shift);
+  }
+
+  template <typename I0, typename I1, typename I2>
+  KOKKOS_INLINE_FUNCTION size_type operator()(I0 const& i0, I1 const& i1,
+                                              I2 const& i2) const {
+    const uint64_t j0 = static_cast<uint64_t>(i0);
+    const uint64_t j1 = static_cast<uint64_t>(i1);
+    const uint64_t j2 = static_cast<uint64_t>(i2);
+    const uint64_t low = morton_spread_by_2(j0 & m_low_mask) |
+                         (morton_spread_by_2(j1 & m_low_mask) << 1) |
+                         (morton_spread_by_2(j2 & m_low_mask) << 2);
+    const uint64_t mid =
+        (morton_spread_by_1((j0 >> m_low_bits) & m_mid_mask) << m_mid_slot[0]) |
+        (morton_spread_by_1((j1 >> m_low_bits) & m_mid_mask) << m_mid_slot[1]) |
+        (morton_spread_by_1((j2 >> m_low_bits) & m_mid_mask) << m_mid_slot[2]);
+    const unsigned high_bits = m_low_bits + m_mid_bits;
+    return low | (mid << (3 * m_low_bits)) |
+           (((j0 | j1 | j2) >> high_bits) << m_high_shift);
+  }
+
+  //----------------------------------------
+
+  KOKKOS_INLINE_FUNCTION constexpr array_layout layout() const {
+    return array_layout(m_dim.N0, m_dim.N1, m_dim.N2, m_dim.N3, m_dim.N4,
+                        m_dim.N5, m_dim.N6, m_dim.N7);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_0() const {
+    return m_dim.N0;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_1() const {
+    return m_dim.N1;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_2() const {
+    return m_dim.N2;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_3() const {
+    return m_dim.N3;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_4() const {
+    return m_dim.N4;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_5() const {
+    return m_dim.N5;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_6() const {
+    return m_dim.N6;
+  }
+  KOKKOS_INLINE_FUNCTION constexpr size_type dimension_7() const {
+    return m_dim.N7;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type size() const {
+    return m_dim.N0 * m_dim.N1 * m_dim.N2 * m_dim.N3 * m_dim.N4 * m_dim.N5 *
+           m_dim.N6 * m_dim.N7;
+  }
+
+  // Strides are meaningless due to irregularity
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_0() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_1() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_2() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_3() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_4() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_5() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_6() const { return 0; }
+  KOKKOS_INLINE_FUNCTION constexpr size_type stride_7() const { return 0; }
+
+  // Stride with [ rank ] value is the total length
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION void stride(iType* const s) const {
+    for (unsigned r = 0; r <= dimension_type::rank; ++r) s[r] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr size_type span() const { return m_span; }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool span_is_contiguous() const {
+    return m_span == size();
+  }
+
+  //----------------------------------------
+
+  KOKKOS_DEFAULTED_FUNCTION ~ViewOffset()                 = default;
+  KOKKOS_DEFAULTED_FUNCTION ViewOffset()                  = default;
+  KOKKOS_DEFAULTED_FUNCTION ViewOffset(const ViewOffset&) = default;
+  KOKKOS_DEFAULTED_FUNCTION ViewOffset& operator=(const ViewOffset&) = default;
+
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION ViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const&,
+      array_layout const arg_layout)
+      : m_dim(arg_layout.dimension[0], arg_layout.dimension[1],
+              arg_layout.dimension[2], arg_layout.dimension[3],
+              arg_layout.dimension[4], arg_layout.dimension[5],
+              arg_layout.dimension[6], arg_layout.dimension[7]),
+        m_low_bits(0),
+        m_mid_bits(0),
+        m_high_shift(0),
+        m_mid_slot{0, 0, 0},
+        m_low_mask(0),
+        m_mid_mask(0),
+        m_span(0) {
+    constexpr unsigned rank = dimension_type::rank;
+
+    unsigned bits[3] = {morton_index_bits(m_dim.N0),
+                        morton_index_bits(m_dim.N1),
+                        rank == 3 ? morton_index_bits(m_dim.N2) : 0u};
+
+    unsigned total_bits = bits[0] + bits[1] + bits[2];
+    unsigned min_bits   = bits[0] < bits[1] ? bits[0] : bits[1];
+    if (rank == 3 && bits[2] < min_bits) min_bits = bits[2];
+
+    m_low_bits = min_bits;
+    m_low_mask = (uint64_t(1) << m_low_bits) - 1;
+
+    if (rank == 2) {
+      m_high_shift = 2 * m_low_bits;
+    } else {
+      // The smallest index has no bits left beyond the low segment; the two
+      // others share the mid segment in index order.
+      unsigned smallest = bits[0] == min_bits ? 0 : bits[1] == min_bits ? 1 : 2;
+      unsigned mid_bits = ~0u;
+      unsigned slot     = 0;
+      for (unsigned r = 0; r < 3; ++r) {
+        if (r == smallest) continue;
+        m_mid_slot[r] = slot++;
+        if (bits[r] < mid_bits) mid_bits = bits[r];
+      }
+      m_mid_bits   = mid_bits - m_low_bits;
+      m_mid_mask   = (uint64_t(1) << m_mid_bits) - 1;
+      m_high_shift = 3 * m_low_bits + 2 * m_mid_bits;
+    }
+
+    m_span = size() == 0 ? 0 : size_type(1) << total_bits;
+  }
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+#endif /* #ifndef KOKKOS_EXPERIMENTAL_VIEWLAYOUTMORTON_HPP */
@@ -3731,6 +3731,21 @@ struct SubViewDataTypeImpl<
 template <class ValueType, class Exts, class... Args>
 struct SubViewDataType : SubViewDataTypeImpl<void, ValueType, Exts, Args...> {};
 
+/* data type of a static rank 2 subview whose leading extent is made dynamic,
+ * only instantiated when that is needed */
+template <bool NeedsRuntimeStride, class ValueType, class StaticDataType,
+          class StaticDimension>
+struct SubViewRuntimeStrideDataType {
+  using type = StaticDataType;
+};
+
+template <class ValueType, class StaticDataType, class StaticDimension>
+struct SubViewRuntimeStrideDataType<true, ValueType, StaticDataType,
+                                    StaticDimension> {
+  using type = typename ApplyExtent<ValueType*,
+                                    ptrdiff_t(StaticDimension::ArgN1)>::type;
+};
+
 //----------------------------------------------------------------------------
 
 template <class SrcTraits, class... Args>
@@ -3811,12 +3826,34 @@ class ViewMapping<
 
   using value_type = typename SrcTraits::value_type;
 
-  using data_type =
+  using static_data_type =
       typename SubViewDataType<value_type,
                                typename Kokkos::Impl::ParseViewExtents<
                                    typename SrcTraits::data_type>::type,
                                Args...>::type;
 
+  using static_dimension =
+      typename ViewArrayAnalysis<static_data_type>::dimension;
+
+  // A rank 2 subview keeping the source layout without being contiguous,
+  // e.g. subview(View<T[N][N][N]>, ALL, i, ALL), needs the runtime stride of
+  // its leading dimension. If all its extents are static make the leading one
+  // dynamic so that the striding offset is used, the inner extent stays
+  // static.
+  enum {
+    needs_runtime_stride =
+        rank == 2 && 0 == static_dimension::rank_dynamic &&
+        !std::is_same<array_layout, Kokkos::LayoutStride>::value &&
+        !SubviewLegalArgsCompileTime<typename SrcTraits::array_layout,
+                                     typename SrcTraits::array_layout, rank,
+                                     SrcTraits::rank, 0, Args...>::value
+  };
+
+  using data_type =
+      typename SubViewRuntimeStrideDataType<needs_runtime_stride, value_type,
+                                            static_data_type,
+                                            static_dimension>::type;
+
  public:
   using traits_type = Kokkos::ViewTraits<data_type, array_layout,
                                          typename SrcTraits::device_type,
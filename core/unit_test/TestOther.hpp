@@ -50,6 +50,7 @@
 #include <TestCXX11.hpp>
 
 #include <TestViewCtorPropEmbeddedDim.hpp>
+#include <TestViewLayoutMorton.hpp>
 // with VS 16.11.3 and CUDA 11.4.2 getting cudafe stackoverflow crash
 #if !(defined(_WIN32) && defined(KOKKOS_ENABLE_CUDA))
 #include <TestViewLayoutTiled.hpp>
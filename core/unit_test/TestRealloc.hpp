@@ -51,6 +51,8 @@ namespace TestViewRealloc {
 
 struct Default {};
 struct WithoutInitializing {};
+struct ExecSpaceInstance {};
+struct ExecSpaceInstanceWithoutInitializing {};
 
 template <typename View, typename... Args>
 inline void realloc_dispatch(Default, View& v, Args&&... args) {
@@ -62,6 +64,22 @@ inline void realloc_dispatch(WithoutInitializing, View& v, Args&&... args) {
   Kokkos::realloc(Kokkos::WithoutInitializing, v, std::forward<Args>(args)...);
 }
 
+template <typename View, typename... Args>
+inline void realloc_dispatch(ExecSpaceInstance, View& v, Args&&... args) {
+  typename View::execution_space exec;
+  Kokkos::realloc(exec, v, std::forward<Args>(args)...);
+  exec.fence();
+}
+
+template <typename View, typename... Args>
+inline void realloc_dispatch(ExecSpaceInstanceWithoutInitializing, View& v,
+                             Args&&... args) {
+  typename View::execution_space exec;
+  Kokkos::realloc(Kokkos::WithoutInitializing, exec, v,
+                  std::forward<Args>(args)...);
+  exec.fence();
+}
+
 template <class DeviceType, class Tag = Default>
 void impl_testRealloc() {
   const size_t sizes[8] = {2, 3, 4, 5, 6, 7, 8, 9};
@@ -158,6 +176,12 @@ void testRealloc() {
     impl_testRealloc<DeviceType,
                      WithoutInitializing>();  // without data initialization
   }
+  {
+    impl_testRealloc<DeviceType, ExecSpaceInstance>();
+  }
+  {
+    impl_testRealloc<DeviceType, ExecSpaceInstanceWithoutInitializing>();
+  }
 }
 
 }  // namespace TestViewRealloc
@@ -51,6 +51,8 @@ namespace TestViewResize {
 
 struct Default {};
 struct WithoutInitializing {};
+struct ExecSpaceInstance {};
+struct ExecSpaceInstanceWithoutInitializing {};
 
 template <typename View, typename... Args>
 inline void resize_dispatch(Default, View& v, Args&&... args) {
@@ -62,6 +64,22 @@ inline void resize_dispatch(WithoutInitializing, View& v, Args&&... args) {
   Kokkos::resize(Kokkos::WithoutInitializing, v, std::forward<Args>(args)...);
 }
 
+template <typename View, typename... Args>
+inline void resize_dispatch(ExecSpaceInstance, View& v, Args&&... args) {
+  typename View::execution_space exec;
+  Kokkos::resize(exec, v, std::forward<Args>(args)...);
+  exec.fence();
+}
+
+template <typename View, typename... Args>
+inline void resize_dispatch(ExecSpaceInstanceWithoutInitializing, View& v,
+                            Args&&... args) {
+  typename View::execution_space exec;
+  Kokkos::resize(Kokkos::WithoutInitializing, exec, v,
+                 std::forward<Args>(args)...);
+  exec.fence();
+}
+
 template <class DeviceType, class Tag = Default>
 void impl_testResize() {
   const size_t sizes[8] = {2, 3, 4, 5, 6, 7, 8, 9};
@@ -395,6 +413,12 @@ void testResize() {
     impl_testResize<DeviceType,
                     WithoutInitializing>();  // without data initialization
   }
+  {
+    impl_testResize<DeviceType, ExecSpaceInstance>();
+  }
+  {
+    impl_testResize<DeviceType, ExecSpaceInstanceWithoutInitializing>();
+  }
 }
 
 }  // namespace TestViewResize
@@ -868,6 +868,33 @@ struct TestViewMirror {
                                                     view_const_cast(v));
   }
 
+  static void test_mirror_copy_on_instance() {
+    using ExecutionSpace = typename DeviceType::execution_space;
+    int const N          = 100;
+    Kokkos::View<int *, ExecutionSpace> v("v", N);
+    Kokkos::deep_copy(v, 255);
+
+    ExecutionSpace exec;
+    auto v_h = Kokkos::create_mirror_view_and_copy(exec, Kokkos::HostSpace(),
+                                                   v, "v_h");
+    auto v_d =
+        Kokkos::create_mirror_view_and_copy(exec, ExecutionSpace(), v_h);
+    exec.fence();
+
+    int is_same_memspace =
+        std::is_same<Kokkos::HostSpace,
+                     typename DeviceType::memory_space>::value
+            ? 1
+            : 0;
+    ASSERT_EQ(v_h.data() == v.data() ? 1 : 0, is_same_memspace);
+    ASSERT_EQ(v_d.data() == v_h.data() ? 1 : 0, is_same_memspace);
+    ASSERT_EQ(v_h.extent(0), v.extent(0));
+    for (int i = 0; i < N; ++i) ASSERT_EQ(v_h(i), 255);
+
+    auto v_d_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v_d);
+    for (int i = 0; i < N; ++i) ASSERT_EQ(v_d_h(i), 255);
+  }
+
   template <class MemoryTraits, class Space>
   struct CopyUnInit {
     using mirror_view_type = typename Kokkos::Impl::MirrorViewType<
@@ -923,6 +950,7 @@ struct TestViewMirror {
     test_mirror_copy<Kokkos::MemoryTraits<0> >();
     test_mirror_copy<Kokkos::MemoryTraits<Kokkos::Unmanaged> >();
     test_mirror_copy_const_data_type();
+    test_mirror_copy_on_instance();
     test_allocated();
     test_mirror_no_initialize<Kokkos::MemoryTraits<0> >();
     test_mirror_no_initialize<Kokkos::MemoryTraits<Kokkos::Unmanaged> >();
@@ -0,0 +1,225 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Christian R. Trott (crtrott@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Test {
+
+namespace {
+
+using LayoutMorton = Kokkos::Experimental::LayoutMorton;
+
+template <class ViewType>
+std::vector<size_t> morton_offsets(const ViewType& v) {
+  std::vector<size_t> offsets;
+  if (ViewType::rank == 2) {
+    for (size_t i0 = 0; i0 < v.extent(0); ++i0)
+      for (size_t i1 = 0; i1 < v.extent(1); ++i1)
+        offsets.push_back(v.impl_map().m_impl_offset(i0, i1));
+  } else {
+    for (size_t i0 = 0; i0 < v.extent(0); ++i0)
+      for (size_t i1 = 0; i1 < v.extent(1); ++i1)
+        for (size_t i2 = 0; i2 < v.extent(2); ++i2)
+          offsets.push_back(v.impl_map().m_impl_offset(i0, i1, i2));
+  }
+  return offsets;
+}
+
+// Every index must map to a distinct location within the span
+template <class ViewType>
+void check_morton_offsets_unique(const ViewType& v) {
+  auto offsets = morton_offsets(v);
+  ASSERT_EQ(offsets.size(), v.size());
+  std::sort(offsets.begin(), offsets.end());
+  ASSERT_TRUE(std::adjacent_find(offsets.begin(), offsets.end()) ==
+              offsets.end());
+  if (!offsets.empty()) {
+    ASSERT_LT(offsets.back(), v.span());
+  }
+}
+
+template <class DstView, class SrcView>
+struct MortonStencil2D {
+  DstView dst;
+  SrcView src;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, const int j) const {
+    dst(i, j) = src(i - 1, j) + src(i + 1, j) + src(i, j - 1) + src(i, j + 1) -
+                4 * src(i, j);
+  }
+};
+
+template <class ExecSpace>
+void test_view_layout_morton_2d(int N0, int N1) {
+  using morton_view = Kokkos::View<double**, LayoutMorton, ExecSpace>;
+  using right_view  = Kokkos::View<double**, Kokkos::LayoutRight, ExecSpace>;
+
+  right_view a_right("a_right", N0, N1);
+  auto a_right_h = Kokkos::create_mirror_view(a_right);
+  for (int i = 0; i < N0; ++i)
+    for (int j = 0; j < N1; ++j) a_right_h(i, j) = (i * 3 + j) % 17 + 0.25 * i;
+  Kokkos::deep_copy(a_right, a_right_h);
+
+  morton_view a_morton("a_morton", N0, N1);
+  ASSERT_EQ(a_morton.extent(0), size_t(N0));
+  ASSERT_EQ(a_morton.extent(1), size_t(N1));
+  ASSERT_GE(a_morton.span(), a_morton.size());
+  Kokkos::deep_copy(a_morton, a_right);
+
+  morton_view b_morton("b_morton", N0, N1);
+  right_view b_right("b_right", N0, N1);
+  using policy = Kokkos::MDRangePolicy<ExecSpace, Kokkos::Rank<2>>;
+  Kokkos::parallel_for(
+      policy({1, 1}, {N0 - 1, N1 - 1}),
+      MortonStencil2D<morton_view, morton_view>{b_morton, a_morton});
+  Kokkos::parallel_for(
+      policy({1, 1}, {N0 - 1, N1 - 1}),
+      MortonStencil2D<right_view, right_view>{b_right, a_right});
+
+  right_view c_right("c_right", N0, N1);
+  Kokkos::deep_copy(c_right, b_morton);
+
+  auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b_right);
+  auto c_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), c_right);
+  auto m_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a_morton);
+  for (int i = 0; i < N0; ++i) {
+    for (int j = 0; j < N1; ++j) {
+      ASSERT_EQ(b_h(i, j), c_h(i, j));
+      ASSERT_EQ(m_h(i, j), a_right_h(i, j));
+    }
+  }
+  check_morton_offsets_unique(m_h);
+}
+
+template <class ExecSpace>
+void test_view_layout_morton_3d(int N0, int N1, int N2) {
+  using morton_view = Kokkos::View<int***, LayoutMorton, ExecSpace>;
+  using left_view   = Kokkos::View<int***, Kokkos::LayoutLeft, ExecSpace>;
+
+  left_view a_left("a_left", N0, N1, N2);
+  auto a_left_h = Kokkos::create_mirror_view(a_left);
+  for (int i = 0; i < N0; ++i)
+    for (int j = 0; j < N1; ++j)
+      for (int k = 0; k < N2; ++k) a_left_h(i, j, k) = i + 100 * j + 10000 * k;
+  Kokkos::deep_copy(a_left, a_left_h);
+
+  morton_view a_morton("a_morton", N0, N1, N2);
+  Kokkos::deep_copy(a_morton, a_left);
+
+  auto m_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), a_morton);
+  left_view b_left("b_left", N0, N1, N2);
+  Kokkos::deep_copy(b_left, a_morton);
+  auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), b_left);
+  for (int i = 0; i < N0; ++i)
+    for (int j = 0; j < N1; ++j)
+      for (int k = 0; k < N2; ++k) {
+        ASSERT_EQ(m_h(i, j, k), a_left_h(i, j, k));
+        ASSERT_EQ(b_h(i, j, k), a_left_h(i, j, k));
+      }
+  check_morton_offsets_unique(m_h);
+}
+
+}  // namespace
+
+TEST(TEST_CATEGORY, view_layout_morton_offsets) {
+  Kokkos::View<int**, LayoutMorton, Kokkos::HostSpace> a("a", 4, 4);
+  auto const& offset = a.impl_map().m_impl_offset;
+  ASSERT_EQ(a.span(), 16u);
+  ASSERT_TRUE(a.span_is_contiguous());
+  ASSERT_EQ(offset(0, 0), 0u);
+  ASSERT_EQ(offset(1, 0), 1u);
+  ASSERT_EQ(offset(0, 1), 2u);
+  ASSERT_EQ(offset(1, 1), 3u);
+  ASSERT_EQ(offset(2, 0), 4u);
+  ASSERT_EQ(offset(0, 2), 8u);
+  ASSERT_EQ(offset(3, 3), 15u);
+
+  // The longer extent contributes its extra bits as the high bits
+  Kokkos::View<int**, LayoutMorton, Kokkos::HostSpace> b("b", 2, 8);
+  auto const& offset_b = b.impl_map().m_impl_offset;
+  ASSERT_EQ(b.span(), 16u);
+  ASSERT_EQ(offset_b(1, 1), 3u);
+  ASSERT_EQ(offset_b(0, 2), 4u);
+  ASSERT_EQ(offset_b(1, 7), 15u);
+
+  Kokkos::View<int***, LayoutMorton, Kokkos::HostSpace> c("c", 2, 2, 2);
+  auto const& offset_c = c.impl_map().m_impl_offset;
+  ASSERT_EQ(offset_c(1, 0, 0), 1u);
+  ASSERT_EQ(offset_c(0, 1, 0), 2u);
+  ASSERT_EQ(offset_c(0, 0, 1), 4u);
+  ASSERT_EQ(offset_c(1, 1, 1), 7u);
+
+  // Non power-of-two extents are padded
+  Kokkos::View<int**, LayoutMorton, Kokkos::HostSpace> d("d", 5, 3);
+  ASSERT_EQ(d.span(), 32u);
+  ASSERT_FALSE(d.span_is_contiguous());
+
+  check_morton_offsets_unique(a);
+  check_morton_offsets_unique(b);
+  check_morton_offsets_unique(c);
+  check_morton_offsets_unique(d);
+  check_morton_offsets_unique(
+      Kokkos::View<int***, LayoutMorton, Kokkos::HostSpace>("e", 3, 9, 17));
+  check_morton_offsets_unique(
+      Kokkos::View<int***, LayoutMorton, Kokkos::HostSpace>("f", 33, 2, 5));
+}
+
+TEST(TEST_CATEGORY, view_layout_morton) {
+  test_view_layout_morton_2d<TEST_EXECSPACE>(16, 16);
+  test_view_layout_morton_2d<TEST_EXECSPACE>(37, 11);
+  test_view_layout_morton_2d<TEST_EXECSPACE>(7, 64);
+  test_view_layout_morton_3d<TEST_EXECSPACE>(8, 8, 8);
+  test_view_layout_morton_3d<TEST_EXECSPACE>(5, 13, 9);
+  test_view_layout_morton_3d<TEST_EXECSPACE>(17, 3, 6);
+}
+
+}  // namespace Test
@@ -209,4 +209,53 @@ TEST(TEST_CATEGORY, view_mapping_subview) {
   f.run();
 }
 
+// Subviews of Views with only static extents keep the static extents that the
+// offset can represent and the strides of the source.
+template <class Layout>
+void test_view_mapping_subview_static() {
+  using view_type = Kokkos::View<int[4][5][6], Layout, TEST_EXECSPACE>;
+
+  view_type a("a");
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, a.span()),
+      KOKKOS_LAMBDA(int i) { a.data()[i] = i; });
+
+  // Non-contiguous rank 2 slice keeping the layout of the source
+  auto b = Kokkos::subview(a, Kokkos::ALL, 2, Kokkos::ALL);
+  using b_type = decltype(b);
+  static_assert(std::is_same<typename b_type::array_layout, Layout>::value,
+                "");
+  static_assert(b_type::rank_dynamic == 1, "");
+  static_assert(b_type::static_extent(1) == 6, "");
+  ASSERT_EQ(b.extent(0), 4u);
+  ASSERT_EQ(b.extent(1), 6u);
+  ASSERT_EQ(b.stride(0), a.stride(0));
+  ASSERT_EQ(b.stride(1), a.stride(2));
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, 1),
+      KOKKOS_LAMBDA(int, int& err) {
+        for (int i = 0; i < 4; ++i)
+          for (int k = 0; k < 6; ++k)
+            if (b(i, k) != a(i, 2, k)) ++err;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+}
+
+TEST(TEST_CATEGORY, view_mapping_subview_static) {
+  test_view_mapping_subview_static<Kokkos::LayoutLeft>();
+  test_view_mapping_subview_static<Kokkos::LayoutRight>();
+
+  using right_type = Kokkos::View<int[4][5][6], Kokkos::LayoutRight,
+                                  TEST_EXECSPACE>;
+  using sub_type   = decltype(Kokkos::subview(
+      std::declval<right_type>(), 1, Kokkos::ALL, Kokkos::ALL));
+  static_assert(sub_type::rank_dynamic == 0, "");
+  static_assert(
+      std::is_same<typename sub_type::array_layout, Kokkos::LayoutRight>::value,
+      "");
+}
+
 }  // namespace Test